@@ -0,0 +1,202 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "common/base/Base.h"
+#include <folly/FileUtil.h>
+#include <folly/executors/IOThreadPoolExecutor.h>
+#include <folly/init/Init.h>
+#include <folly/json.h>
+#include "bench/LoadGenerator.h"
+#include "common/clients/graph/GraphClient.h"
+#include "common/network/NetworkUtils.h"
+#include "mock/MockServer.h"
+
+DEFINE_string(graphd, "127.0.0.1:3699", "Address of graphd to load, ignored with --mock");
+DEFINE_string(user, "root", "User to connect graphd");
+DEFINE_string(password, "nebula", "Password of the user");
+DEFINE_string(space, "", "Space used by each session before sending the queries");
+DEFINE_int32(concurrency, 16, "Number of the sessions sending queries concurrently");
+DEFINE_int32(warmup_secs, 5, "Seconds to send queries before the measurement");
+DEFINE_int32(duration_secs, 30, "Seconds to measure");
+DEFINE_string(mix_file, "", "File of the weighted query templates, see bench/QueryMix.h");
+DEFINE_string(query, "", "The only query template to send if --mix_file is not given");
+DEFINE_uint64(seed, 0, "Seed of the random parameters of the queries");
+DEFINE_string(report_json, "", "File to write the report in JSON besides the stdout");
+DEFINE_string(setup_file, "", "Statements executed once before the load, one a line, "
+                              "e.g. to create the schemas for --mock");
+
+DEFINE_bool(mock, false, "Load an in-process graphd backed by the mock meta and a "
+                         "generated graph in the bench storage instead of --graphd");
+DEFINE_int64(mock_vertices, 1000000, "Number of the vertices in the generated graph");
+DEFINE_int64(mock_avg_degree, 10, "Average out degree of the vertices in the generated graph");
+DEFINE_double(mock_skew, 1.0, "Exponent of the power-law degrees, 0 for the uniform graph");
+DEFINE_int64(mock_latency_us, 0, "Artificial latency of each storage response");
+DEFINE_int64(mock_jitter_us, 0, "Max random latency added to each storage response");
+
+DECLARE_int32(heartbeat_interval_secs);
+DECLARE_string(meta_server_addrs);
+
+using nebula::Status;
+using nebula::StatusOr;
+using nebula::graph::BenchGraph;
+using nebula::graph::BenchStorageServiceHandler;
+using nebula::graph::GraphClient;
+using nebula::graph::LoadGenerator;
+using nebula::graph::MockServer;
+using nebula::graph::QueryMix;
+
+namespace {
+
+// Both the servers and the meta client registering the bench storage are kept till exit
+struct MockCluster {
+    std::unique_ptr<MockServer>                     server;
+    std::unique_ptr<nebula::meta::MetaClient>       metaClient;
+    uint16_t                                        graphPort{0};
+};
+
+MockCluster startMockCluster() {
+    MockCluster cluster;
+    FLAGS_heartbeat_interval_secs = 1;
+    cluster.server = std::make_unique<MockServer>();
+    auto metaPort = cluster.server->startMeta();
+    FLAGS_meta_server_addrs = folly::stringPrintf("127.0.0.1:%d", metaPort);
+
+    BenchGraph::Options graphOptions;
+    graphOptions.numVertices = FLAGS_mock_vertices;
+    graphOptions.avgDegree = FLAGS_mock_avg_degree;
+    graphOptions.skew = FLAGS_mock_skew;
+    graphOptions.seed = FLAGS_seed;
+    BenchStorageServiceHandler::Options storageOptions;
+    storageOptions.latencyUs = FLAGS_mock_latency_us;
+    storageOptions.jitterUs = FLAGS_mock_jitter_us;
+    auto storagePort = cluster.server->startBenchStorage(
+        metaPort, BenchGraph::generate(graphOptions), storageOptions);
+
+    // Register the bench storage as the only storage host by the heartbeats,
+    // so the parts of the spaces created later are all served by it
+    auto threadPool = std::make_shared<folly::IOThreadPoolExecutor>(1);
+    auto metaHost = nebula::network::NetworkUtils::resolveHost("127.0.0.1", metaPort);
+    auto storageHost = nebula::network::NetworkUtils::resolveHost("127.0.0.1", storagePort);
+    nebula::meta::MetaClientOptions options;
+    options.localHost_ = storageHost.value().front();
+    options.clusterId_ = 100;
+    options.inStoraged_ = true;
+    cluster.metaClient = std::make_unique<nebula::meta::MetaClient>(
+        threadPool, std::move(metaHost).value(), options);
+    cluster.metaClient->waitForMetadReady();
+
+    cluster.graphPort = cluster.server->startGraph();
+    return cluster;
+}
+
+Status setUp(const std::string &addr, uint16_t port) {
+    std::string content;
+    if (!folly::readFile(FLAGS_setup_file.c_str(), content)) {
+        return Status::Error("Failed to read `%s'", FLAGS_setup_file.c_str());
+    }
+    GraphClient client(addr, port);
+    if (client.connect(FLAGS_user, FLAGS_password) != nebula::graph::cpp2::ErrorCode::SUCCEEDED) {
+        return Status::Error("Failed to connect to %s:%u", addr.c_str(), port);
+    }
+    std::vector<folly::StringPiece> lines;
+    folly::split('\n', content, lines);
+    for (auto &line : lines) {
+        auto stmt = folly::trimWhitespace(line);
+        if (stmt.empty() || stmt.front() == '#') {
+            continue;
+        }
+        nebula::graph::cpp2::ExecutionResponse resp;
+        client.execute(stmt, resp);
+        if (resp.get_error_code() != nebula::graph::cpp2::ErrorCode::SUCCEEDED) {
+            return Status::Error("Failed to execute `%s': %s",
+                                 stmt.str().c_str(),
+                                 resp.get_error_msg() == nullptr
+                                     ? ""
+                                     : resp.get_error_msg()->c_str());
+        }
+    }
+    client.disconnect();
+    // Wait for the new schemas to be pulled by graphd
+    sleep(FLAGS_heartbeat_interval_secs + 1);
+    return Status::OK();
+}
+
+StatusOr<QueryMix> loadMix() {
+    if (FLAGS_mix_file.empty()) {
+        if (FLAGS_query.empty()) {
+            return Status::Error("Either --mix_file or --query is required");
+        }
+        return QueryMix::parse(FLAGS_query);
+    }
+    std::string content;
+    if (!folly::readFile(FLAGS_mix_file.c_str(), content)) {
+        return Status::Error("Failed to read `%s'", FLAGS_mix_file.c_str());
+    }
+    return QueryMix::parse(content);
+}
+
+}   // namespace
+
+int main(int argc, char *argv[]) {
+    folly::init(&argc, &argv, true);
+
+    if (FLAGS_concurrency <= 0 || FLAGS_duration_secs <= 0 || FLAGS_warmup_secs < 0) {
+        LOG(ERROR) << "Invalid --concurrency, --duration_secs or --warmup_secs";
+        return EXIT_FAILURE;
+    }
+    auto mix = loadMix();
+    if (!mix.ok()) {
+        LOG(ERROR) << mix.status();
+        return EXIT_FAILURE;
+    }
+
+    LoadGenerator::Options options;
+    MockCluster cluster;
+    if (FLAGS_mock) {
+        LOG(INFO) << "Starting the mock cluster";
+        cluster = startMockCluster();
+        options.addr = "127.0.0.1";
+        options.port = cluster.graphPort;
+    } else {
+        auto addrs = nebula::network::NetworkUtils::toHosts(FLAGS_graphd);
+        if (!addrs.ok() || addrs.value().size() != 1) {
+            LOG(ERROR) << "Invalid address of graphd `" << FLAGS_graphd << "'";
+            return EXIT_FAILURE;
+        }
+        options.addr = addrs.value().front().host;
+        options.port = addrs.value().front().port;
+    }
+    if (!FLAGS_setup_file.empty()) {
+        auto status = setUp(options.addr, options.port);
+        if (!status.ok()) {
+            LOG(ERROR) << status;
+            return EXIT_FAILURE;
+        }
+    }
+
+    options.user = FLAGS_user;
+    options.password = FLAGS_password;
+    options.space = FLAGS_space;
+    options.concurrency = FLAGS_concurrency;
+    options.warmupSecs = FLAGS_warmup_secs;
+    options.durationSecs = FLAGS_duration_secs;
+    options.seed = FLAGS_seed;
+    LoadGenerator generator(std::move(options), &mix.value());
+    auto report = generator.run();
+    if (!report.ok()) {
+        LOG(ERROR) << report.status();
+        return EXIT_FAILURE;
+    }
+    std::cout << LoadGenerator::toString(report.value(), mix.value());
+    if (!FLAGS_report_json.empty()) {
+        auto json = folly::toPrettyJson(LoadGenerator::toJson(report.value(), mix.value()));
+        if (!folly::writeFile(json, FLAGS_report_json.c_str())) {
+            LOG(ERROR) << "Failed to write the report to " << FLAGS_report_json;
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,78 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "bench/LatencyHistogram.h"
+
+namespace nebula {
+namespace graph {
+
+void LatencyHistogram::add(int64_t value) {
+    value = std::max<int64_t>(value, 0);
+    auto bucket = bucketOf(value);
+    // Grown on demand, most of the latencies are far below the max of int64
+    if (bucket >= counts_.size()) {
+        counts_.resize(bucket + 1, 0);
+    }
+    ++counts_[bucket];
+    ++count_;
+    sum_ += value;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) {
+    if (other.counts_.size() > counts_.size()) {
+        counts_.resize(other.counts_.size(), 0);
+    }
+    for (size_t i = 0; i < other.counts_.size(); ++i) {
+        counts_[i] += other.counts_[i];
+    }
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+int64_t LatencyHistogram::percentile(double percent) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    auto rank = static_cast<uint64_t>(std::ceil(count_ * percent / 100));
+    rank = std::max<uint64_t>(rank, 1);
+    uint64_t count = 0;
+    for (size_t i = 0; i < counts_.size(); ++i) {
+        count += counts_[i];
+        if (count >= rank) {
+            return std::min(upperBoundOf(i), max_);
+        }
+    }
+    return max_;
+}
+
+// static
+size_t LatencyHistogram::bucketOf(int64_t value) {
+    if (value < 2 * kSubBuckets) {
+        return value;
+    }
+    // Keep the highest bit and the `kSubBits' bits following it
+    int64_t high = 63 - __builtin_clzll(value);
+    auto shift = high - kSubBits;
+    return 2 * kSubBuckets + (shift - 1) * kSubBuckets + ((value >> shift) - kSubBuckets);
+}
+
+// static
+int64_t LatencyHistogram::upperBoundOf(size_t bucket) {
+    if (bucket < 2 * kSubBuckets) {
+        return bucket;
+    }
+    auto shift = (bucket - 2 * kSubBuckets) / kSubBuckets + 1;
+    uint64_t sub = (bucket - 2 * kSubBuckets) % kSubBuckets + kSubBuckets;
+    // No overflow for the last bucket, whose upper bound is the max of int64
+    return static_cast<int64_t>(((sub + 1) << shift) - 1);
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,66 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef BENCH_LATENCYHISTOGRAM_H_
+#define BENCH_LATENCYHISTOGRAM_H_
+
+#include "common/base/Base.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * A histogram of the latencies in the layout of HdrHistogram with three significant
+ * digits, i.e. the values below 2048 are counted exactly and every power of two above
+ * is split into 1024 buckets, so the percentiles are within 0.1% of the real ones.
+ *
+ * It's not thread-safe, each thread records into its own and they are merged at last.
+ */
+class LatencyHistogram final {
+public:
+    void add(int64_t value);
+
+    void merge(const LatencyHistogram &other);
+
+    uint64_t count() const {
+        return count_;
+    }
+
+    int64_t min() const {
+        return count_ == 0 ? 0 : min_;
+    }
+
+    int64_t max() const {
+        return max_;
+    }
+
+    double mean() const {
+        return count_ == 0 ? 0.0 : static_cast<double>(sum_) / count_;
+    }
+
+    // The value which `percent' of the values are not above, e.g. 99.9 for p999
+    int64_t percentile(double percent) const;
+
+private:
+    static constexpr int64_t kSubBits = 10;
+    static constexpr int64_t kSubBuckets = 1L << kSubBits;
+
+    static size_t bucketOf(int64_t value);
+
+    static int64_t upperBoundOf(size_t bucket);
+
+private:
+    std::vector<uint64_t>       counts_;
+    uint64_t                    count_{0};
+    int64_t                     sum_{0};
+    int64_t                     min_{std::numeric_limits<int64_t>::max()};
+    int64_t                     max_{0};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // BENCH_LATENCYHISTOGRAM_H_
@@ -0,0 +1,204 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "bench/LoadGenerator.h"
+
+#include "common/clients/graph/GraphClient.h"
+#include "common/time/Duration.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+constexpr double kPercentiles[] = {50, 90, 99, 99.9};
+
+std::string percentileName(double percent) {
+    auto name = folly::to<std::string>(percent);
+    name.erase(std::remove(name.begin(), name.end(), '.'), name.end());
+    return "p" + name;
+}
+
+folly::dynamic toJson(const LatencyHistogram &latency) {
+    auto json = folly::dynamic::object("count", latency.count())("mean", latency.mean())(
+        "min", latency.min())("max", latency.max());
+    for (auto percent : kPercentiles) {
+        json.insert(percentileName(percent), latency.percentile(percent));
+    }
+    return json;
+}
+
+std::string toString(const LatencyHistogram &latency) {
+    auto str = folly::stringPrintf("mean %.1f", latency.mean());
+    for (auto percent : kPercentiles) {
+        str.append(folly::stringPrintf(", %s %ld",
+                                       percentileName(percent).c_str(),
+                                       latency.percentile(percent)));
+    }
+    str.append(folly::stringPrintf(", max %ld", latency.max()));
+    return str;
+}
+
+}   // namespace
+
+void LoadGenerator::Stats::merge(const Stats &other) {
+    queries += other.queries;
+    errors += other.errors;
+    for (auto &kv : other.errorCodes) {
+        errorCodes[kv.first] += kv.second;
+    }
+    latency.merge(other.latency);
+    serverLatency.merge(other.serverLatency);
+}
+
+StatusOr<LoadGenerator::Report> LoadGenerator::run() {
+    if (options_.concurrency == 0) {
+        return Status::Error("The concurrency should be positive");
+    }
+    // All the sessions are ready before the clock starts
+    std::vector<std::unique_ptr<GraphClient>> clients;
+    for (size_t i = 0; i < options_.concurrency; ++i) {
+        auto client = std::make_unique<GraphClient>(options_.addr, options_.port);
+        auto code = client->connect(options_.user, options_.password);
+        if (code != cpp2::ErrorCode::SUCCEEDED) {
+            return Status::Error("Failed to connect to %s:%u: %s",
+                                 options_.addr.c_str(),
+                                 options_.port,
+                                 cpp2::_ErrorCode_VALUES_TO_NAMES.at(code));
+        }
+        if (!options_.space.empty()) {
+            cpp2::ExecutionResponse resp;
+            code = client->execute("USE " + options_.space, resp);
+            if (code != cpp2::ErrorCode::SUCCEEDED ||
+                resp.get_error_code() != cpp2::ErrorCode::SUCCEEDED) {
+                return Status::Error("Failed to use the space `%s'", options_.space.c_str());
+            }
+        }
+        clients.emplace_back(std::move(client));
+    }
+
+    phase_ = options_.warmupSecs > 0 ? Phase::kWarmup : Phase::kMeasure;
+    std::vector<std::vector<Stats>> stats(options_.concurrency,
+                                          std::vector<Stats>(mix_->size()));
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < options_.concurrency; ++i) {
+        workers.emplace_back([this, i, client = clients[i].get(), &stats]() {
+            work(i, client, &stats[i]);
+        });
+    }
+    if (options_.warmupSecs > 0) {
+        std::this_thread::sleep_for(std::chrono::seconds(options_.warmupSecs));
+        phase_ = Phase::kMeasure;
+    }
+    time::Duration duration;
+    std::this_thread::sleep_for(std::chrono::seconds(options_.durationSecs));
+    phase_ = Phase::kStop;
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    Report report;
+    // The queries sent just before the stop are waited for
+    report.seconds = duration.elapsedInUSec() / 1000000.0;
+    report.templates.resize(mix_->size());
+    for (auto &workerStats : stats) {
+        for (size_t i = 0; i < workerStats.size(); ++i) {
+            report.templates[i].merge(workerStats[i]);
+            report.total.merge(workerStats[i]);
+        }
+    }
+    for (auto &client : clients) {
+        client->disconnect();
+    }
+    return report;
+}
+
+void LoadGenerator::work(size_t id, GraphClient *client, std::vector<Stats> *stats) {
+    std::mt19937_64 engine(options_.seed + id);
+    while (true) {
+        auto phase = phase_.load();
+        if (phase == Phase::kStop) {
+            break;
+        }
+        auto index = mix_->pick(engine);
+        auto query = QueryMix::substitute(mix_->at(index), engine, seq_++);
+        cpp2::ExecutionResponse resp;
+        time::Duration latency;
+        auto code = client->execute(query, resp);
+        auto elapsed = latency.elapsedInUSec();
+        if (phase != Phase::kMeasure) {
+            continue;
+        }
+        auto &templateStats = (*stats)[index];
+        ++templateStats.queries;
+        templateStats.latency.add(elapsed);
+        if (code == cpp2::ErrorCode::SUCCEEDED) {
+            templateStats.serverLatency.add(resp.get_latency_in_us());
+            code = resp.get_error_code();
+        }
+        if (code != cpp2::ErrorCode::SUCCEEDED) {
+            ++templateStats.errors;
+            ++templateStats.errorCodes[cpp2::_ErrorCode_VALUES_TO_NAMES.at(code)];
+            VLOG(1) << "Failed to execute `" << query << "': "
+                    << (resp.get_error_msg() == nullptr ? "" : *resp.get_error_msg());
+        }
+    }
+}
+
+// static
+std::string LoadGenerator::toString(const Report &report, const QueryMix &mix) {
+    auto qps = [&report](const Stats &stats) {
+        return report.seconds > 0 ? stats.queries / report.seconds : 0.0;
+    };
+    std::stringstream ss;
+    ss << folly::stringPrintf("Duration: %.2fs, queries: %lu, errors: %lu, throughput: %.1f qps\n",
+                              report.seconds,
+                              report.total.queries,
+                              report.total.errors,
+                              qps(report.total));
+    ss << "Client latency(us): " << graph::toString(report.total.latency) << "\n";
+    ss << "Server latency(us): " << graph::toString(report.total.serverLatency) << "\n";
+    for (size_t i = 0; i < report.templates.size(); ++i) {
+        auto &stats = report.templates[i];
+        ss << folly::stringPrintf("[%lu] %s\n    queries: %lu, errors: %lu, %.1f qps, ",
+                                  i,
+                                  mix.at(i).text.c_str(),
+                                  stats.queries,
+                                  stats.errors,
+                                  qps(stats))
+           << graph::toString(stats.latency) << "\n";
+    }
+    for (auto &kv : report.total.errorCodes) {
+        ss << "Error " << kv.first << ": " << kv.second << "\n";
+    }
+    return ss.str();
+}
+
+// static
+folly::dynamic LoadGenerator::toJson(const Report &report, const QueryMix &mix) {
+    auto statsToJson = [&report](const Stats &stats) {
+        auto errorCodes = folly::dynamic::object();
+        for (auto &kv : stats.errorCodes) {
+            errorCodes.insert(kv.first, kv.second);
+        }
+        return folly::dynamic::object("queries", stats.queries)("errors", stats.errors)(
+            "qps", report.seconds > 0 ? stats.queries / report.seconds : 0.0)(
+            "errorCodes", std::move(errorCodes))("latencyInUs", graph::toJson(stats.latency))(
+            "serverLatencyInUs", graph::toJson(stats.serverLatency));
+    };
+    auto templates = folly::dynamic::array();
+    for (size_t i = 0; i < report.templates.size(); ++i) {
+        auto json = statsToJson(report.templates[i]);
+        json.insert("query", mix.at(i).text);
+        json.insert("weight", mix.at(i).weight);
+        templates.push_back(std::move(json));
+    }
+    return folly::dynamic::object("seconds", report.seconds)("total", statsToJson(report.total))(
+        "templates", std::move(templates));
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,87 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef BENCH_LOADGENERATOR_H_
+#define BENCH_LOADGENERATOR_H_
+
+#include "common/base/Base.h"
+#include "common/base/StatusOr.h"
+#include <folly/dynamic.h>
+#include "bench/LatencyHistogram.h"
+#include "bench/QueryMix.h"
+
+namespace nebula {
+namespace graph {
+
+class GraphClient;
+
+/**
+ * The closed-loop load generator, each of the `concurrency' workers holds a session
+ * and sends the next query as soon as the last one is responded. Only the queries sent
+ * after the warmup and before the end of the duration are measured.
+ */
+class LoadGenerator final {
+public:
+    struct Options {
+        std::string     addr{"127.0.0.1"};
+        uint16_t        port{3699};
+        std::string     user{"root"};
+        std::string     password{"nebula"};
+        // Used by each session before sending the queries if not empty
+        std::string     space;
+        size_t          concurrency{1};
+        int64_t         warmupSecs{0};
+        int64_t         durationSecs{10};
+        uint64_t        seed{0};
+    };
+
+    struct Stats {
+        uint64_t                                queries{0};
+        uint64_t                                errors{0};
+        std::map<std::string, uint64_t>         errorCodes;
+        // The latency seen by the client and the one reported by graphd
+        LatencyHistogram                        latency;
+        LatencyHistogram                        serverLatency;
+
+        void merge(const Stats &other);
+    };
+
+    struct Report {
+        double                                  seconds{0};
+        Stats                                   total;
+        // Of each template in the mix
+        std::vector<Stats>                      templates;
+    };
+
+    LoadGenerator(Options options, const QueryMix *mix)
+        : options_(std::move(options)), mix_(mix) {}
+
+    // Block until the end of the duration
+    StatusOr<Report> run();
+
+    static std::string toString(const Report &report, const QueryMix &mix);
+
+    static folly::dynamic toJson(const Report &report, const QueryMix &mix);
+
+private:
+    enum class Phase : uint8_t {
+        kWarmup,
+        kMeasure,
+        kStop,
+    };
+
+    void work(size_t id, GraphClient *client, std::vector<Stats> *stats);
+
+    Options                         options_;
+    const QueryMix                 *mix_{nullptr};
+    std::atomic<Phase>              phase_{Phase::kWarmup};
+    std::atomic<int64_t>            seq_{0};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // BENCH_LOADGENERATOR_H_
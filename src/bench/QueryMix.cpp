@@ -0,0 +1,125 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "bench/QueryMix.h"
+
+#include <regex>
+
+namespace nebula {
+namespace graph {
+
+// static
+StatusOr<QueryMix> QueryMix::parse(const std::string &content) {
+    QueryMix mix;
+    std::vector<folly::StringPiece> lines;
+    folly::split('\n', content, lines);
+    double total = 0.0;
+    for (auto &line : lines) {
+        auto trimmed = folly::trimWhitespace(line);
+        if (trimmed.empty() || trimmed.front() == '#') {
+            continue;
+        }
+        auto tmpl = parseTemplate(trimmed.str());
+        NG_RETURN_IF_ERROR(tmpl);
+        total += tmpl.value().weight;
+        mix.cumulative_.emplace_back(total);
+        mix.templates_.emplace_back(std::move(tmpl).value());
+    }
+    if (mix.templates_.empty()) {
+        return Status::Error("No query in the mix");
+    }
+    return mix;
+}
+
+// static
+StatusOr<QueryMix::Template> QueryMix::parseTemplate(const std::string &line) {
+    static const std::regex kWeight(R"(^\s*\[\s*([0-9]*\.?[0-9]+)\s*\]\s*(.*)$)");
+    static const std::regex kPlaceholder(R"(\{(int|vid):(-?\d+):(-?\d+)\}|\{seq\})");
+
+    Template tmpl;
+    std::smatch match;
+    if (std::regex_match(line, match, kWeight)) {
+        tmpl.weight = folly::to<double>(match[1].str());
+        tmpl.text = match[2].str();
+    } else {
+        tmpl.text = line;
+    }
+    if (tmpl.weight <= 0) {
+        return Status::Error("Non-positive weight of `%s'", line.c_str());
+    }
+    if (tmpl.text.empty()) {
+        return Status::Error("Empty query of `%s'", line.c_str());
+    }
+
+    using Piece = Template::Piece;
+    auto begin = tmpl.text.cbegin();
+    for (std::sregex_iterator it(tmpl.text.begin(), tmpl.text.end(), kPlaceholder), end;
+         it != end;
+         ++it) {
+        auto &placeholder = *it;
+        if (placeholder.position() > begin - tmpl.text.cbegin()) {
+            Piece text;
+            text.text.assign(begin, tmpl.text.cbegin() + placeholder.position());
+            tmpl.pieces.emplace_back(std::move(text));
+        }
+        begin = tmpl.text.cbegin() + placeholder.position() + placeholder.length();
+        Piece piece;
+        if (placeholder[1].matched) {
+            piece.kind = placeholder[1].str() == "int" ? Piece::Kind::kInt : Piece::Kind::kVid;
+            piece.low = folly::to<int64_t>(placeholder[2].str());
+            piece.high = folly::to<int64_t>(placeholder[3].str());
+            if (piece.low > piece.high) {
+                return Status::Error("Empty range of `%s'", placeholder.str().c_str());
+            }
+        } else {
+            piece.kind = Piece::Kind::kSeq;
+        }
+        tmpl.pieces.emplace_back(std::move(piece));
+    }
+    if (begin != tmpl.text.cend()) {
+        Piece text;
+        text.text.assign(begin, tmpl.text.cend());
+        tmpl.pieces.emplace_back(std::move(text));
+    }
+    return tmpl;
+}
+
+size_t QueryMix::pick(std::mt19937_64 &engine) const {
+    std::uniform_real_distribution<double> uniform(0.0, cumulative_.back());
+    auto it = std::upper_bound(cumulative_.begin(), cumulative_.end(), uniform(engine));
+    return std::min<size_t>(it - cumulative_.begin(), templates_.size() - 1);
+}
+
+// static
+std::string QueryMix::substitute(const Template &tmpl, std::mt19937_64 &engine, int64_t seq) {
+    using Kind = Template::Piece::Kind;
+    std::string query;
+    query.reserve(tmpl.text.size());
+    for (auto &piece : tmpl.pieces) {
+        switch (piece.kind) {
+            case Kind::kText:
+                query.append(piece.text);
+                break;
+            case Kind::kInt: {
+                std::uniform_int_distribution<int64_t> uniform(piece.low, piece.high);
+                query.append(folly::to<std::string>(uniform(engine)));
+                break;
+            }
+            case Kind::kVid: {
+                std::uniform_int_distribution<int64_t> uniform(piece.low, piece.high);
+                query.append("\"").append(folly::to<std::string>(uniform(engine))).append("\"");
+                break;
+            }
+            case Kind::kSeq:
+                query.append(folly::to<std::string>(seq));
+                break;
+        }
+    }
+    return query;
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,77 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef BENCH_QUERYMIX_H_
+#define BENCH_QUERYMIX_H_
+
+#include "common/base/Base.h"
+#include "common/base/StatusOr.h"
+#include <random>
+
+namespace nebula {
+namespace graph {
+
+/**
+ * The weighted templates of the queries sent by the load generator, one template a line:
+ *
+ *   # Comments and the empty lines are skipped
+ *   [8] GO FROM {vid:0:999999} OVER like YIELD like._dst
+ *   [1] INSERT VERTEX person(name, age) VALUES "{seq}":("p{seq}", {int:18:80})
+ *
+ * The optional `[weight]' prefix defaults to 1. The placeholders are substituted for each
+ * query: `{int:LO:HI}' by a uniformly random integer in [LO, HI], `{vid:LO:HI}' by one
+ * quoted as a vid, and `{seq}' by a sequence number unique among all the queries sent.
+ */
+class QueryMix final {
+public:
+    struct Template {
+        double              weight{1.0};
+        std::string         text;
+
+        // The fragments of the text, each of which is either a literal or a placeholder
+        struct Piece {
+            enum class Kind : uint8_t {
+                kText,
+                kInt,
+                kVid,
+                kSeq,
+            };
+
+            Kind            kind{Kind::kText};
+            std::string     text;
+            int64_t         low{0};
+            int64_t         high{0};
+        };
+        std::vector<Piece>  pieces;
+    };
+
+    static StatusOr<QueryMix> parse(const std::string &content);
+
+    static StatusOr<Template> parseTemplate(const std::string &line);
+
+    size_t size() const {
+        return templates_.size();
+    }
+
+    const Template &at(size_t index) const {
+        return templates_[index];
+    }
+
+    // Pick a template by the weights
+    size_t pick(std::mt19937_64 &engine) const;
+
+    static std::string substitute(const Template &tmpl, std::mt19937_64 &engine, int64_t seq);
+
+private:
+    std::vector<Template>       templates_;
+    // The running sums of the weights
+    std::vector<double>         cumulative_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // BENCH_QUERYMIX_H_
@@ -0,0 +1,68 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "bench/LatencyHistogram.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(LatencyHistogramTest, Empty) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.count());
+    EXPECT_EQ(0, histogram.min());
+    EXPECT_EQ(0, histogram.max());
+    EXPECT_EQ(0.0, histogram.mean());
+    EXPECT_EQ(0, histogram.percentile(99));
+}
+
+TEST(LatencyHistogramTest, Exact) {
+    LatencyHistogram histogram;
+    for (int64_t i = 1; i <= 1000; ++i) {
+        histogram.add(i);
+    }
+    EXPECT_EQ(1000, histogram.count());
+    EXPECT_EQ(1, histogram.min());
+    EXPECT_EQ(1000, histogram.max());
+    EXPECT_DOUBLE_EQ(500.5, histogram.mean());
+    EXPECT_EQ(500, histogram.percentile(50));
+    EXPECT_EQ(990, histogram.percentile(99));
+    EXPECT_EQ(999, histogram.percentile(99.9));
+    EXPECT_EQ(1000, histogram.percentile(100));
+}
+
+TEST(LatencyHistogramTest, Precision) {
+    LatencyHistogram histogram;
+    for (int64_t i = 1; i <= 100000; ++i) {
+        histogram.add(i * 100);
+    }
+    for (auto percent : {50.0, 90.0, 99.0, 99.9}) {
+        auto expected = static_cast<int64_t>(percent * 100000);
+        auto actual = histogram.percentile(percent);
+        EXPECT_GE(actual, expected);
+        EXPECT_LE(actual, expected + expected / 1000 + 1);
+    }
+    EXPECT_EQ(10000000, histogram.percentile(100));
+}
+
+TEST(LatencyHistogramTest, Merge) {
+    LatencyHistogram small;
+    LatencyHistogram large;
+    for (int64_t i = 1; i <= 100; ++i) {
+        small.add(i);
+        large.add(i * 1000000);
+    }
+    small.merge(large);
+    EXPECT_EQ(200, small.count());
+    EXPECT_EQ(1, small.min());
+    EXPECT_EQ(100000000, small.max());
+    EXPECT_EQ(100, small.percentile(50));
+    EXPECT_EQ(100000000, small.percentile(100));
+}
+
+}   // namespace graph
+}   // namespace nebula
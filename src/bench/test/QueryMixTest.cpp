@@ -0,0 +1,64 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "bench/QueryMix.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(QueryMixTest, Parse) {
+    auto mix = QueryMix::parse(
+        "# The comments and empty lines are skipped\n"
+        "\n"
+        "[3] GO FROM {vid:0:9} OVER like\n"
+        "  YIELD 1  \n");
+    ASSERT_TRUE(mix.ok()) << mix.status();
+    ASSERT_EQ(2, mix.value().size());
+    EXPECT_EQ(3.0, mix.value().at(0).weight);
+    EXPECT_EQ("GO FROM {vid:0:9} OVER like", mix.value().at(0).text);
+    EXPECT_EQ(1.0, mix.value().at(1).weight);
+    EXPECT_EQ("YIELD 1", mix.value().at(1).text);
+
+    EXPECT_FALSE(QueryMix::parse("# Nothing\n").ok());
+    EXPECT_FALSE(QueryMix::parse("[0] YIELD 1").ok());
+    EXPECT_FALSE(QueryMix::parse("[2]").ok());
+    EXPECT_FALSE(QueryMix::parse("YIELD {int:9:0}").ok());
+}
+
+TEST(QueryMixTest, Substitute) {
+    auto tmpl = QueryMix::parseTemplate(
+        "INSERT VERTEX person(age) VALUES \"{seq}\":({int:18:20}), {vid:5:5}");
+    ASSERT_TRUE(tmpl.ok()) << tmpl.status();
+    std::mt19937_64 engine(0);
+    for (int i = 0; i < 100; ++i) {
+        auto query = QueryMix::substitute(tmpl.value(), engine, 42);
+        EXPECT_TRUE(query == "INSERT VERTEX person(age) VALUES \"42\":(18), \"5\"" ||
+                    query == "INSERT VERTEX person(age) VALUES \"42\":(19), \"5\"" ||
+                    query == "INSERT VERTEX person(age) VALUES \"42\":(20), \"5\"")
+            << query;
+    }
+
+    auto plain = QueryMix::parseTemplate("SHOW SPACES");
+    ASSERT_TRUE(plain.ok());
+    EXPECT_EQ("SHOW SPACES", QueryMix::substitute(plain.value(), engine, 0));
+}
+
+TEST(QueryMixTest, Pick) {
+    auto mix = QueryMix::parse("[9] YIELD 1\n[1] YIELD 2\n");
+    ASSERT_TRUE(mix.ok());
+    std::mt19937_64 engine(0);
+    std::vector<size_t> counts(2, 0);
+    for (int i = 0; i < 10000; ++i) {
+        counts[mix.value().pick(engine)]++;
+    }
+    EXPECT_GT(counts[0], 8500);
+    EXPECT_LT(counts[0], 9500);
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,65 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/CancellationToken.h"
+
+namespace nebula {
+namespace graph {
+
+void CancellationToken::cancel(Status reason) {
+    Callback callback;
+    {
+        std::lock_guard<std::mutex> g(lock_);
+        if (cancelled_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        reason_ = std::move(reason);
+        cancelled_.store(true, std::memory_order_release);
+        if (!callback_) {
+            return;
+        }
+        callback = std::move(callback_);
+        callback_ = nullptr;
+        running_ = true;
+    }
+    // The reason is never changed once cancelled
+    callback(reason_);
+    std::lock_guard<std::mutex> g(lock_);
+    running_ = false;
+    done_.notify_all();
+}
+
+Status CancellationToken::check() {
+    if (!isCancelled()) {
+        auto deadline = deadline_.load(std::memory_order_acquire);
+        if (Clock::now().time_since_epoch().count() <= deadline) {
+            return Status::OK();
+        }
+        cancel(Status::Error("Execution timeout"));
+    }
+    std::lock_guard<std::mutex> g(lock_);
+    return reason_;
+}
+
+void CancellationToken::setCallback(Callback callback) {
+    {
+        std::lock_guard<std::mutex> g(lock_);
+        if (!cancelled_.load(std::memory_order_relaxed)) {
+            callback_ = std::move(callback);
+            return;
+        }
+    }
+    callback(reason_);
+}
+
+void CancellationToken::clearCallback() {
+    std::unique_lock<std::mutex> g(lock_);
+    callback_ = nullptr;
+    done_.wait(g, [this]() { return !running_; });
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,75 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_CANCELLATIONTOKEN_H_
+#define CONTEXT_CANCELLATIONTOKEN_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+#include "common/base/Status.h"
+#include "common/cpp/helpers.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * CancellationToken tells the running query whether it's killed or has exceeded its deadline.
+ * The executors check it cooperatively between the batches of work, and the query instance
+ * registers a callback to respond to the client as soon as the query is cancelled.
+ *
+ * It's thread-safe and shared by the timer of the deadline, so it should be held by
+ * a shared pointer.
+ */
+class CancellationToken final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void(const Status&)>;
+
+    CancellationToken() = default;
+
+    // Cancel the query for `reason', only the first cancellation takes effect
+    void cancel(Status reason);
+
+    bool isCancelled() const {
+        return cancelled_.load(std::memory_order_acquire);
+    }
+
+    void setDeadline(Clock::time_point deadline) {
+        deadline_.store(deadline.time_since_epoch().count(), std::memory_order_release);
+    }
+
+    // Return the reason if the query is cancelled or timed out, otherwise OK
+    Status check();
+
+    // The callback is invoked once on cancellation by the thread cancelling the query,
+    // or at once if it's already cancelled. It's called without the lock of the token held,
+    // but should only hand the work over to another thread since the canceller might be
+    // the timer or the query killing it.
+    void setCallback(Callback callback);
+
+    // Wait for the running callback if any, it won't be called afterwards
+    void clearCallback();
+
+private:
+    std::atomic<bool>                   cancelled_{false};
+    std::atomic<Clock::rep>             deadline_{Clock::time_point::max().time_since_epoch()
+                                                      .count()};
+    std::mutex                          lock_;
+    // Notified when the callback taken out by `cancel' returns
+    std::condition_variable             done_;
+    bool                                running_{false};
+    Status                              reason_;
+    Callback                            callback_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // CONTEXT_CANCELLATIONTOKEN_H_
@@ -45,6 +45,17 @@ void ExecutionContext::truncHistory(const std::string& name, size_t numVersionsT
     }
 }
 
+std::vector<std::string> ExecutionContext::variables() const {
+    std::vector<std::string> names;
+    names.reserve(valueMap_.size());
+    for (auto& var : valueMap_) {
+        if (!var.second.empty()) {
+            names.emplace_back(var.first);
+        }
+    }
+    return names;
+}
+
 // Get the latest version of the value
 const Value& ExecutionContext::getValue(const std::string& name) const {
     return getResult(name).value();
@@ -71,6 +71,14 @@ public:
         return valueMap_.find(name) != valueMap_.end();
     }
 
+    // The names of all the variables which have been set
+    std::vector<std::string> variables() const;
+
+    // Drop the values of all the variables, e.g. once the query is cancelled
+    void clear() {
+        valueMap_.clear();
+    }
+
 private:
     friend class QueryInstance;
     Value moveValue(const std::string& name);
@@ -0,0 +1,123 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/PreparedStatement.h"
+
+#include "context/QueryStats.h"
+#include "planner/ExecutionPlan.h"
+
+namespace nebula {
+namespace graph {
+
+PreparedStatement::PreparedStatement(std::string query,
+                                     SpaceDescription space,
+                                     std::unique_ptr<Sentence> sentence,
+                                     std::unique_ptr<QueryContext> qctx)
+    : query_(std::move(query)),
+      space_(std::move(space)),
+      sentence_(std::move(sentence)),
+      qctx_(std::move(qctx)) {
+    DCHECK(qctx_->plan()->root() != nullptr);
+    fingerprint_ = QueryStats::fingerprint(sentence_.get());
+    auto *ectx = qctx_->ectx();
+    for (auto &var : ectx->variables()) {
+        auto &result = ectx->getResult(var);
+        inputs_.emplace(var, Input{result.value(), result.iter()->kind()});
+    }
+    slots_ = qctx_->vctx()->parameterSlots();
+    params_ = qctx_->vctx()->parameters();
+    auto versions = schemaVersions(qctx_->schemaMng());
+    if (versions.ok()) {
+        schemaVersions_ = std::move(versions).value();
+    } else {
+        LOG(WARNING) << "Failed to get the schemas of space " << space_.name << ": "
+                     << versions.status();
+    }
+}
+
+// static
+std::shared_ptr<const PreparedStatement> PreparedStatement::acquire(
+    std::shared_ptr<const PreparedStatement> statement) {
+    if (statement->executing_.exchange(true)) {
+        return nullptr;
+    }
+    auto *raw = statement.get();
+    return std::shared_ptr<const PreparedStatement>(
+        raw, [statement = std::move(statement)](const PreparedStatement *) {
+            statement->executing_.store(false);
+        });
+}
+
+bool PreparedStatement::schemaChanged(meta::SchemaManager *schemaMng) const {
+    auto versions = schemaVersions(schemaMng);
+    // Prepared again if not sure
+    return !versions.ok() || !(versions.value() == schemaVersions_);
+}
+
+StatusOr<PreparedStatement::SchemaVersions> PreparedStatement::schemaVersions(
+    meta::SchemaManager *schemaMng) const {
+    SchemaVersions versions;
+    if (space_.id == -1) {
+        return versions;
+    }
+    auto tags = schemaMng->getAllVerTagSchema(space_.id);
+    NG_RETURN_IF_ERROR(tags);
+    for (auto &tag : tags.value()) {
+        if (!tag.second.empty()) {
+            versions.tags.emplace(tag.first, tag.second.back()->getVersion());
+        }
+    }
+    auto edges = schemaMng->getAllVerEdgeSchema(space_.id);
+    NG_RETURN_IF_ERROR(edges);
+    for (auto &edge : edges.value()) {
+        if (!edge.second.empty()) {
+            versions.edges.emplace(edge.first, edge.second.back()->getVersion());
+        }
+    }
+    return versions;
+}
+
+Status PreparedStatement::bind(const std::unordered_map<std::string, Value> &params,
+                               QueryContext *qctx) const {
+    for (auto &name : params_) {
+        if (params.find(name) == params.end()) {
+            return Status::SemanticError("Parameter `$%s' is not given.", name.c_str());
+        }
+    }
+    for (auto &param : params) {
+        if (params_.find(param.first) == params_.end()) {
+            return Status::SemanticError("Unknown parameter `$%s'.", param.first.c_str());
+        }
+        // Only the vids are parameterized for now
+        if (!param.second.isStr()) {
+            return Status::SemanticError("Parameter `$%s' should be a string as the vid.",
+                                         param.first.c_str());
+        }
+    }
+
+    auto inputs = inputs_;
+    for (auto &slot : slots_) {
+        auto &ds = inputs.at(slot.var).value.mutableDataSet();
+        DCHECK_LT(slot.row, ds.rows.size());
+        ds.rows[slot.row].values[0] = params.at(slot.name);
+    }
+    auto *ectx = qctx->ectx();
+    for (auto &input : inputs) {
+        ResultBuilder builder;
+        builder.value(std::move(input.second.value)).iter(input.second.iterKind);
+        ectx->setResult(input.first, builder.finish());
+    }
+    // The parameters might also be evaluated at runtime, e.g. in the filters
+    for (auto &param : params) {
+        ectx->setValue(param.first, Value(param.second));
+    }
+
+    qctx->plan()->setRoot(qctx_->plan()->root());
+    return Status::OK();
+}
+
+}   // namespace graph
+}   // namespace nebula
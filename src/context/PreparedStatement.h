@@ -0,0 +1,110 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_PREPAREDSTATEMENT_H_
+#define CONTEXT_PREPAREDSTATEMENT_H_
+
+#include "common/base/Base.h"
+#include "common/base/Status.h"
+#include "common/cpp/helpers.h"
+#include "common/datatypes/Value.h"
+#include "context/Iterator.h"
+#include "context/QueryContext.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * PreparedStatement is a query parsed and validated once by PREPARE, and executed many
+ * times by EXECUTE without being parsed or validated again. The `$param' placeholders
+ * in the vid lists are bound to the values given by EXECUTE on each execution.
+ *
+ * The plan is not safe to be executed concurrently, since the expressions are mutated when
+ * evaluated, so it's only used by the execution which acquired it, and the others have to
+ * prepare the query again for themselves. The constant inputs are copied into each execution.
+ */
+class PreparedStatement final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    // `qctx' is the context the statement was validated in, which owns the plan,
+    // its request context should have been released. `space' is the space of the session
+    // when prepared, whose id is -1 if none.
+    PreparedStatement(std::string query,
+                      SpaceDescription space,
+                      std::unique_ptr<Sentence> sentence,
+                      std::unique_ptr<QueryContext> qctx);
+
+    const std::string& query() const {
+        return query_;
+    }
+
+    const std::string& fingerprint() const {
+        return fingerprint_;
+    }
+
+    // The space the statement was prepared in, -1 if none
+    GraphSpaceID space() const {
+        return space_.id;
+    }
+
+    const std::string& spaceName() const {
+        return space_.name;
+    }
+
+    const std::unordered_set<std::string>& parameters() const {
+        return params_;
+    }
+
+    const Sentence* sentence() const {
+        return sentence_.get();
+    }
+
+    // Acquire the statement for an execution, which is released when the pointer returned
+    // is destroyed, null if it's being executed.
+    static std::shared_ptr<const PreparedStatement> acquire(
+        std::shared_ptr<const PreparedStatement> statement);
+
+    // Whether any tag or edge of the space has been created, dropped or altered since prepared
+    bool schemaChanged(meta::SchemaManager *schemaMng) const;
+
+    // Bind `params' for an execution in `qctx', all the parameters should be given.
+    // The plan of `qctx' is set to the prepared one.
+    Status bind(const std::unordered_map<std::string, Value> &params, QueryContext *qctx) const;
+
+private:
+    struct Input {
+        Value               value;
+        Iterator::Kind      iterKind;
+    };
+
+    // The latest versions of the schemas of the tags and the edges
+    struct SchemaVersions {
+        std::unordered_map<TagID, SchemaVer>        tags;
+        std::unordered_map<EdgeType, SchemaVer>     edges;
+
+        bool operator==(const SchemaVersions &rhs) const {
+            return tags == rhs.tags && edges == rhs.edges;
+        }
+    };
+
+    StatusOr<SchemaVersions> schemaVersions(meta::SchemaManager *schemaMng) const;
+
+    std::string                                 query_;
+    std::string                                 fingerprint_;
+    SpaceDescription                            space_;
+    std::unique_ptr<Sentence>                   sentence_;
+    std::unique_ptr<QueryContext>               qctx_;
+    // The variables set during the validation, e.g. the constant inputs
+    std::unordered_map<std::string, Input>      inputs_;
+    std::vector<ParameterSlot>                  slots_;
+    std::unordered_set<std::string>             params_;
+    SchemaVersions                              schemaVersions_;
+    mutable std::atomic<bool>                   executing_{false};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // CONTEXT_PREPAREDSTATEMENT_H_
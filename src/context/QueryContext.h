@@ -14,16 +14,24 @@
 #include "common/cpp/helpers.h"
 #include "common/datatypes/Value.h"
 #include "common/meta/SchemaManager.h"
+#include "context/CancellationToken.h"
 #include "context/ExecutionContext.h"
 #include "context/ValidateContext.h"
 #include "parser/SequentialSentences.h"
 #include "service/RequestContext.h"
 #include "util/IdGenerator.h"
 #include "util/ObjectPool.h"
+#include "util/QueryTrace.h"
 
 namespace nebula {
 namespace graph {
 
+class StorageRequestCoalescer;
+class VertexPropCache;
+class AdjacencyCache;
+class QueryRegistry;
+class QueryStats;
+
 namespace cpp2 {
 class ProfilingStats;
 class PlanDescription;
@@ -45,6 +53,8 @@ class PlanDescription;
 class QueryContext {
 public:
     using RequestContextPtr = std::unique_ptr<RequestContext<cpp2::ExecutionResponse>>;
+    // Run one query of a BATCH as a query of its own in the same session
+    using BatchRunner = std::function<folly::Future<cpp2::ExecutionResponse>(const std::string&)>;
 
     QueryContext();
     QueryContext(RequestContextPtr rctx,
@@ -75,6 +85,42 @@ public:
         charsetInfo_ = charsetInfo;
     }
 
+    void setStorageCoalescer(StorageRequestCoalescer* coalescer) {
+        storageCoalescer_ = coalescer;
+    }
+
+    void setVertexCache(VertexPropCache* vertexCache) {
+        vertexCache_ = vertexCache;
+    }
+
+    void setAdjacencyCache(AdjacencyCache* adjacencyCache) {
+        adjacencyCache_ = adjacencyCache;
+    }
+
+    void setQueryRegistry(QueryRegistry* queryRegistry) {
+        queryRegistry_ = queryRegistry;
+    }
+
+    void setQueryStats(QueryStats* queryStats) {
+        queryStats_ = queryStats;
+    }
+
+    void setTrace(std::shared_ptr<QueryTrace> trace) {
+        trace_ = std::move(trace);
+    }
+
+    void setQueryId(int64_t queryId) {
+        queryId_ = queryId;
+    }
+
+    void setQueueTime(int64_t queueTimeUs) {
+        queueTimeUs_ = queueTimeUs;
+    }
+
+    void setBatchRunner(BatchRunner batchRunner) {
+        batchRunner_ = std::move(batchRunner);
+    }
+
     RequestContext<cpp2::ExecutionResponse>* rctx() const {
         return rctx_.get();
     }
@@ -107,6 +153,67 @@ public:
         return charsetInfo_;
     }
 
+    // Null if the storage requests coalescing is disabled
+    StorageRequestCoalescer* storageCoalescer() const {
+        return storageCoalescer_;
+    }
+
+    // Null if the vertex props cache is disabled
+    VertexPropCache* vertexCache() const {
+        return vertexCache_;
+    }
+
+    // Null if the supernodes adjacency cache is disabled
+    AdjacencyCache* adjacencyCache() const {
+        return adjacencyCache_;
+    }
+
+    QueryRegistry* queryRegistry() const {
+        return queryRegistry_;
+    }
+
+    QueryStats* queryStats() const {
+        return queryStats_;
+    }
+
+    // Null if the query is not traced
+    QueryTrace* trace() const {
+        return trace_.get();
+    }
+
+    // The id in the query registry, -1 if it's not registered
+    int64_t queryId() const {
+        return queryId_;
+    }
+
+    // Microseconds waited in the admission queue before the execution
+    int64_t queueTime() const {
+        return queueTimeUs_;
+    }
+
+    // Empty in the queries of a batch, which could not run a batch again
+    const BatchRunner& batchRunner() const {
+        return batchRunner_;
+    }
+
+    // Count the requests sent to the storage hosts, the executors might run concurrently
+    void addStorageRpcs(int64_t rpcs) {
+        storageRpcs_.fetch_add(rpcs, std::memory_order_relaxed);
+    }
+
+    int64_t storageRpcs() const {
+        return storageRpcs_.load(std::memory_order_relaxed);
+    }
+
+    const std::shared_ptr<CancellationToken>& cancellation() const {
+        return cancellation_;
+    }
+
+    // Return the error if the query is killed or timed out
+    Status checkCancelled() const {
+        return cancellation_->check();
+    }
+
     ObjectPool* objPool() const {
         return objPool_.get();
     }
@@ -138,6 +245,17 @@ private:
     storage::GraphStorageClient*                            storageClient_{nullptr};
     meta::MetaClient*                                       metaClient_{nullptr};
     CharsetInfo*                                            charsetInfo_{nullptr};
+    StorageRequestCoalescer*                                storageCoalescer_{nullptr};
+    VertexPropCache*                                        vertexCache_{nullptr};
+    AdjacencyCache*                                         adjacencyCache_{nullptr};
+    QueryRegistry*                                          queryRegistry_{nullptr};
+    QueryStats*                                             queryStats_{nullptr};
+    int64_t                                                 queryId_{-1};
+    int64_t                                                 queueTimeUs_{0};
+    std::atomic<int64_t>                                    storageRpcs_{0};
+    BatchRunner                                             batchRunner_;
+    std::shared_ptr<QueryTrace>                             trace_;
+    std::shared_ptr<CancellationToken>                      cancellation_;
 
     // The Object Pool holds all internal generated objects.
     // e.g. expressions, plan nodes, executors
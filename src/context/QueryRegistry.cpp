@@ -0,0 +1,75 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/QueryRegistry.h"
+
+namespace nebula {
+namespace graph {
+
+int64_t QueryRegistry::add(int64_t sessionId,
+                           std::string user,
+                           std::string query,
+                           std::weak_ptr<CancellationToken> token) {
+    RunningQuery running;
+    running.id = nextId_.fetch_add(1, std::memory_order_relaxed);
+    running.sessionId = sessionId;
+    running.user = std::move(user);
+    running.query = std::move(query);
+    running.token = std::move(token);
+    auto id = running.id;
+    folly::RWSpinLock::WriteHolder holder(rwlock_);
+    queries_.emplace(id, std::move(running));
+    return id;
+}
+
+void QueryRegistry::remove(int64_t queryId) {
+    folly::RWSpinLock::WriteHolder holder(rwlock_);
+    queries_.erase(queryId);
+}
+
+StatusOr<QueryRegistry::RunningQuery> QueryRegistry::find(int64_t queryId) const {
+    folly::RWSpinLock::ReadHolder holder(rwlock_);
+    auto iter = queries_.find(queryId);
+    if (iter == queries_.end()) {
+        return Status::Error("Query `%ld' is not running", queryId);
+    }
+    return iter->second;
+}
+
+std::vector<QueryRegistry::RunningQuery> QueryRegistry::list() const {
+    std::vector<RunningQuery> queries;
+    folly::RWSpinLock::ReadHolder holder(rwlock_);
+    queries.reserve(queries_.size());
+    for (auto &query : queries_) {
+        queries.emplace_back(query.second);
+    }
+    return queries;
+}
+
+size_t QueryRegistry::size() const {
+    folly::RWSpinLock::ReadHolder holder(rwlock_);
+    return queries_.size();
+}
+
+Status QueryRegistry::kill(int64_t queryId) {
+    std::shared_ptr<CancellationToken> token;
+    {
+        folly::RWSpinLock::ReadHolder holder(rwlock_);
+        auto iter = queries_.find(queryId);
+        if (iter == queries_.end()) {
+            return Status::Error("Query `%ld' is not running", queryId);
+        }
+        token = iter->second.token.lock();
+    }
+    // Cancel out of the lock since the callback responds to the client
+    if (token != nullptr) {
+        token->cancel(Status::Error("Query `%ld' is killed", queryId));
+    }
+    return Status::OK();
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,64 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_QUERYREGISTRY_H_
+#define CONTEXT_QUERYREGISTRY_H_
+
+#include <folly/RWSpinLock.h>
+
+#include "common/base/Base.h"
+#include "common/cpp/helpers.h"
+#include "common/time/Duration.h"
+#include "context/CancellationToken.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * QueryRegistry keeps the queries running on this graph daemon,
+ * so that they could be listed by SHOW QUERIES and killed by KILL QUERY.
+ */
+class QueryRegistry final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    struct RunningQuery {
+        int64_t                             id{0};
+        int64_t                             sessionId{0};
+        std::string                         user;
+        std::string                         query;
+        time::Duration                      duration;
+        std::weak_ptr<CancellationToken>    token;
+    };
+
+    QueryRegistry() = default;
+
+    // Return the id of the registered query
+    int64_t add(int64_t sessionId,
+                std::string user,
+                std::string query,
+                std::weak_ptr<CancellationToken> token);
+
+    void remove(int64_t queryId);
+
+    StatusOr<RunningQuery> find(int64_t queryId) const;
+
+    std::vector<RunningQuery> list() const;
+
+    // Number of the running queries
+    size_t size() const;
+
+    // Cancel the query of `queryId', it stops at the next check of its cancellation token
+    Status kill(int64_t queryId);
+
+private:
+    mutable folly::RWSpinLock                           rwlock_;
+    std::unordered_map<int64_t, RunningQuery>           queries_;
+    std::atomic<int64_t>                                nextId_{1};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // CONTEXT_QUERYREGISTRY_H_
@@ -0,0 +1,248 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/QueryStats.h"
+
+#include "parser/Sentence.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+bool isIdentifierChar(char c) {
+    return std::isalnum(c) || c == '_' || c == '$';
+}
+
+// Replace the string and numeric literals with `?'
+std::string maskLiterals(const std::string &text) {
+    std::string masked;
+    masked.reserve(text.size());
+    size_t i = 0;
+    while (i < text.size()) {
+        auto c = text[i];
+        if (c == '"' || c == '\'') {
+            for (++i; i < text.size() && text[i] != c; ++i) {
+                if (text[i] == '\\') {
+                    ++i;
+                }
+            }
+            ++i;
+            masked += '?';
+        } else if (c == '`') {
+            // The quoted names are kept as they are
+            auto end = text.find('`', i + 1);
+            end = end == std::string::npos ? text.size() : end + 1;
+            masked.append(text, i, end - i);
+            i = end;
+        } else if (std::isdigit(c) && (masked.empty() || !isIdentifierChar(masked.back()))) {
+            // Including the hex, the float and the exponent
+            while (i < text.size() && (std::isalnum(text[i]) || text[i] == '.')) {
+                ++i;
+            }
+            masked += '?';
+        } else {
+            masked += c;
+            ++i;
+        }
+    }
+    return masked;
+}
+
+// The end of the list item beginning at `begin', which stops at a comma or a space
+// outside of the brackets, or at the closing bracket of the list
+size_t itemEnd(const std::string &text, size_t begin) {
+    int32_t depth = 0;
+    for (auto i = begin; i < text.size(); ++i) {
+        auto c = text[i];
+        if (c == '(' || c == '[' || c == '{') {
+            ++depth;
+        } else if (c == ')' || c == ']' || c == '}') {
+            if (depth == 0) {
+                return i;
+            }
+            --depth;
+        } else if (depth == 0 && (c == ',' || std::isspace(c))) {
+            return i;
+        }
+    }
+    return text.size();
+}
+
+// Collapse the consecutive items of the same masked literals, e.g. `?, ?, ?' to `?, ...'
+// and `(?, ?), (?, ?)' to `(?, ...), ...'
+std::string collapseLists(const std::string &text) {
+    std::string collapsed;
+    collapsed.reserve(text.size());
+    size_t i = 0;
+    while (i < text.size()) {
+        if (text[i] != '?') {
+            collapsed += text[i++];
+            continue;
+        }
+        auto end = itemEnd(text, i);
+        auto item = "?" + collapseLists(text.substr(i + 1, end - i - 1));
+        auto repeated = false;
+        while (end < text.size() && text[end] == ',') {
+            auto next = end + 1;
+            while (next < text.size() && text[next] == ' ') {
+                ++next;
+            }
+            if (next >= text.size() || text[next] != '?') {
+                break;
+            }
+            auto nextEnd = itemEnd(text, next);
+            if ("?" + collapseLists(text.substr(next + 1, nextEnd - next - 1)) != item) {
+                break;
+            }
+            repeated = true;
+            end = nextEnd;
+        }
+        collapsed += item;
+        if (repeated) {
+            collapsed += ", ...";
+        }
+        i = end;
+    }
+    return collapsed;
+}
+
+}   // namespace
+
+QueryStats::QueryStats(size_t capacity)
+    : shardCapacity_(std::max<size_t>(capacity / kNumShards, 1)) {}
+
+// static
+bool QueryStats::enabled() {
+    return FLAGS_query_stats_capacity > 0;
+}
+
+// static
+std::unique_ptr<QueryStats> QueryStats::create() {
+    return std::make_unique<QueryStats>(FLAGS_query_stats_capacity);
+}
+
+// static
+std::string QueryStats::fingerprint(const Sentence *sentence) {
+    return normalize(sentence->toString());
+}
+
+// static
+std::string QueryStats::normalize(const std::string &text) {
+    return collapseLists(maskLiterals(text));
+}
+
+void QueryStats::add(const std::string &fingerprint,
+                     int64_t latencyInUs,
+                     int64_t rows,
+                     int64_t storageRpcs,
+                     bool failed) {
+    auto &shard = shardOf(fingerprint);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    auto found = shard.entries.find(fingerprint);
+    if (found == shard.entries.end()) {
+        if (shard.entries.size() >= shardCapacity_) {
+            auto least = std::min_element(
+                shard.entries.begin(), shard.entries.end(), [](auto &a, auto &b) {
+                    return a.second.calls < b.second.calls;
+                });
+            shard.entries.erase(least);
+            evicted_.fetch_add(1, std::memory_order_relaxed);
+        }
+        found = shard.entries.emplace(fingerprint, Stats()).first;
+    }
+    auto &stats = found->second;
+    ++stats.calls;
+    if (failed) {
+        ++stats.errors;
+    }
+    stats.totalLatencyInUs += latencyInUs;
+    stats.minLatencyInUs = std::min(stats.minLatencyInUs, latencyInUs);
+    stats.maxLatencyInUs = std::max(stats.maxLatencyInUs, latencyInUs);
+    stats.rows += rows;
+    stats.storageRpcs += storageRpcs;
+    ++stats.latencies[bucketOf(latencyInUs)];
+}
+
+std::vector<QueryStats::Entry> QueryStats::list() const {
+    std::vector<Entry> entries;
+    for (auto &shard : shards_) {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        for (auto &kv : shard.entries) {
+            auto &stats = kv.second;
+            Entry entry;
+            entry.fingerprint = kv.first;
+            entry.calls = stats.calls;
+            entry.errors = stats.errors;
+            entry.totalLatencyInUs = stats.totalLatencyInUs;
+            entry.minLatencyInUs = stats.minLatencyInUs;
+            entry.maxLatencyInUs = stats.maxLatencyInUs;
+            entry.p99LatencyInUs = percentile(stats, 99);
+            entry.rows = stats.rows;
+            entry.storageRpcs = stats.storageRpcs;
+            entries.emplace_back(std::move(entry));
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+        return a.totalLatencyInUs > b.totalLatencyInUs;
+    });
+    return entries;
+}
+
+void QueryStats::reset() {
+    for (auto &shard : shards_) {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        shard.entries.clear();
+    }
+}
+
+size_t QueryStats::size() const {
+    size_t size = 0;
+    for (auto &shard : shards_) {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        size += shard.entries.size();
+    }
+    return size;
+}
+
+// static
+size_t QueryStats::bucketOf(int64_t latencyInUs) {
+    if (latencyInUs < 4) {
+        return std::max<int64_t>(latencyInUs, 0);
+    }
+    // The highest bit and the two bits following it
+    auto high = 63 - __builtin_clzll(latencyInUs);
+    auto sub = (latencyInUs >> (high - 2)) & 3;
+    return 4 * (high - 1) + sub;
+}
+
+// static
+int64_t QueryStats::upperBoundOf(size_t bucket) {
+    if (bucket < 4) {
+        return bucket;
+    }
+    auto high = bucket / 4 + 1;
+    uint64_t sub = bucket % 4;
+    // No overflow for the last bucket, whose upper bound is the max of int64
+    return static_cast<int64_t>(((5 + sub) << (high - 2)) - 1);
+}
+
+// static
+int64_t QueryStats::percentile(const Stats &stats, uint32_t percent) {
+    auto rank = (stats.calls * percent + 99) / 100;
+    uint64_t count = 0;
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        count += stats.latencies[i];
+        if (count >= rank) {
+            return std::min(upperBoundOf(i), stats.maxLatencyInUs);
+        }
+    }
+    return stats.maxLatencyInUs;
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,111 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_QUERYSTATS_H_
+#define CONTEXT_QUERYSTATS_H_
+
+#include "common/base/Base.h"
+#include "common/cpp/helpers.h"
+
+namespace nebula {
+namespace graph {
+
+class Sentence;
+
+/**
+ * QueryStats aggregates the statistics of the queries by their fingerprints, i.e. the
+ * queries of the same shape but with different literals share one entry. It's listed by
+ * SHOW QUERY STATS and `GET /query_stats' to find out which shapes of queries to optimize.
+ *
+ * The entries are kept in shards each guarded by its own lock. At most `capacity' entries
+ * are kept, the one called the least in its shard is evicted for a new fingerprint.
+ */
+class QueryStats final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    struct Entry {
+        std::string         fingerprint;
+        uint64_t            calls{0};
+        uint64_t            errors{0};
+        int64_t             totalLatencyInUs{0};
+        int64_t             minLatencyInUs{0};
+        int64_t             maxLatencyInUs{0};
+        // Approximated by the upper bound of the bucket, within 25% of the real one
+        int64_t             p99LatencyInUs{0};
+        int64_t             rows{0};
+        int64_t             storageRpcs{0};
+    };
+
+    explicit QueryStats(size_t capacity);
+
+    static bool enabled();
+
+    static std::unique_ptr<QueryStats> create();
+
+    // The text of `sentence' with the literals replaced by `?' and the lists of them
+    // collapsed, e.g. both `GO FROM 1, 2 OVER e WHERE e.p > 10' and `GO FROM 3, 4, 5 OVER e
+    // WHERE e.p > 20' are of the fingerprint `GO FROM ?, ... OVER e WHERE e.p > ?'.
+    static std::string fingerprint(const Sentence *sentence);
+
+    // Mask and collapse the literals in the text of a sentence
+    static std::string normalize(const std::string &text);
+
+    void add(const std::string &fingerprint,
+             int64_t latencyInUs,
+             int64_t rows,
+             int64_t storageRpcs,
+             bool failed);
+
+    // All the entries in descending order of the total latency
+    std::vector<Entry> list() const;
+
+    void reset();
+
+    size_t size() const;
+
+    uint64_t evicted() const {
+        return evicted_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t kNumShards = 16;
+    // Four buckets for each power of two, enough for all the non-negative int64
+    static constexpr size_t kNumBuckets = 248;
+
+    struct Stats {
+        uint64_t                                calls{0};
+        uint64_t                                errors{0};
+        int64_t                                 totalLatencyInUs{0};
+        int64_t                                 minLatencyInUs{std::numeric_limits<int64_t>::max()};
+        int64_t                                 maxLatencyInUs{0};
+        int64_t                                 rows{0};
+        int64_t                                 storageRpcs{0};
+        std::array<uint32_t, kNumBuckets>       latencies{};
+    };
+
+    struct Shard {
+        mutable std::mutex                      lock;
+        std::unordered_map<std::string, Stats>  entries;
+    };
+
+    static size_t bucketOf(int64_t latencyInUs);
+
+    static int64_t upperBoundOf(size_t bucket);
+
+    static int64_t percentile(const Stats &stats, uint32_t percent);
+
+    Shard &shardOf(const std::string &fingerprint) {
+        return shards_[std::hash<std::string>()(fingerprint) % kNumShards];
+    }
+
+    const size_t                                shardCapacity_;
+    std::array<Shard, kNumShards>               shards_;
+    std::atomic<uint64_t>                       evicted_{0};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // CONTEXT_QUERYSTATS_H_
@@ -25,6 +25,13 @@ struct SpaceDescription {
     GraphSpaceID id;
 };
 
+// The vid of the constant input `var' at `row' is bound to the parameter `name' on execution
+struct ParameterSlot {
+    std::string var;
+    size_t row;
+    std::string name;
+};
+
 class ValidateContext final {
 public:
     ValidateContext() {
@@ -92,6 +99,31 @@ public:
         return find->second;
     }
 
+    // The `$param' placeholders are only allowed when validating a prepared statement
+    void setParameterized(bool parameterized) {
+        parameterized_ = parameterized;
+    }
+
+    bool parameterized() const {
+        return parameterized_;
+    }
+
+    void addParameter(const std::string &name) {
+        params_.emplace(name);
+    }
+
+    const std::unordered_set<std::string>& parameters() const {
+        return params_;
+    }
+
+    void addParameterSlot(std::string var, size_t row, std::string name) {
+        paramSlots_.emplace_back(ParameterSlot{std::move(var), row, std::move(name)});
+    }
+
+    const std::vector<ParameterSlot>& parameterSlots() const {
+        return paramSlots_;
+    }
+
 private:
     // spaces_ is the trace of space switch
     std::vector<SpaceDescription>                       spaces_;
@@ -103,6 +135,9 @@ private:
           std::shared_ptr<const meta::NebulaSchemaProvider>>;
     Schemas                                             schemas_;
     std::unordered_set<std::string>                     createSpaces_;
+    bool                                                parameterized_{false};
+    std::unordered_set<std::string>                     params_;
+    std::vector<ParameterSlot>                          paramSlots_;
 };
 }  // namespace graph
 }  // namespace nebula
@@ -0,0 +1,84 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/QueryStats.h"
+
+#include <gtest/gtest.h>
+#include "common/base/Base.h"
+#include "parser/GQLParser.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(QueryStats, Normalize) {
+    EXPECT_EQ("GO FROM ? OVER e", QueryStats::normalize("GO FROM 1 OVER e"));
+    EXPECT_EQ("GO FROM ?, ... OVER e WHERE e.p > ?",
+              QueryStats::normalize("GO FROM 1,2,3 OVER e WHERE e.p > 10"));
+    EXPECT_EQ("GO FROM ?, ... OVER e",
+              QueryStats::normalize("GO FROM \"a\", \"b\\\"c\" OVER e"));
+    EXPECT_EQ("YIELD ? + ?, e1.age, $-.id, `1a`",
+              QueryStats::normalize("YIELD 3.14 + 0x1F, e1.age, $-.id, `1a`"));
+    EXPECT_EQ("INSERT VERTEX person(name, age) VALUES ?:(?, ...), ...",
+              QueryStats::normalize(
+                  "INSERT VERTEX person(name, age) VALUES 1:(\"Tom\", 10), 2:(\"Jerry\", 9)"));
+    // Only the items of literals are collapsed
+    EXPECT_EQ("YIELD [?, ...], [?, ...]", QueryStats::normalize("YIELD [1, 2], [3, 4, 5]"));
+    EXPECT_EQ("YIELD ?, [?]", QueryStats::normalize("YIELD 1, [2]"));
+}
+
+TEST(QueryStats, Fingerprint) {
+    auto fingerprintOf = [](const std::string &query) {
+        auto result = GQLParser().parse(query);
+        CHECK(result.ok()) << result.status();
+        return QueryStats::fingerprint(result.value().get());
+    };
+    EXPECT_EQ(fingerprintOf("GO FROM 1 OVER like WHERE like.likeness > 90"),
+              fingerprintOf("go   from 2 over like where like.likeness > 80"));
+    EXPECT_EQ(fingerprintOf("GO FROM 1, 2 OVER like"),
+              fingerprintOf("GO FROM 3, 4, 5 OVER like"));
+    EXPECT_NE(fingerprintOf("GO FROM 1 OVER like"),
+              fingerprintOf("GO FROM 1 OVER serve"));
+}
+
+TEST(QueryStats, Aggregate) {
+    QueryStats stats(1000);
+    for (auto i = 0; i < 99; ++i) {
+        stats.add("GO FROM ? OVER e", 100, 10, 2, false);
+    }
+    stats.add("GO FROM ? OVER e", 100000, 0, 1, true);
+    stats.add("YIELD ?", 10, 1, 0, false);
+
+    auto entries = stats.list();
+    ASSERT_EQ(2, entries.size());
+    auto &go = entries[0];
+    EXPECT_EQ("GO FROM ? OVER e", go.fingerprint);
+    EXPECT_EQ(100, go.calls);
+    EXPECT_EQ(1, go.errors);
+    EXPECT_EQ(99 * 100 + 100000, go.totalLatencyInUs);
+    EXPECT_EQ(100, go.minLatencyInUs);
+    EXPECT_EQ(100000, go.maxLatencyInUs);
+    EXPECT_LE(100, go.p99LatencyInUs);
+    EXPECT_GE(125, go.p99LatencyInUs);
+    EXPECT_EQ(990, go.rows);
+    EXPECT_EQ(199, go.storageRpcs);
+    EXPECT_EQ("YIELD ?", entries[1].fingerprint);
+    EXPECT_EQ(10, entries[1].p99LatencyInUs);
+
+    stats.reset();
+    EXPECT_EQ(0, stats.size());
+}
+
+TEST(QueryStats, Evict) {
+    QueryStats stats(16);
+    for (auto i = 0; i < 100; ++i) {
+        stats.add(folly::stringPrintf("YIELD %d", i), 10, 1, 0, false);
+    }
+    EXPECT_GE(16, stats.size());
+    EXPECT_EQ(100, stats.size() + stats.evicted());
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -16,6 +16,8 @@
 #include <thrift/lib/cpp2/server/ThriftServer.h>
 #include "service/GraphService.h"
 #include "service/GraphFlags.h"
+#include "service/MetricsHandler.h"
+#include "service/QueryStatsHandler.h"
 #include "common/webservice/WebService.h"
 
 using nebula::Status;
@@ -93,13 +95,6 @@ int main(int argc, char *argv[]) {
         localIP = std::move(result).value();
     }
 
-    LOG(INFO) << "Starting Graph HTTP Service";
-    auto webSvc = std::make_unique<nebula::WebService>();
-    status = webSvc->start();
-    if (!status.ok()) {
-        return EXIT_FAILURE;
-    }
-
     if (FLAGS_num_netio_threads == 0) {
         FLAGS_num_netio_threads = std::thread::hardware_concurrency();
     }
@@ -131,6 +126,21 @@ int main(int argc, char *argv[]) {
         return EXIT_FAILURE;
     }
 
+    // Started after the graph service is ready, whose states are served
+    LOG(INFO) << "Starting Graph HTTP Service";
+    auto webSvc = std::make_unique<nebula::WebService>();
+    webSvc->router().get("/metrics").handler([](nebula::web::PathParams &&) {
+        return new nebula::graph::MetricsHandler();
+    });
+    auto *queryStats = interface->queryStats();
+    webSvc->router().get("/query_stats").handler([queryStats](nebula::web::PathParams &&) {
+        return new nebula::graph::QueryStatsHandler(queryStats);
+    });
+    status = webSvc->start();
+    if (!status.ok()) {
+        return EXIT_FAILURE;
+    }
+
     gServer->setInterface(std::move(interface));
     gServer->setAddress(localIP, FLAGS_port);
     gServer->setReusePort(FLAGS_reuse_port);
@@ -0,0 +1,118 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/ExecStats.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+size_t propsBytes(const std::unordered_map<std::string, Value> &props) {
+    size_t bytes = 0;
+    for (auto &kv : props) {
+        bytes += kv.first.size() + ExecStats::estimateBytes(kv.second);
+    }
+    return bytes;
+}
+
+size_t vertexBytes(const Vertex &vertex) {
+    size_t bytes = sizeof(Vertex);
+    for (auto &tag : vertex.tags) {
+        bytes += sizeof(Tag) + tag.name.size() + propsBytes(tag.props);
+    }
+    return bytes;
+}
+
+}   // namespace
+
+std::unordered_map<std::string, std::string> ExecStats::toMap() const {
+    std::unordered_map<std::string, std::string> stats;
+    stats.emplace("rows_in", folly::to<std::string>(rowsIn));
+    stats.emplace("result_bytes", folly::to<std::string>(resultBytes));
+    stats.emplace("queue_duration_in_us", folly::to<std::string>(queueTimeInUs));
+    if (hashTableSize > 0) {
+        stats.emplace("hash_table_size", folly::to<std::string>(hashTableSize));
+    }
+    if (iterations > 0) {
+        stats.emplace("iterations", folly::to<std::string>(iterations));
+    }
+    if (!storageHosts.empty()) {
+        stats.emplace("storage_resp_bytes", folly::to<std::string>(storageRespBytes));
+    }
+    for (auto &host : storageHosts) {
+        auto &s = host.second;
+        stats.emplace(folly::stringPrintf("storage %s", host.first.c_str()),
+                      folly::stringPrintf("calls: %lu, latency_in_us: %lu, e2e_latency_in_us: %lu",
+                                          s.calls,
+                                          s.latencyInUs,
+                                          s.e2eLatencyInUs));
+    }
+    for (auto &part : partWrites) {
+        auto &s = part.second;
+        stats.emplace(folly::stringPrintf("part %d", part.first),
+                      folly::stringPrintf("rows: %lu, chunks: %lu, retries: %lu, failed: %lu",
+                                          s.rows,
+                                          s.chunks,
+                                          s.retries,
+                                          s.failed));
+    }
+    return stats;
+}
+
+// static
+size_t ExecStats::estimateBytes(const Value &value) {
+    size_t bytes = sizeof(Value);
+    switch (value.type()) {
+        case Value::Type::STRING:
+            return bytes + value.getStr().size();
+        case Value::Type::LIST:
+            for (auto &v : value.getList().values) {
+                bytes += estimateBytes(v);
+            }
+            return bytes;
+        case Value::Type::SET:
+            for (auto &v : value.getSet().values) {
+                bytes += estimateBytes(v);
+            }
+            return bytes;
+        case Value::Type::MAP:
+            return bytes + propsBytes(value.getMap().kvs);
+        case Value::Type::DATASET: {
+            auto &ds = value.getDataSet();
+            for (auto &name : ds.colNames) {
+                bytes += name.size();
+            }
+            for (auto &row : ds.rows) {
+                bytes += sizeof(Row);
+                for (auto &v : row.values) {
+                    bytes += estimateBytes(v);
+                }
+            }
+            return bytes;
+        }
+        case Value::Type::VERTEX:
+            return bytes + vertexBytes(value.getVertex());
+        case Value::Type::EDGE: {
+            auto &edge = value.getEdge();
+            return bytes + sizeof(Edge) + edge.name.size() + propsBytes(edge.props);
+        }
+        case Value::Type::PATH: {
+            auto &path = value.getPath();
+            bytes += vertexBytes(path.src);
+            for (auto &step : path.steps) {
+                bytes += sizeof(Step) + vertexBytes(step.dst) + step.name.size() +
+                         propsBytes(step.props);
+            }
+            return bytes;
+        }
+        default:
+            return bytes;
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
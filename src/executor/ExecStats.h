@@ -0,0 +1,78 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_EXECSTATS_H_
+#define EXECUTOR_EXECSTATS_H_
+
+#include "common/base/Base.h"
+#include "common/datatypes/Value.h"
+#include "common/thrift/ThriftTypes.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * The extra profiling data of an executor besides the rows and durations, which are
+ * reported in the `other_stats' of PROFILE.
+ *
+ * Only plain counters are updated during the execution, the ones costing more to collect,
+ * e.g. the bytes of the result, are only collected when the query is profiled.
+ */
+struct ExecStats {
+    struct StorageHost {
+        uint64_t            calls{0};
+        uint64_t            latencyInUs{0};
+        uint64_t            e2eLatencyInUs{0};
+    };
+
+    // The chunks written to a partition
+    struct PartWrite {
+        uint64_t            rows{0};
+        uint64_t            chunks{0};
+        uint64_t            retries{0};
+        uint64_t            failed{0};
+    };
+
+    void reset() {
+        rowsIn = 0;
+        resultBytes = 0;
+        queueTimeInUs = 0;
+        hashTableSize = 0;
+        storageRespBytes = 0;
+        storageHosts.clear();
+        partWrites.clear();
+    }
+
+    // Add the latencies of a storage request to `host'
+    void addStorageLatency(const std::string &host, int32_t latency, int32_t e2eLatency) {
+        auto &stats = storageHosts[host];
+        stats.calls++;
+        stats.latencyInUs += latency;
+        stats.e2eLatencyInUs += e2eLatency;
+    }
+
+    std::unordered_map<std::string, std::string> toMap() const;
+
+    // Estimated bytes of memory held by the value
+    static size_t estimateBytes(const Value &value);
+
+    uint64_t                                        rowsIn{0};
+    // Max estimated bytes of the results in all iterations of the executor
+    uint64_t                                        resultBytes{0};
+    uint64_t                                        queueTimeInUs{0};
+    // Number of the entries in the hash table of Join/Aggregate/Dedup
+    uint64_t                                        hashTableSize{0};
+    // Number of iterations of the loop so far, it's never reset
+    uint64_t                                        iterations{0};
+    uint64_t                                        storageRespBytes{0};
+    std::unordered_map<std::string, StorageHost>    storageHosts;
+    std::unordered_map<PartitionID, PartWrite>      partWrites;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_EXECSTATS_H_
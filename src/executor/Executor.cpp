@@ -14,6 +14,7 @@
 #include "context/QueryContext.h"
 #include "executor/ExecutionError.h"
 #include "executor/admin/BalanceExecutor.h"
+#include "executor/admin/BatchExecutor.h"
 #include "executor/admin/BalanceLeadersExecutor.h"
 #include "executor/admin/ChangePasswordExecutor.h"
 #include "executor/admin/CharsetExecutor.h"
@@ -27,6 +28,8 @@
 #include "executor/admin/PartExecutor.h"
 #include "executor/admin/RevokeRoleExecutor.h"
 #include "executor/admin/ShowBalanceExecutor.h"
+#include "executor/admin/QueriesExecutor.h"
+#include "executor/admin/PreparedStatementExecutor.h"
 #include "executor/admin/ShowHostsExecutor.h"
 #include "executor/admin/SnapshotExecutor.h"
 #include "executor/admin/SpaceExecutor.h"
@@ -44,6 +47,7 @@
 #include "executor/mutate/InsertExecutor.h"
 #include "executor/mutate/UpdateExecutor.h"
 #include "executor/query/AggregateExecutor.h"
+#include "executor/query/CursorExecutor.h"
 #include "executor/query/DataCollectExecutor.h"
 #include "executor/query/DataJoinExecutor.h"
 #include "executor/query/DedupExecutor.h"
@@ -564,6 +568,76 @@ Executor *Executor::makeExecutor(const PlanNode *node,
             exec->dependsOn(input);
             break;
         }
+        case PlanNode::Kind::kShowQueries: {
+            auto showQueries = asNode<ShowQueries>(node);
+            auto input = makeExecutor(showQueries->dep(), qctx, visited);
+            exec = new ShowQueriesExecutor(showQueries, qctx);
+            exec->dependsOn(input);
+            break;
+        }
+        case PlanNode::Kind::kKillQuery: {
+            auto killQuery = asNode<KillQuery>(node);
+            auto input = makeExecutor(killQuery->dep(), qctx, visited);
+            exec = new KillQueryExecutor(killQuery, qctx);
+            exec->dependsOn(input);
+            break;
+        }
+        case PlanNode::Kind::kShowQueryStats: {
+            auto showQueryStats = asNode<ShowQueryStats>(node);
+            auto input = makeExecutor(showQueryStats->dep(), qctx, visited);
+            exec = new ShowQueryStatsExecutor(showQueryStats, qctx);
+            exec->dependsOn(input);
+            break;
+        }
+        case PlanNode::Kind::kResetQueryStats: {
+            auto resetQueryStats = asNode<ResetQueryStats>(node);
+            auto input = makeExecutor(resetQueryStats->dep(), qctx, visited);
+            exec = new ResetQueryStatsExecutor(resetQueryStats, qctx);
+            exec->dependsOn(input);
+            break;
+        }
+        case PlanNode::Kind::kPrepare: {
+            auto prepare = asNode<Prepare>(node);
+            auto input = makeExecutor(prepare->dep(), qctx, visited);
+            exec = new PrepareExecutor(prepare, qctx);
+            exec->dependsOn(input);
+            break;
+        }
+        case PlanNode::Kind::kDeallocate: {
+            auto deallocate = asNode<Deallocate>(node);
+            auto input = makeExecutor(deallocate->dep(), qctx, visited);
+            exec = new DeallocateExecutor(deallocate, qctx);
+            exec->dependsOn(input);
+            break;
+        }
+        case PlanNode::Kind::kBatch: {
+            auto batch = asNode<Batch>(node);
+            auto input = makeExecutor(batch->dep(), qctx, visited);
+            exec = new BatchExecutor(batch, qctx);
+            exec->dependsOn(input);
+            break;
+        }
+        case PlanNode::Kind::kDeclareCursor: {
+            auto declare = asNode<DeclareCursor>(node);
+            auto dep = makeExecutor(declare->dep(), qctx, visited);
+            exec = new DeclareCursorExecutor(declare, qctx);
+            exec->dependsOn(dep);
+            break;
+        }
+        case PlanNode::Kind::kFetchCursor: {
+            auto fetch = asNode<FetchCursor>(node);
+            auto input = makeExecutor(fetch->dep(), qctx, visited);
+            exec = new FetchCursorExecutor(fetch, qctx);
+            exec->dependsOn(input);
+            break;
+        }
+        case PlanNode::Kind::kCloseCursor: {
+            auto close = asNode<CloseCursor>(node);
+            auto input = makeExecutor(close->dep(), qctx, visited);
+            exec = new CloseCursorExecutor(close, qctx);
+            exec->dependsOn(input);
+            break;
+        }
         case PlanNode::Kind::kUnknown:
         default:
             LOG(FATAL) << "Unknown plan node kind " << static_cast<int32_t>(node->kind());
@@ -595,18 +669,45 @@ Status Executor::open() {
     numRows_ = 0;
     execTime_ = 0;
     totalDuration_.reset();
+    stats_.reset();
+    if (profiling()) {
+        // Queued since the last dependency was done
+        std::chrono::steady_clock::time_point readyAt;
+        for (auto *dep : depends_) {
+            stats_.rowsIn += dep->numRows_;
+            readyAt = std::max(readyAt, dep->finishedAt_);
+        }
+        if (readyAt.time_since_epoch().count() > 0) {
+            auto queued = std::chrono::steady_clock::now() - readyAt;
+            stats_.queueTimeInUs =
+                std::chrono::duration_cast<std::chrono::microseconds>(queued).count();
+        }
+    }
     return Status::OK();
 }
 
 Status Executor::close() {
+    if (!profiling()) {
+        return Status::OK();
+    }
+    finishedAt_ = std::chrono::steady_clock::now();
     cpp2::ProfilingStats stats;
     stats.set_total_duration_in_us(totalDuration_.elapsedInUSec());
     stats.set_rows(numRows_);
     stats.set_exec_duration_in_us(execTime_);
+    decltype(stats.other_stats) otherStats;
+    for (auto &kv : stats_.toMap()) {
+        otherStats.emplace(kv.first, std::move(kv.second));
+    }
+    stats.set_other_stats(std::move(otherStats));
     qctx()->addProfilingData(node_->id(), std::move(stats));
     return Status::OK();
 }
 
+bool Executor::profiling() const {
+    return qctx_->planDescription() != nullptr;
+}
+
 folly::Future<Status> Executor::start(Status status) const {
     return folly::makeFuture(std::move(status)).via(runner());
 }
@@ -617,6 +718,10 @@ folly::Future<Status> Executor::error(Status status) const {
 
 Status Executor::finish(Result &&result) {
     numRows_ = result.size();
+    if (profiling() && result.valuePtr() != nullptr) {
+        stats_.resultBytes = std::max<uint64_t>(stats_.resultBytes,
+                                                ExecStats::estimateBytes(result.value()));
+    }
     ectx_->setResult(node()->varName(), std::move(result));
     return Status::OK();
 }
@@ -625,6 +730,13 @@ Status Executor::finish(Value &&value) {
     return finish(ResultBuilder().value(std::move(value)).iter(Iterator::Kind::kDefault).finish());
 }
 
+Status Executor::checkCancelled(size_t row) const {
+    if (row % kCancelCheckRows != 0) {
+        return Status::OK();
+    }
+    return qctx_->checkCancelled();
+}
+
 folly::Executor *Executor::runner() const {
     if (!qctx() || !qctx()->rctx() || !qctx()->rctx()->runner()) {
         // This is just for test
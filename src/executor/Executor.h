@@ -19,6 +19,7 @@
 #include "common/datatypes/Value.h"
 #include "common/time/Duration.h"
 #include "context/ExecutionContext.h"
+#include "executor/ExecStats.h"
 #include "util/ScopedTimer.h"
 
 namespace nebula {
@@ -96,6 +97,15 @@ protected:
 
     folly::Executor *runner() const;
 
+    // Check whether the query is killed or timed out once per `kCancelCheckRows' rows
+    // in the long loops, `row' is the sequence number of the current row.
+    Status checkCancelled(size_t row) const;
+
+    static constexpr size_t kCancelCheckRows = 1024;
+
+    // Whether the query is profiled, the costly stats are only collected then
+    bool profiling() const;
+
     // Store the result of this executor to execution context
     Status finish(Result &&result);
     // Store the default result which not used for later executor
@@ -121,6 +131,9 @@ protected:
     uint64_t numRows_{0};
     uint64_t execTime_{0};
     time::Duration totalDuration_;
+    ExecStats stats_;
+    // When the last execution of this executor was done, only set if profiling
+    std::chrono::steady_clock::time_point finishedAt_;
 };
 
 }   // namespace graph
@@ -0,0 +1,255 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/QueryStorageExecutor.h"
+
+#include <numeric>
+#include <set>
+
+#include <folly/futures/helpers.h>
+
+#include "context/QueryContext.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+// The interval before the n-th retry of a chunk is n times of it
+constexpr int64_t kChunkRetryIntervalMs = 100;
+
+// Only a chunk rejected by a stale leader is sure not to be applied and worth retrying,
+// the one failed by RPC might have been written already, which is not idempotent for
+// the inserts without overwriting.
+bool retriable(const storage::StorageRpcResponse<storage::cpp2::ExecResponse> &resp) {
+    for (auto &part : resp.failedParts()) {
+        if (part.second != storage::cpp2::ErrorCode::E_LEADER_CHANGED) {
+            return false;
+        }
+    }
+    return !resp.failedParts().empty();
+}
+
+}   // namespace
+
+StatusOr<std::vector<std::vector<Row>>> QueryStorageExecutor::sliceByParts(
+    GraphSpaceID space,
+    std::vector<Row> &rows,
+    size_t vidIdx) const {
+    std::vector<std::vector<Row>> slices;
+    if (FLAGS_storage_response_slices <= 1 || rows.size() <= 1) {
+        return slices;
+    }
+    auto *metaClient = qctx()->getMetaClient();
+    auto numParts = metaClient->partsNum(space);
+    NG_RETURN_IF_ERROR(numParts);
+    auto numSlices = std::min(FLAGS_storage_response_slices, numParts.value());
+    if (numSlices <= 1) {
+        return slices;
+    }
+
+    // The rows of one partition are always in the same slice,
+    // so the request of each slice only goes to a part of the storage hosts
+    slices.resize(numSlices);
+    for (auto &row : rows) {
+        auto &vid = row.values[vidIdx];
+        DCHECK(vid.isStr());
+        auto part = vid.isStr() ? metaClient->partId(numParts.value(), vid.getStr()) : 1;
+        slices[(part - 1) % numSlices].emplace_back(std::move(row));
+    }
+    rows.clear();
+    slices.erase(std::remove_if(slices.begin(),
+                                slices.end(),
+                                [](const auto &slice) { return slice.empty(); }),
+                 slices.end());
+    VLOG(1) << name_ << " splits the request into " << slices.size() << " slices";
+    return slices;
+}
+
+StatusOr<Result::State> QueryStorageExecutor::coalescedCompleteness(
+    const std::unordered_map<PartitionID, storage::cpp2::ErrorCode> &failedParts,
+    GraphSpaceID space,
+    const std::vector<Row> &rows,
+    size_t vidIdx) const {
+    if (failedParts.empty()) {
+        return Result::State::kSuccess;
+    }
+    auto *metaClient = qctx()->getMetaClient();
+    auto numParts = metaClient->partsNum(space);
+    NG_RETURN_IF_ERROR(numParts);
+    std::unordered_set<PartitionID> parts;
+    size_t numFailed = 0;
+    for (auto &row : rows) {
+        auto &vid = row.values[vidIdx];
+        if (!vid.isStr()) {
+            continue;
+        }
+        auto part = metaClient->partId(numParts.value(), vid.getStr());
+        if (!parts.emplace(part).second) {
+            continue;
+        }
+        auto failed = failedParts.find(part);
+        if (failed != failedParts.end()) {
+            LOG(ERROR) << name_ << " failed, error "
+                       << storage::cpp2::_ErrorCode_VALUES_TO_NAMES.at(failed->second)
+                       << ", part " << part;
+            numFailed++;
+        }
+    }
+    if (numFailed == 0) {
+        return Result::State::kSuccess;
+    }
+    if (numFailed == parts.size()) {
+        LOG(ERROR) << "Request to storage failed in executor `" << name_ << "'";
+        return Status::Error("Request to storage failed in executor.");
+    }
+    return Result::State::kPartialSuccess;
+}
+
+StatusOr<std::vector<QueryStorageExecutor::WriteChunk>> QueryStorageExecutor::chunkByParts(
+    GraphSpaceID space,
+    size_t size,
+    std::function<const VertexID &(size_t)> vidOf) const {
+    std::vector<WriteChunk> chunks;
+    auto chunkSize = static_cast<size_t>(std::max(FLAGS_write_chunk_size, 0));
+    if (chunkSize == 0 || size <= chunkSize) {
+        return chunks;
+    }
+    auto *metaClient = qctx()->getMetaClient();
+    auto numParts = metaClient->partsNum(space);
+    NG_RETURN_IF_ERROR(numParts);
+
+    // The last chunk of each partition, which is being filled
+    std::unordered_map<PartitionID, size_t> filling;
+    for (size_t i = 0; i < size; ++i) {
+        auto part = metaClient->partId(numParts.value(), vidOf(i));
+        auto found = filling.find(part);
+        if (found == filling.end() || chunks[found->second].indexes.size() >= chunkSize) {
+            filling[part] = chunks.size();
+            chunks.emplace_back(WriteChunk{part, {}});
+        }
+        chunks[filling[part]].indexes.emplace_back(i);
+    }
+    VLOG(1) << name_ << " splits the write into " << chunks.size() << " chunks";
+    return chunks;
+}
+
+folly::Future<Status> QueryStorageExecutor::writeChunks(std::vector<WriteChunk> chunks,
+                                                        ChunkWriter write) {
+    for (auto &chunk : chunks) {
+        auto &stats = stats_.partWrites[chunk.part];
+        stats.rows += chunk.indexes.size();
+        stats.chunks++;
+    }
+    // The responses of the chunks are handled concurrently
+    auto lock = std::make_shared<std::mutex>();
+    auto shared = std::make_shared<const std::vector<WriteChunk>>(std::move(chunks));
+    std::vector<size_t> ids(shared->size());
+    std::iota(ids.begin(), ids.end(), 0);
+    auto concurrency = static_cast<size_t>(std::max(FLAGS_write_chunk_concurrency, 1));
+    auto futures = folly::window(
+        std::move(ids),
+        [this, lock, shared, write](size_t i) {
+            return writeChunk(lock, (*shared)[i], write, FLAGS_write_chunk_retries);
+        },
+        concurrency);
+    return folly::collectAll(futures).via(runner()).then(
+        [this, shared](std::vector<folly::Try<Status>> &&results) {
+            SCOPED_TIMER(&execTime_);
+            std::set<PartitionID> parts;
+            std::set<PartitionID> failed;
+            size_t numFailed = 0;
+            Status error;
+            for (size_t i = 0; i < results.size(); ++i) {
+                auto status = results[i].hasException()
+                                  ? Status::Error("%s", results[i].exception().what().c_str())
+                                  : results[i].value();
+                parts.emplace((*shared)[i].part);
+                if (!status.ok()) {
+                    failed.emplace((*shared)[i].part);
+                    numFailed++;
+                    error = std::move(status);
+                }
+            }
+            if (failed.empty()) {
+                return Status::OK();
+            }
+            auto msg = folly::stringPrintf(
+                "Failed to write %lu of %lu chunks, of the partitions %s: %s",
+                numFailed,
+                results.size(),
+                folly::join(", ", failed).c_str(),
+                error.toString().c_str());
+            if (numFailed == results.size()) {
+                return Status::Error("%s", msg.c_str());
+            }
+            // The chunks written are kept, only the failed partitions need to be written again,
+            // so the client is told how much of the write is done
+            DataSet ds({"WrittenChunks", "FailedChunks", "WrittenParts", "FailedParts", "Error"});
+            ds.emplace_back(Row({static_cast<int64_t>(results.size() - numFailed),
+                                 static_cast<int64_t>(numFailed),
+                                 static_cast<int64_t>(parts.size() - failed.size()),
+                                 static_cast<int64_t>(failed.size()),
+                                 std::move(msg)}));
+            return finish(ResultBuilder()
+                              .value(Value(std::move(ds)))
+                              .iter(Iterator::Kind::kDefault)
+                              .state(Result::State::kPartialSuccess)
+                              .finish());
+        });
+}
+
+folly::Future<Status> QueryStorageExecutor::writeChunk(std::shared_ptr<std::mutex> lock,
+                                                       const WriteChunk &chunk,
+                                                       ChunkWriter write,
+                                                       int32_t retries) {
+    // Stop sending the rest chunks once the query is cancelled
+    auto cancelled = qctx()->checkCancelled();
+    if (!cancelled.ok()) {
+        return cancelled;
+    }
+    return write(chunk).via(runner()).then(
+        [this, lock, &chunk, write, retries](folly::Try<WriteResp> &&resp)
+            -> folly::Future<Status> {
+            Status status;
+            {
+                std::lock_guard<std::mutex> g(*lock);
+                SCOPED_TIMER(&execTime_);
+                bool retry = false;
+                if (resp.hasException()) {
+                    status = Status::Error("%s", resp.exception().what().c_str());
+                } else {
+                    addStorageMetrics(resp.value());
+                    auto result = handleCompleteness(resp.value(), true);
+                    if (result.ok()) {
+                        return Status::OK();
+                    }
+                    status = result.status();
+                    retry = retries > 0 && retriable(resp.value());
+                }
+                auto &stats = stats_.partWrites[chunk.part];
+                if (!retry) {
+                    stats.failed++;
+                    LOG(ERROR) << name_ << " failed to write a chunk of part " << chunk.part
+                               << ": " << status;
+                    return status;
+                }
+                stats.retries++;
+            }
+            auto attempt = FLAGS_write_chunk_retries - retries + 1;
+            LOG(WARNING) << name_ << " retries a chunk of part " << chunk.part << " in "
+                         << kChunkRetryIntervalMs * attempt << "ms: " << status;
+            return folly::futures::sleep(std::chrono::milliseconds(kChunkRetryIntervalMs * attempt))
+                .via(runner())
+                .then([this, lock, &chunk, write, retries]() {
+                    return writeChunk(lock, chunk, write, retries - 1);
+                });
+        });
+}
+
+}   // namespace graph
+}   // namespace nebula
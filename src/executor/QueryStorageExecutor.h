@@ -7,8 +7,14 @@
 #ifndef EXECUTOR_QUERYSTORAGEEXECUTOR_H_
 #define EXECUTOR_QUERYSTORAGEEXECUTOR_H_
 
+#include <mutex>
+
+#include <thrift/lib/cpp2/protocol/CompactProtocol.h>
+
 #include "executor/Executor.h"
 #include "common/clients/storage/StorageClientBase.h"
+#include "util/GraphMetrics.h"
+#include "util/ScopedTimer.h"
 
 namespace nebula {
 namespace graph {
@@ -17,7 +23,8 @@ namespace graph {
 class QueryStorageExecutor : public Executor {
 protected:
     QueryStorageExecutor(const std::string &name, const PlanNode *node, QueryContext *qctx)
-        : Executor(name, node, qctx) {}
+        : Executor(name, node, qctx),
+          storageLatency_(GraphMetrics::storageLatency()->get(name)) {}
 
     // parameter isCompleteRequire to specify is return error when partial succeeded
     template <typename Resp>
@@ -42,6 +49,147 @@ protected:
         return Result::State::kSuccess;
     }
 
+    // The state of a response shared with other queries by the storage requests coalescing,
+    // as seen by the query of `rows' with the vid in column `vidIdx'. Only the failed
+    // partitions of its own vids count, not the ones serving the other queries only.
+    StatusOr<Result::State> coalescedCompleteness(
+        const std::unordered_map<PartitionID, storage::cpp2::ErrorCode> &failedParts,
+        GraphSpaceID space,
+        const std::vector<Row> &rows,
+        size_t vidIdx) const;
+
+    // Record the requests to the storage hosts in the metrics, and in the profile and the
+    // trace if any. It's called once for each response by the continuation handling it.
+    template <typename Resp>
+    void addStorageMetrics(const storage::StorageRpcResponse<Resp> &rpcResp) {
+        for (auto &latency : rpcResp.hostLatency()) {
+            storageLatency_->add(std::get<2>(latency));
+        }
+        qctx()->addStorageRpcs(rpcResp.hostLatency().size());
+        if (profiling()) {
+            addStorageStats(rpcResp);
+        }
+        if (qctx()->trace() != nullptr) {
+            addStorageSpans(rpcResp);
+        }
+    }
+
+    // Collect the latency of each storage host and the size of the responses for PROFILE
+    template <typename Resp>
+    void addStorageStats(const storage::StorageRpcResponse<Resp> &rpcResp) {
+        for (auto &latency : rpcResp.hostLatency()) {
+            stats_.addStorageLatency(std::get<0>(latency).toString(),
+                                     std::get<1>(latency),
+                                     std::get<2>(latency));
+        }
+        for (auto &resp : rpcResp.responses()) {
+            apache::thrift::CompactProtocolWriter writer;
+            stats_.storageRespBytes += resp.serializedSize(&writer);
+        }
+    }
+
+    // Record the requests to each storage host on its lane of the trace, the requests are
+    // assumed to be done just now since only the latency of them is known
+    template <typename Resp>
+    void addStorageSpans(const storage::StorageRpcResponse<Resp> &rpcResp) {
+        auto *trace = qctx()->trace();
+        auto now = trace->now();
+        for (auto &latency : rpcResp.hostLatency()) {
+            trace->addSpanOn(folly::stringPrintf("storage %s",
+                                                 std::get<0>(latency).toString().c_str()),
+                             name_,
+                             "storage",
+                             now - std::get<2>(latency),
+                             now,
+                             {{"latency_in_us", folly::to<std::string>(std::get<1>(latency))}});
+        }
+    }
+
+    // Split `rows' into slices by the partition of the vid in column `vidIdx', the rows are
+    // moved into the slices. Return no slices and leave `rows' untouched if the slicing is
+    // disabled by `--storage_response_slices' or there would be only one slice.
+    StatusOr<std::vector<std::vector<Row>>> sliceByParts(GraphSpaceID space,
+                                                         std::vector<Row> &rows,
+                                                         size_t vidIdx) const;
+
+    // The items of a write to one partition, sent by one request
+    struct WriteChunk {
+        PartitionID             part;
+        std::vector<size_t>     indexes;
+    };
+    using WriteResp = storage::StorageRpcResponse<storage::cpp2::ExecResponse>;
+    using ChunkWriter = std::function<folly::Future<WriteResp>(const WriteChunk &)>;
+
+    // Split the `size' items of a write into chunks of at most `--write_chunk_size' items of
+    // one partition, by the vid of each item given by `vidOf'. Return no chunks if the
+    // chunking is disabled by `--write_chunk_size' or all the items fit in one chunk.
+    StatusOr<std::vector<WriteChunk>> chunkByParts(
+        GraphSpaceID space,
+        size_t size,
+        std::function<const VertexID &(size_t)> vidOf) const;
+
+    // Write the chunks by `write' with at most `--write_chunk_concurrency' of them in flight,
+    // the next chunk is sent once one is done. A chunk rejected for the leader changed is
+    // retried up to `--write_chunk_retries' times. The write fails if all the chunks failed,
+    // otherwise it's partially succeeded with a row of the written and failed chunk and
+    // partition counts, and the error of the partitions still failed.
+    folly::Future<Status> writeChunks(std::vector<WriteChunk> chunks, ChunkWriter write);
+
+    // Handle the responses of the sliced requests one by one as soon as they arrive,
+    // `onResp' returns false if the response is partially succeeded, it's not called
+    // concurrently. `onFinish' is called with the state of all slices after the last one.
+    // The query fails if the RPC of any slice failed or none of its partitions succeeded,
+    // since the rows of the whole slice are missing, only the partition errors within
+    // a slice are taken as partial success.
+    template <typename Resp>
+    folly::Future<Status> collectSlices(
+        std::vector<folly::Future<storage::StorageRpcResponse<Resp>>> futures,
+        std::function<bool(storage::StorageRpcResponse<Resp> &)> onResp,
+        std::function<Status(Result::State)> onFinish) {
+        struct Progress {
+            std::mutex lock;
+            Result::State state{Result::State::kSuccess};
+            Status error;
+        };
+        auto progress = std::make_shared<Progress>();
+        std::vector<folly::Future<folly::Unit>> handled;
+        handled.reserve(futures.size());
+        for (auto &future : futures) {
+            handled.emplace_back(std::move(future).via(runner()).then(
+                [this, progress, onResp](folly::Try<storage::StorageRpcResponse<Resp>> &&resp) {
+                    std::lock_guard<std::mutex> g(progress->lock);
+                    SCOPED_TIMER(&execTime_);
+                    if (!progress->error.ok()) {
+                        return;
+                    }
+                    if (resp.hasException()) {
+                        LOG(ERROR) << name_ << " slice failed: " << resp.exception().what();
+                        progress->error = Status::Error("Request to storage failed in executor: %s",
+                                                        resp.exception().what().c_str());
+                        return;
+                    }
+                    addStorageMetrics(resp.value());
+                    auto result = handleCompleteness(resp.value(), false);
+                    if (!result.ok()) {
+                        progress->error = result.status();
+                        return;
+                    }
+                    if (!onResp(resp.value()) ||
+                        result.value() == Result::State::kPartialSuccess) {
+                        progress->state = Result::State::kPartialSuccess;
+                    }
+                }));
+        }
+        return folly::collectAll(handled).via(runner()).then(
+            [this, progress, onFinish](std::vector<folly::Try<folly::Unit>> &&) {
+                SCOPED_TIMER(&execTime_);
+                if (!progress->error.ok()) {
+                    return progress->error;
+                }
+                return onFinish(progress->state);
+            });
+    }
+
     Status handleErrorCode(nebula::storage::cpp2::ErrorCode code, PartitionID partId) {
         switch (code) {
             case storage::cpp2::ErrorCode::E_INVALID_VID:
@@ -83,6 +231,16 @@ protected:
         }
         return Status::OK();
     }
+
+private:
+    // Looked up once by the name of the executor rather than for each response
+    Histogram                                  *storageLatency_{nullptr};
+
+    // Write the chunk, retry it if failed and `retries' is not used up
+    folly::Future<Status> writeChunk(std::shared_ptr<std::mutex> lock,
+                                     const WriteChunk &chunk,
+                                     ChunkWriter write,
+                                     int32_t retries);
 };
 
 }   // namespace graph
@@ -0,0 +1,171 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/StorageRequestCoalescer.h"
+
+#include "planner/Query.h"
+#include "service/GraphFlags.h"
+#include "util/ToJson.h"
+
+namespace nebula {
+namespace graph {
+
+StorageRequestCoalescer::StorageRequestCoalescer(storage::GraphStorageClient *client)
+    : client_(DCHECK_NOTNULL(client)) {
+    if (enabled()) {
+        flusher_ = std::thread([this] { flushLoop(); });
+    }
+}
+
+StorageRequestCoalescer::~StorageRequestCoalescer() {
+    {
+        std::lock_guard<std::mutex> g(flushLock_);
+        stopped_ = true;
+    }
+    flushCond_.notify_all();
+    if (flusher_.joinable()) {
+        flusher_.join();
+    }
+}
+
+// static
+bool StorageRequestCoalescer::enabled() {
+    return FLAGS_storage_coalescing_window_us > 0;
+}
+
+// static
+bool StorageRequestCoalescer::canCoalesce(const GetNeighbors *gn) {
+    return !gn->random() && gn->orderBy().empty() &&
+           gn->limit() == std::numeric_limits<int64_t>::max();
+}
+
+// static
+bool StorageRequestCoalescer::canCoalesce(const GetVertices *gv) {
+    return gv->orderBy().empty() && gv->limit() == std::numeric_limits<int64_t>::max();
+}
+
+folly::Future<StorageRequestCoalescer::GetNeighborsQueue::SharedResponse>
+StorageRequestCoalescer::getNeighbors(const GetNeighbors *gn, const std::vector<Row> &vids) {
+    // The requests are merged only if all the parameters except the vertices are the same
+    auto key = folly::toJson(folly::dynamic::array(
+        gn->space(),
+        util::toJson(gn->edgeTypes()),
+        static_cast<int32_t>(gn->edgeDirection()),
+        gn->statProps() ? util::toJson(*gn->statProps()) : folly::dynamic(nullptr),
+        gn->vertexProps() ? util::toJson(*gn->vertexProps()) : folly::dynamic(nullptr),
+        gn->edgeProps() ? util::toJson(*gn->edgeProps()) : folly::dynamic(nullptr),
+        gn->exprs() ? util::toJson(*gn->exprs()) : folly::dynamic(nullptr),
+        gn->dedup(),
+        gn->filter()));
+
+    // Copy the parameters since the plan node is owned by the query which opened the batch
+    auto space = gn->space();
+    auto edgeTypes = gn->edgeTypes();
+    auto direction = gn->edgeDirection();
+    auto copy = [](const auto *props) {
+        using T = std::remove_cv_t<std::remove_pointer_t<decltype(props)>>;
+        return props == nullptr ? std::shared_ptr<T>() : std::make_shared<T>(*props);
+    };
+    auto statProps = copy(gn->statProps());
+    auto vertexProps = copy(gn->vertexProps());
+    auto edgeProps = copy(gn->edgeProps());
+    auto exprs = copy(gn->exprs());
+    auto dedup = gn->dedup();
+    auto filter = gn->filter();
+    auto fetcher = [client = client_, space, edgeTypes = std::move(edgeTypes), direction,
+                    statProps, vertexProps, edgeProps, exprs, dedup,
+                    filter = std::move(filter)](std::vector<Row> rows) {
+        return client
+            ->getNeighbors(space,
+                           {kVid},
+                           std::move(rows),
+                           edgeTypes,
+                           direction,
+                           statProps.get(),
+                           vertexProps.get(),
+                           edgeProps.get(),
+                           exprs.get(),
+                           dedup,
+                           false,
+                           {},
+                           std::numeric_limits<int64_t>::max(),
+                           filter)
+            .via(&folly::InlineExecutor::instance());
+    };
+    return getNeighborsQueue_.add(key,
+                                  vids,
+                                  std::move(fetcher),
+                                  std::chrono::microseconds(FLAGS_storage_coalescing_window_us),
+                                  FLAGS_storage_coalescing_max_vids);
+}
+
+folly::Future<StorageRequestCoalescer::GetPropQueue::SharedResponse>
+StorageRequestCoalescer::getProps(const GetVertices *gv, const std::vector<Row> &vids) {
+    auto key = folly::toJson(folly::dynamic::array(gv->space(),
+                                                   util::toJson(gv->props()),
+                                                   util::toJson(gv->exprs()),
+                                                   gv->dedup(),
+                                                   gv->filter()));
+
+    auto space = gv->space();
+    auto props = std::make_shared<std::vector<storage::cpp2::VertexProp>>(gv->props());
+    std::shared_ptr<std::vector<storage::cpp2::Expr>> exprs;
+    if (!gv->exprs().empty()) {
+        exprs = std::make_shared<std::vector<storage::cpp2::Expr>>(gv->exprs());
+    }
+    auto dedup = gv->dedup();
+    auto filter = gv->filter();
+    auto fetcher = [client = client_, space, props, exprs, dedup, filter = std::move(filter)](
+                       std::vector<Row> rows) {
+        DataSet vertices({kVid});
+        vertices.rows = std::move(rows);
+        return client
+            ->getProps(space,
+                       std::move(vertices),
+                       props.get(),
+                       nullptr,
+                       exprs.get(),
+                       dedup,
+                       {},
+                       std::numeric_limits<int64_t>::max(),
+                       filter)
+            .via(&folly::InlineExecutor::instance());
+    };
+    return getPropQueue_.add(key,
+                             vids,
+                             std::move(fetcher),
+                             std::chrono::microseconds(FLAGS_storage_coalescing_window_us),
+                             FLAGS_storage_coalescing_max_vids);
+}
+
+// static
+DataSet StorageRequestCoalescer::pick(const DataSet &ds, const std::unordered_set<Value> &vids) {
+    DataSet result;
+    result.colNames = ds.colNames;
+    for (auto &row : ds.rows) {
+        if (!row.values.empty() && vids.find(row.values.front()) != vids.end()) {
+            result.rows.emplace_back(row);
+        }
+    }
+    return result;
+}
+
+void StorageRequestCoalescer::flushLoop() {
+    std::unique_lock<std::mutex> l(flushLock_);
+    while (!stopped_) {
+        flushCond_.wait_for(l, std::chrono::microseconds(FLAGS_storage_coalescing_window_us));
+        l.unlock();
+        getNeighborsQueue_.flush(false);
+        getPropQueue_.flush(false);
+        l.lock();
+    }
+    l.unlock();
+    getNeighborsQueue_.flush(true);
+    getPropQueue_.flush(true);
+}
+
+}   // namespace graph
+}   // namespace nebula
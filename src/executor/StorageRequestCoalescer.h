@@ -0,0 +1,172 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_STORAGEREQUESTCOALESCER_H_
+#define EXECUTOR_STORAGEREQUESTCOALESCER_H_
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <folly/executors/InlineExecutor.h>
+#include <folly/futures/Future.h>
+#include <folly/futures/SharedPromise.h>
+
+#include "common/base/Base.h"
+#include "common/clients/storage/GraphStorageClient.h"
+#include "common/cpp/helpers.h"
+#include "common/datatypes/DataSet.h"
+
+namespace nebula {
+namespace graph {
+
+class GetNeighbors;
+class GetVertices;
+
+/**
+ * A queue of pending explore requests which share the same request parameters.
+ * Vertices of the requests added in the same window are merged and deduplicated,
+ * and sent to storage by one request which is split into one request per partition
+ * by the storage client. All the requesters share the whole response.
+ */
+template <typename Resp>
+class CoalescingQueue final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    using RpcResponse = storage::StorageRpcResponse<Resp>;
+    using SharedResponse = std::shared_ptr<RpcResponse>;
+    using Fetcher = std::function<folly::Future<RpcResponse>(std::vector<Row>)>;
+
+    CoalescingQueue() = default;
+
+    // `rows' are the vertices to request, the first column of which is the vertex id.
+    // `fetcher' is only used when a new batch is opened for the `key'.
+    folly::Future<SharedResponse> add(const std::string &key,
+                                      const std::vector<Row> &rows,
+                                      Fetcher fetcher,
+                                      std::chrono::microseconds window,
+                                      size_t maxVids) {
+        std::shared_ptr<Batch> full;
+        auto future = folly::Future<SharedResponse>::makeEmpty();
+        {
+            std::lock_guard<std::mutex> g(lock_);
+            auto &batch = batches_[key];
+            if (batch == nullptr) {
+                batch = std::make_shared<Batch>();
+                batch->fetcher = std::move(fetcher);
+                batch->deadline = std::chrono::steady_clock::now() + window;
+            }
+            for (auto &row : rows) {
+                DCHECK(!row.values.empty());
+                if (batch->uniqueVids.emplace(row.values.front()).second) {
+                    batch->rows.emplace_back(row);
+                }
+            }
+            future = batch->promise.getFuture();
+            if (batch->rows.size() >= maxVids) {
+                full = std::move(batch);
+                batches_.erase(key);
+            }
+        }
+        if (full != nullptr) {
+            issue(std::move(full));
+        }
+        return future;
+    }
+
+    // Send all the batches whose window is closed, or all of them if `force'.
+    void flush(bool force) {
+        std::vector<std::shared_ptr<Batch>> expired;
+        auto now = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> g(lock_);
+            for (auto iter = batches_.begin(); iter != batches_.end();) {
+                if (force || iter->second->deadline <= now) {
+                    expired.emplace_back(std::move(iter->second));
+                    iter = batches_.erase(iter);
+                } else {
+                    ++iter;
+                }
+            }
+        }
+        for (auto &batch : expired) {
+            issue(std::move(batch));
+        }
+    }
+
+private:
+    struct Batch {
+        Fetcher                                         fetcher;
+        std::unordered_set<Value>                       uniqueVids;
+        std::vector<Row>                                rows;
+        std::chrono::steady_clock::time_point           deadline;
+        folly::SharedPromise<SharedResponse>            promise;
+    };
+
+    void issue(std::shared_ptr<Batch> batch) {
+        VLOG(2) << "Issue coalesced storage request of " << batch->rows.size() << " vertices";
+        batch->fetcher(std::move(batch->rows))
+            .then([batch](folly::Try<RpcResponse> &&resp) {
+                if (resp.hasException()) {
+                    batch->promise.setException(std::move(resp.exception()));
+                    return;
+                }
+                batch->promise.setValue(std::make_shared<RpcResponse>(std::move(resp).value()));
+            });
+    }
+
+    std::mutex                                                  lock_;
+    std::unordered_map<std::string, std::shared_ptr<Batch>>     batches_;
+};
+
+/**
+ * StorageRequestCoalescer merges the GetNeighbors/GetProps requests of concurrent queries
+ * which target the same space with the same edge types and props within a small window.
+ * It is shared by all the queries of the graph daemon and is disabled when
+ * `--storage_coalescing_window_us' is zero.
+ */
+class StorageRequestCoalescer final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    using GetNeighborsQueue = CoalescingQueue<storage::cpp2::GetNeighborsResponse>;
+    using GetPropQueue = CoalescingQueue<storage::cpp2::GetPropResponse>;
+
+    explicit StorageRequestCoalescer(storage::GraphStorageClient *client);
+
+    ~StorageRequestCoalescer();
+
+    static bool enabled();
+
+    // Only the requests whose results of each vertex don't depend on the other vertices
+    // could be merged, i.e. no limit, random or order by.
+    static bool canCoalesce(const GetNeighbors *gn);
+    static bool canCoalesce(const GetVertices *gv);
+
+    folly::Future<GetNeighborsQueue::SharedResponse> getNeighbors(const GetNeighbors *gn,
+                                                                  const std::vector<Row> &vids);
+
+    folly::Future<GetPropQueue::SharedResponse> getProps(const GetVertices *gv,
+                                                         const std::vector<Row> &vids);
+
+    // Pick out the rows of the requested vertices from a shared response dataset,
+    // the first column of which is the vertex id.
+    static DataSet pick(const DataSet &ds, const std::unordered_set<Value> &vids);
+
+private:
+    void flushLoop();
+
+    storage::GraphStorageClient                *client_{nullptr};
+    GetNeighborsQueue                           getNeighborsQueue_;
+    GetPropQueue                                getPropQueue_;
+
+    std::mutex                                  flushLock_;
+    std::condition_variable                     flushCond_;
+    bool                                        stopped_{false};
+    std::thread                                 flusher_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_STORAGEREQUESTCOALESCER_H_
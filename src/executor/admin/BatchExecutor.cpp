@@ -0,0 +1,61 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/admin/BatchExecutor.h"
+
+#include <folly/futures/helpers.h>
+
+#include "context/QueryContext.h"
+#include "planner/Admin.h"
+#include "service/GraphFlags.h"
+#include "util/ScopedTimer.h"
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> BatchExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    auto *batch = asNode<Batch>(node());
+    auto &run = qctx()->batchRunner();
+    if (!run) {
+        return Status::Error("BATCH could not be run in a batch.");
+    }
+    // The next query starts as soon as one is done, so a slow query only holds one slot
+    auto parallelism = static_cast<size_t>(std::max(FLAGS_batch_execute_parallelism, 1));
+    auto futures = folly::window(
+        batch->queries(),
+        [run](const std::string &query) { return run(query); },
+        parallelism);
+    return folly::collectAll(futures).via(runner()).then(
+        [this, batch](std::vector<folly::Try<cpp2::ExecutionResponse>> &&resps) {
+            SCOPED_TIMER(&execTime_);
+            DataSet ds(batch->colNames());
+            auto &queries = batch->queries();
+            for (size_t i = 0; i < resps.size(); ++i) {
+                // One failed query does not fail the others
+                if (resps[i].hasException()) {
+                    ds.emplace_back(Row({queries[i],
+                                         cpp2::_ErrorCode_VALUES_TO_NAMES.at(
+                                             cpp2::ErrorCode::E_EXECUTION_ERROR),
+                                         resps[i].exception().what().toStdString(),
+                                         Value::kNullValue}));
+                    continue;
+                }
+                auto &resp = resps[i].value();
+                auto code = cpp2::_ErrorCode_VALUES_TO_NAMES.at(resp.get_error_code());
+                Value msg = resp.get_error_msg() != nullptr ? Value(*resp.get_error_msg())
+                                                            : Value::kNullValue;
+                Value data = resp.get_data() != nullptr ? Value(std::move(*resp.get_data()))
+                                                        : Value::kNullValue;
+                ds.emplace_back(Row({queries[i], code, std::move(msg), std::move(data)}));
+            }
+            return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+        });
+}
+
+}   // namespace graph
+}   // namespace nebula
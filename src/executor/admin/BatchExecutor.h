@@ -0,0 +1,28 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_ADMIN_BATCHEXECUTOR_H_
+#define EXECUTOR_ADMIN_BATCHEXECUTOR_H_
+
+#include "executor/Executor.h"
+
+namespace nebula {
+namespace graph {
+
+// Run the queries of a BATCH as queries of their own, at most `--batch_execute_parallelism'
+// of them at the same time. Each row of the result is the response of one query in order.
+class BatchExecutor final : public Executor {
+public:
+    BatchExecutor(const PlanNode *node, QueryContext *qctx)
+        : Executor("BatchExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_ADMIN_BATCHEXECUTOR_H_
@@ -0,0 +1,34 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/admin/PreparedStatementExecutor.h"
+
+#include "context/PreparedStatement.h"
+#include "context/QueryContext.h"
+#include "planner/Admin.h"
+#include "util/ScopedTimer.h"
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> PrepareExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    auto *prepare = asNode<Prepare>(node());
+    auto *session = qctx()->rctx()->session();
+    return session->addPreparedStatement(prepare->name(), prepare->statement());
+}
+
+folly::Future<Status> DeallocateExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    auto *deallocate = asNode<Deallocate>(node());
+    auto *session = qctx()->rctx()->session();
+    return session->removePreparedStatement(deallocate->name());
+}
+
+}   // namespace graph
+}   // namespace nebula
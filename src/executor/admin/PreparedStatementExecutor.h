@@ -0,0 +1,34 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_ADMIN_PREPAREDSTATEMENTEXECUTOR_H_
+#define EXECUTOR_ADMIN_PREPAREDSTATEMENTEXECUTOR_H_
+
+#include "executor/Executor.h"
+
+namespace nebula {
+namespace graph {
+
+class PrepareExecutor final : public Executor {
+public:
+    PrepareExecutor(const PlanNode *node, QueryContext *qctx)
+        : Executor("PrepareExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+};
+
+class DeallocateExecutor final : public Executor {
+public:
+    DeallocateExecutor(const PlanNode *node, QueryContext *qctx)
+        : Executor("DeallocateExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_ADMIN_PREPAREDSTATEMENTEXECUTOR_H_
@@ -0,0 +1,105 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/admin/QueriesExecutor.h"
+
+#include "context/QueryContext.h"
+#include "context/QueryRegistry.h"
+#include "context/QueryStats.h"
+#include "planner/Admin.h"
+#include "util/ScopedTimer.h"
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> ShowQueriesExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    auto *registry = qctx()->queryRegistry();
+    if (registry == nullptr) {
+        return Status::Error("Query registry is not available");
+    }
+
+    // Only GOD role could see the queries of all users
+    auto *session = qctx()->rctx()->session();
+    DataSet ds({"Id", "SessionId", "User", "DurationInUSec", "Query"});
+    for (auto &query : registry->list()) {
+        if (!session->isGod() && query.user != session->user()) {
+            continue;
+        }
+        ds.emplace_back(Row({query.id,
+                             query.sessionId,
+                             query.user,
+                             static_cast<int64_t>(query.duration.elapsedInUSec()),
+                             query.query}));
+    }
+    return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+}
+
+folly::Future<Status> KillQueryExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    auto *kill = asNode<KillQuery>(node());
+    auto *registry = qctx()->queryRegistry();
+    if (registry == nullptr) {
+        return Status::Error("Query registry is not available");
+    }
+    if (kill->queryId() == qctx()->queryId()) {
+        return Status::Error("Could not kill the query itself");
+    }
+
+    auto found = registry->find(kill->queryId());
+    NG_RETURN_IF_ERROR(found);
+    auto *session = qctx()->rctx()->session();
+    if (!session->isGod() && found.value().user != session->user()) {
+        return Status::Error("No permission to kill the query `%ld'", kill->queryId());
+    }
+    return registry->kill(kill->queryId());
+}
+
+folly::Future<Status> ShowQueryStatsExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    auto *stats = qctx()->queryStats();
+    if (stats == nullptr) {
+        return Status::Error("Query stats is disabled");
+    }
+    DataSet ds({"Fingerprint",
+                "Calls",
+                "Errors",
+                "TotalLatencyInUSec",
+                "MinLatencyInUSec",
+                "MaxLatencyInUSec",
+                "P99LatencyInUSec",
+                "Rows",
+                "StorageRpcs"});
+    for (auto &entry : stats->list()) {
+        ds.emplace_back(Row({entry.fingerprint,
+                             static_cast<int64_t>(entry.calls),
+                             static_cast<int64_t>(entry.errors),
+                             entry.totalLatencyInUs,
+                             entry.minLatencyInUs,
+                             entry.maxLatencyInUs,
+                             entry.p99LatencyInUs,
+                             entry.rows,
+                             entry.storageRpcs}));
+    }
+    return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+}
+
+folly::Future<Status> ResetQueryStatsExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    auto *stats = qctx()->queryStats();
+    if (stats == nullptr) {
+        return Status::Error("Query stats is disabled");
+    }
+    stats->reset();
+    return Status::OK();
+}
+
+}   // namespace graph
+}   // namespace nebula
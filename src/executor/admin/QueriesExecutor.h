@@ -0,0 +1,50 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_ADMIN_QUERIESEXECUTOR_H_
+#define EXECUTOR_ADMIN_QUERIESEXECUTOR_H_
+
+#include "executor/Executor.h"
+
+namespace nebula {
+namespace graph {
+
+class ShowQueriesExecutor final : public Executor {
+public:
+    ShowQueriesExecutor(const PlanNode *node, QueryContext *qctx)
+        : Executor("ShowQueriesExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+};
+
+class KillQueryExecutor final : public Executor {
+public:
+    KillQueryExecutor(const PlanNode *node, QueryContext *qctx)
+        : Executor("KillQueryExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+};
+
+class ShowQueryStatsExecutor final : public Executor {
+public:
+    ShowQueryStatsExecutor(const PlanNode *node, QueryContext *qctx)
+        : Executor("ShowQueryStatsExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+};
+
+class ResetQueryStatsExecutor final : public Executor {
+public:
+    ResetQueryStatsExecutor(const PlanNode *node, QueryContext *qctx)
+        : Executor("ResetQueryStatsExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_ADMIN_QUERIESEXECUTOR_H_
@@ -26,6 +26,10 @@ folly::Future<Status> SubmitJobExecutor::execute() {
             cmd = meta::cpp2::AdminCmd::COMPACT;
         } else if (params.front() == "flush") {
             cmd = meta::cpp2::AdminCmd::FLUSH;
+        } else if (params.front() == "download") {
+            cmd = meta::cpp2::AdminCmd::DOWNLOAD;
+        } else if (params.front() == "ingest") {
+            cmd = meta::cpp2::AdminCmd::INGEST;
         } else {
             DLOG(FATAL) << "Unknown job command " << params.front();
             return Status::Error("Unknown job command %s", params.front().c_str());
@@ -0,0 +1,108 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/cache/AdjacencyCache.h"
+
+#include "common/datatypes/List.h"
+#include "planner/Query.h"
+#include "service/GraphFlags.h"
+#include "util/ToJson.h"
+
+namespace nebula {
+namespace graph {
+
+AdjacencyCache::AdjacencyCache(size_t capacity, int32_t ttlSecs, int64_t minDegree)
+    : cache_(capacity), ttl_(ttlSecs), minDegree_(minDegree) {}
+
+// static
+bool AdjacencyCache::enabled() {
+    return FLAGS_adjacency_cache_capacity > 0;
+}
+
+// static
+bool AdjacencyCache::canCache(const GetNeighbors *gn) {
+    return !gn->random() && gn->orderBy().empty() &&
+           gn->limit() == std::numeric_limits<int64_t>::max();
+}
+
+// static
+std::string AdjacencyCache::signature(const GetNeighbors *gn) {
+    return folly::toJson(folly::dynamic::array(
+        util::toJson(gn->edgeTypes()),
+        static_cast<int32_t>(gn->edgeDirection()),
+        gn->statProps() ? util::toJson(*gn->statProps()) : folly::dynamic(nullptr),
+        gn->vertexProps() ? util::toJson(*gn->vertexProps()) : folly::dynamic(nullptr),
+        gn->edgeProps() ? util::toJson(*gn->edgeProps()) : folly::dynamic(nullptr),
+        gn->exprs() ? util::toJson(*gn->exprs()) : folly::dynamic(nullptr),
+        gn->dedup(),
+        gn->filter()));
+}
+
+// static
+int64_t AdjacencyCache::degree(const std::vector<std::string> &colNames, const Row &row) {
+    static const std::string kEdgePrefix = "_edge:";
+    int64_t degree = 0;
+    for (size_t i = 0; i < colNames.size() && i < row.values.size(); ++i) {
+        if (colNames[i].compare(0, kEdgePrefix.size(), kEdgePrefix) != 0) {
+            continue;
+        }
+        auto &edges = row.values[i];
+        if (edges.isList()) {
+            degree += edges.getList().size();
+        }
+    }
+    return degree;
+}
+
+std::shared_ptr<const DataSet> AdjacencyCache::get(GraphSpaceID space,
+                                                   const Value &vid,
+                                                   const std::string &signature) {
+    if (!vid.isStr()) {
+        return nullptr;
+    }
+    auto entry = cache_.get(Key{space, vid.getStr()});
+    if (entry.hasValue()) {
+        auto found = (*entry)->find(signature);
+        if (found != (*entry)->end() && found->second.expiration >= Clock::now()) {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return found->second.rows;
+        }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+void AdjacencyCache::put(GraphSpaceID space,
+                         const DataSet &ds,
+                         const std::string &signature,
+                         uint64_t epoch) {
+    auto expiration = ttl_.count() > 0 ? Clock::now() + ttl_ : Clock::time_point::max();
+    for (auto &row : ds.rows) {
+        if (row.values.empty() || !row.values.front().isStr() ||
+            degree(ds.colNames, row) < minDegree_) {
+            continue;
+        }
+        auto rows = std::make_shared<DataSet>(ds.colNames);
+        rows->rows.emplace_back(row);
+
+        cache_.fill(Key{space, row.values.front().getStr()}, epoch,
+                    [&](folly::Optional<Entry> &entry) {
+            auto adjacencies =
+                entry.hasValue()
+                    ? std::make_shared<std::unordered_map<std::string, Adjacency>>(**entry)
+                    : std::make_shared<std::unordered_map<std::string, Adjacency>>();
+            (*adjacencies)[signature] = Adjacency{std::move(rows), expiration};
+            entry = std::move(adjacencies);
+        });
+    }
+}
+
+void AdjacencyCache::invalidate(GraphSpaceID space, const VertexID &vid) {
+    cache_.invalidate(Key{space, vid});
+}
+
+}   // namespace graph
+}   // namespace nebula
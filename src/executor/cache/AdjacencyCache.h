@@ -0,0 +1,115 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_CACHE_ADJACENCYCACHE_H_
+#define EXECUTOR_CACHE_ADJACENCYCACHE_H_
+
+#include <atomic>
+#include <chrono>
+
+#include "common/base/Base.h"
+#include "common/cpp/helpers.h"
+#include "common/datatypes/DataSet.h"
+#include "util/ShardedLruCache.h"
+
+namespace nebula {
+namespace graph {
+
+class GetNeighbors;
+
+/**
+ * AdjacencyCache caches the GetNeighbors response rows of the supernodes, i.e. the vertices
+ * whose degree is not less than `--adjacency_cache_min_degree'. Each row is kept in a DataSet
+ * with the column names of the response, so it could be put into the result of
+ * GetNeighborsExecutor and consumed by GetNeighborsIter as is.
+ *
+ * The rows of one vertex explored by different edge types, direction or props are
+ * distinguished by the request signature and all dropped together when the edges or the
+ * vertex are written through this graph daemon, and a response read before that is not filled
+ * back. The writes from other graph daemons are only visible after the entries expire by
+ * `--adjacency_cache_ttl_secs'.
+ */
+class AdjacencyCache final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    AdjacencyCache(size_t capacity, int32_t ttlSecs, int64_t minDegree);
+
+    static bool enabled();
+
+    // Only the requests whose rows of each vertex don't depend on the other vertices are
+    // cached, i.e. no limit, random or order by.
+    static bool canCache(const GetNeighbors *gn);
+
+    // The signature of all the request parameters except the vertices
+    static std::string signature(const GetNeighbors *gn);
+
+    // Return the cached rows of `vid' as a DataSet with the column names of the response
+    std::shared_ptr<const DataSet> get(GraphSpaceID space,
+                                       const Value &vid,
+                                       const std::string &signature);
+
+    // Taken before sending the GetNeighbors request whose response will be put
+    uint64_t epoch() const {
+        return cache_.epoch();
+    }
+
+    // Cache the rows of the supernodes in the response dataset `ds',
+    // the first column of which is the vertex id. The vertices invalidated since `epoch'
+    // are skipped.
+    void put(GraphSpaceID space,
+             const DataSet &ds,
+             const std::string &signature,
+             uint64_t epoch);
+
+    void invalidate(GraphSpaceID space, const VertexID &vid);
+
+    // Number of edges in the row of a GetNeighbors response
+    static int64_t degree(const std::vector<std::string> &colNames, const Row &row);
+
+    uint64_t hits() const {
+        return hits_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t misses() const {
+        return misses_.load(std::memory_order_relaxed);
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Key {
+        GraphSpaceID space;
+        VertexID vid;
+
+        bool operator==(const Key &rhs) const {
+            return space == rhs.space && vid == rhs.vid;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            return std::hash<VertexID>()(key.vid) ^ static_cast<size_t>(key.space);
+        }
+    };
+
+    struct Adjacency {
+        std::shared_ptr<const DataSet> rows;
+        Clock::time_point expiration;
+    };
+
+    // request signature -> rows of the vertex
+    using Entry = std::shared_ptr<const std::unordered_map<std::string, Adjacency>>;
+
+    ShardedLruCache<Key, Entry, KeyHash>        cache_;
+    std::chrono::seconds                        ttl_;
+    int64_t                                     minDegree_{0};
+    std::atomic<uint64_t>                       hits_{0};
+    std::atomic<uint64_t>                       misses_{0};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_CACHE_ADJACENCYCACHE_H_
@@ -0,0 +1,147 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/cache/VertexPropCache.h"
+
+#include "planner/Query.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+VertexPropCache::VertexPropCache(size_t capacity, int32_t ttlSecs)
+    : cache_(capacity), ttl_(ttlSecs) {}
+
+// static
+bool VertexPropCache::enabled() {
+    return FLAGS_vertex_cache_capacity > 0;
+}
+
+// static
+bool VertexPropCache::canCache(const GetVertices *gv) {
+    if (!gv->exprs().empty() || !gv->filter().empty() || !gv->orderBy().empty() ||
+        gv->limit() != std::numeric_limits<int64_t>::max() || gv->props().empty()) {
+        return false;
+    }
+    for (auto &prop : gv->props()) {
+        if (prop.props.empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+VertexPropCache::Clock::time_point VertexPropCache::expiration() const {
+    if (ttl_.count() <= 0) {
+        return Clock::time_point::max();
+    }
+    return Clock::now() + ttl_;
+}
+
+bool VertexPropCache::get(GraphSpaceID space,
+                          const Value &vid,
+                          const std::vector<storage::cpp2::VertexProp> &props,
+                          Row *row,
+                          std::vector<std::string> *colNames) {
+    if (!vid.isStr()) {
+        return false;
+    }
+    auto entry = cache_.get(Key{space, vid.getStr()});
+    if (!entry.hasValue()) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    auto now = Clock::now();
+    std::vector<Value> values;
+    std::vector<std::string> names;
+    values.emplace_back(vid);
+    names.emplace_back(kVid);
+    for (auto &prop : props) {
+        auto tag = (*entry)->find(prop.tag);
+        if (tag == (*entry)->end() || tag->second.expiration < now) {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        for (auto &name : prop.props) {
+            auto found = tag->second.props.find(name);
+            if (found == tag->second.props.end()) {
+                misses_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            names.emplace_back(found->second.first);
+            values.emplace_back(found->second.second);
+        }
+    }
+
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    row->values = std::move(values);
+    if (colNames->empty()) {
+        *colNames = std::move(names);
+    }
+    return true;
+}
+
+void VertexPropCache::put(GraphSpaceID space,
+                          const DataSet &ds,
+                          const std::vector<storage::cpp2::VertexProp> &props,
+                          uint64_t epoch) {
+    size_t numProps = 0;
+    for (auto &prop : props) {
+        numProps += prop.props.size();
+    }
+    if (ds.colNames.size() != numProps + 1) {
+        VLOG(1) << "Mismatched columns of the props response, skip the cache";
+        return;
+    }
+
+    auto expireAt = expiration();
+    for (auto &row : ds.rows) {
+        if (row.values.size() != ds.colNames.size() || !row.values.front().isStr()) {
+            continue;
+        }
+        cache_.fill(Key{space, row.values.front().getStr()}, epoch,
+                    [&](folly::Optional<Entry> &entry) {
+            auto tags = entry.hasValue()
+                            ? std::make_shared<std::unordered_map<TagID, TagProps>>(**entry)
+                            : std::make_shared<std::unordered_map<TagID, TagProps>>();
+            size_t col = 1;
+            for (auto &prop : props) {
+                auto &tagProps = (*tags)[prop.tag];
+                if (tagProps.props.empty()) {
+                    tagProps.expiration = expireAt;
+                }
+                for (auto &name : prop.props) {
+                    tagProps.props[name] = std::make_pair(ds.colNames[col], row.values[col]);
+                    ++col;
+                }
+            }
+            entry = std::move(tags);
+        });
+    }
+}
+
+void VertexPropCache::invalidate(GraphSpaceID space, const VertexID &vid) {
+    cache_.invalidate(Key{space, vid});
+}
+
+void VertexPropCache::invalidate(GraphSpaceID space, const VertexID &vid, TagID tag) {
+    cache_.invalidate(Key{space, vid}, [tag](folly::Optional<Entry> &entry) {
+        if (!entry.hasValue()) {
+            return;
+        }
+        auto tags = std::make_shared<std::unordered_map<TagID, TagProps>>(**entry);
+        tags->erase(tag);
+        if (tags->empty()) {
+            entry = folly::none;
+        } else {
+            entry = std::move(tags);
+        }
+    });
+}
+
+}   // namespace graph
+}   // namespace nebula
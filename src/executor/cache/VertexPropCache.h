@@ -0,0 +1,113 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_CACHE_VERTEXPROPCACHE_H_
+#define EXECUTOR_CACHE_VERTEXPROPCACHE_H_
+
+#include <atomic>
+#include <chrono>
+
+#include "common/base/Base.h"
+#include "common/cpp/helpers.h"
+#include "common/datatypes/DataSet.h"
+#include "common/interface/gen-cpp2/storage_types.h"
+#include "util/ShardedLruCache.h"
+
+namespace nebula {
+namespace graph {
+
+class GetVertices;
+
+/**
+ * VertexPropCache caches the tag properties of the hot vertices fetched by GetProps,
+ * keyed by vertex with the props of each tag. It's filled from the responses of
+ * GetVerticesExecutor and invalidated by the vertex mutations executed on this graph daemon.
+ * A response read before an invalidation of its vertex is not filled back, see ShardedLruCache.
+ * The writes from other graph daemons are only visible after the entries expire
+ * by `--vertex_cache_ttl_secs'.
+ */
+class VertexPropCache final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    VertexPropCache(size_t capacity, int32_t ttlSecs);
+
+    static bool enabled();
+
+    // Only the plain property fetching without exprs, filter, limit or order by is cached,
+    // and all the props have to be listed explicitly.
+    static bool canCache(const GetVertices *gv);
+
+    // Build the row of `vid' by the requested `props' if all of them are cached,
+    // `colNames' is filled by the column names of the row if it's empty.
+    bool get(GraphSpaceID space,
+             const Value &vid,
+             const std::vector<storage::cpp2::VertexProp> &props,
+             Row *row,
+             std::vector<std::string> *colNames);
+
+    // Taken before sending the GetProps request whose response will be put
+    uint64_t epoch() const {
+        return cache_.epoch();
+    }
+
+    // Fill the cache by the GetProps response `ds' of the requested `props',
+    // the first column of `ds' is the vid and the others are props in the requested order.
+    // The vertices invalidated since `epoch' are skipped.
+    void put(GraphSpaceID space,
+             const DataSet &ds,
+             const std::vector<storage::cpp2::VertexProp> &props,
+             uint64_t epoch);
+
+    void invalidate(GraphSpaceID space, const VertexID &vid);
+
+    void invalidate(GraphSpaceID space, const VertexID &vid, TagID tag);
+
+    uint64_t hits() const {
+        return hits_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t misses() const {
+        return misses_.load(std::memory_order_relaxed);
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Key {
+        GraphSpaceID space;
+        VertexID vid;
+
+        bool operator==(const Key &rhs) const {
+            return space == rhs.space && vid == rhs.vid;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            return std::hash<VertexID>()(key.vid) ^ static_cast<size_t>(key.space);
+        }
+    };
+
+    struct TagProps {
+        // prop name -> (column name, value)
+        std::unordered_map<std::string, std::pair<std::string, Value>> props;
+        Clock::time_point expiration;
+    };
+
+    // All the cached tags of one vertex
+    using Entry = std::shared_ptr<const std::unordered_map<TagID, TagProps>>;
+
+    Clock::time_point expiration() const;
+
+    ShardedLruCache<Key, Entry, KeyHash>        cache_;
+    std::chrono::seconds                        ttl_;
+    std::atomic<uint64_t>                       hits_{0};
+    std::atomic<uint64_t>                       misses_{0};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_CACHE_VERTEXPROPCACHE_H_
@@ -31,6 +31,9 @@ folly::Future<Status> LoopExecutor::execute() {
     auto value = expr->eval(ctx);
     VLOG(1) << "Loop condition: " << value;
     DCHECK(value.isBool());
+    if (value.isBool() && value.getBool()) {
+        stats_.iterations++;
+    }
     return finish(ResultBuilder().value(std::move(value)).iter(Iterator::Kind::kDefault).finish());
 }
 
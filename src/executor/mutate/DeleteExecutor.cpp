@@ -5,8 +5,13 @@
  */
 
 #include "DeleteExecutor.h"
+
+#include <folly/hash/Hash.h>
+
 #include "planner/Mutate.h"
 #include "context/QueryContext.h"
+#include "executor/cache/AdjacencyCache.h"
+#include "executor/cache/VertexPropCache.h"
 #include "util/SchemaUtil.h"
 #include "executor/mutate/DeleteExecutor.h"
 #include "util/ScopedTimer.h"
@@ -15,6 +20,17 @@
 namespace nebula {
 namespace graph {
 
+namespace {
+
+struct EdgeKeyHash {
+    size_t operator()(const storage::cpp2::EdgeKey &key) const {
+        return folly::hash::hash_combine(
+            key.get_src(), key.get_dst(), key.get_ranking(), key.get_edge_type());
+    }
+};
+
+}   // namespace
+
 folly::Future<Status> DeleteVerticesExecutor::execute() {
     SCOPED_TIMER(&execTime_);
     return deleteVertices();
@@ -38,6 +54,7 @@ folly::Future<Status> DeleteVerticesExecutor::deleteVertices() {
         auto& inputResult = ectx_->getResult(inputVar);
         auto iter = inputResult.iter();
         vertices.reserve(iter->size());
+        std::unordered_set<VertexID> seen;
         QueryExpressionContext ctx(ectx_);
         for (; iter->valid(); iter->next()) {
             auto val = Expression::eval(vidRef, ctx(iter.get()));
@@ -50,7 +67,9 @@ folly::Future<Status> DeleteVerticesExecutor::deleteVertices() {
                 ss << "Wrong vid type `" << val.type() << "', value `" << val.toString() << "'";
                 return Status::Error(ss.str());
             }
-            vertices.emplace_back(val.moveStr());
+            if (seen.emplace(val.getStr()).second) {
+                vertices.emplace_back(val.moveStr());
+            }
         }
     }
 
@@ -58,16 +77,50 @@ folly::Future<Status> DeleteVerticesExecutor::deleteVertices() {
         return Status::OK();
     }
     auto spaceId = qctx()->rctx()->session()->space();
+    std::vector<VertexID> cached;
+    if (qctx()->vertexCache() != nullptr || qctx()->adjacencyCache() != nullptr) {
+        cached = vertices;
+    }
+    auto chunks = chunkByParts(spaceId, vertices.size(), [&vertices](size_t i) -> const VertexID & {
+        return vertices[i];
+    });
+    NG_RETURN_IF_ERROR(chunks);
     time::Duration deleteVertTime;
-    return qctx()->getStorageClient()->deleteVertices(spaceId, std::move(vertices))
-        .via(runner())
-        .ensure([deleteVertTime]() {
+    folly::Future<Status> future = folly::Future<Status>::makeEmpty();
+    if (chunks.value().empty()) {
+        future = qctx()->getStorageClient()->deleteVertices(spaceId, std::move(vertices))
+            .via(runner())
+            .then([this](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
+                SCOPED_TIMER(&execTime_);
+                addStorageMetrics(resp);
+                NG_RETURN_IF_ERROR(handleCompleteness(resp, true));
+                return Status::OK();
+            });
+    } else {
+        auto all = std::make_shared<const std::vector<VertexID>>(std::move(vertices));
+        future = writeChunks(std::move(chunks).value(),
+                             [this, spaceId, all](const WriteChunk &chunk) {
+            std::vector<VertexID> vids;
+            vids.reserve(chunk.indexes.size());
+            for (auto i : chunk.indexes) {
+                vids.emplace_back((*all)[i]);
+            }
+            return qctx()->getStorageClient()->deleteVertices(spaceId, std::move(vids));
+        });
+    }
+    return std::move(future).ensure(
+        [this, spaceId, cached = std::move(cached), deleteVertTime]() {
             VLOG(1) << "Delete vertices time: " << deleteVertTime.elapsedInUSec() << "us";
-        })
-        .then([this](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
-            SCOPED_TIMER(&execTime_);
-            NG_RETURN_IF_ERROR(handleCompleteness(resp, true));
-            return Status::OK();
+            auto *cache = qctx()->vertexCache();
+            auto *adjCache = qctx()->adjacencyCache();
+            for (auto &vid : cached) {
+                if (cache != nullptr) {
+                    cache->invalidate(spaceId, vid);
+                }
+                if (adjCache != nullptr) {
+                    adjCache->invalidate(spaceId, vid);
+                }
+            }
         });
 }
 
@@ -91,6 +144,8 @@ folly::Future<Status> DeleteEdgesExecutor::deleteEdges() {
             return Status::OK();
         }
         edgeKeys.reserve(iter->size());
+        // The out edges deleted, each with its in edge
+        std::unordered_set<storage::cpp2::EdgeKey, EdgeKeyHash> seen;
         QueryExpressionContext ctx(ectx_);
         for (; iter->valid(); iter->next()) {
             for (auto &edgeKeyRef : edgeKeyRefs) {
@@ -134,6 +189,9 @@ folly::Future<Status> DeleteEdgesExecutor::deleteEdges() {
                 edgeKey.set_dst(dstId.getStr());
                 edgeKey.set_ranking(rank.getInt());
                 edgeKey.set_edge_type(type.getInt());
+                if (!seen.emplace(edgeKey).second) {
+                    continue;
+                }
                 edgeKeys.emplace_back(edgeKey);
 
                 // in edge
@@ -151,17 +209,51 @@ folly::Future<Status> DeleteEdgesExecutor::deleteEdges() {
     }
 
     auto spaceId = qctx()->rctx()->session()->space();
+    // Both the out edge and in edge are deleted, so the src of keys covers all the endpoints
+    std::vector<VertexID> cached;
+    if (qctx()->adjacencyCache() != nullptr) {
+        cached.reserve(edgeKeys.size());
+        for (auto &edgeKey : edgeKeys) {
+            cached.emplace_back(edgeKey.get_src());
+        }
+    }
+    // The edges are stored in the partition of their source
+    auto chunks = chunkByParts(spaceId, edgeKeys.size(), [&edgeKeys](size_t i) -> const VertexID & {
+        return edgeKeys[i].get_src();
+    });
+    NG_RETURN_IF_ERROR(chunks);
     time::Duration deleteEdgeTime;
-    return qctx()->getStorageClient()->deleteEdges(spaceId, std::move(edgeKeys))
+    folly::Future<Status> future = folly::Future<Status>::makeEmpty();
+    if (chunks.value().empty()) {
+        future = qctx()->getStorageClient()->deleteEdges(spaceId, std::move(edgeKeys))
             .via(runner())
-            .ensure([deleteEdgeTime]() {
-                VLOG(1) << "Delete edge time: " << deleteEdgeTime.elapsedInUSec() << "us";
-            })
             .then([this](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
                 SCOPED_TIMER(&execTime_);
+                addStorageMetrics(resp);
                 NG_RETURN_IF_ERROR(handleCompleteness(resp, true));
                 return Status::OK();
             });
+    } else {
+        auto all = std::make_shared<const std::vector<storage::cpp2::EdgeKey>>(
+            std::move(edgeKeys));
+        future = writeChunks(std::move(chunks).value(),
+                             [this, spaceId, all](const WriteChunk &chunk) {
+            std::vector<storage::cpp2::EdgeKey> keys;
+            keys.reserve(chunk.indexes.size());
+            for (auto i : chunk.indexes) {
+                keys.emplace_back((*all)[i]);
+            }
+            return qctx()->getStorageClient()->deleteEdges(spaceId, std::move(keys));
+        });
+    }
+    return std::move(future).ensure(
+        [this, spaceId, cached = std::move(cached), deleteEdgeTime]() {
+            VLOG(1) << "Delete edge time: " << deleteEdgeTime.elapsedInUSec() << "us";
+            for (auto &vid : cached) {
+                qctx()->adjacencyCache()->invalidate(spaceId, vid);
+            }
+        });
 }
+
 }   // namespace graph
 }   // namespace nebula
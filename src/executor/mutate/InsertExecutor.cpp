@@ -8,6 +8,8 @@
 
 #include "planner/Mutate.h"
 #include "context/QueryContext.h"
+#include "executor/cache/AdjacencyCache.h"
+#include "executor/cache/VertexPropCache.h"
 #include "util/ScopedTimer.h"
 
 namespace nebula {
@@ -21,20 +23,58 @@ folly::Future<Status> InsertVerticesExecutor::insertVertices() {
     SCOPED_TIMER(&execTime_);
 
     auto *ivNode = asNode<InsertVertices>(node());
+    auto &vertices = ivNode->getVertices();
+    auto chunks = chunkByParts(
+        ivNode->getSpace(), vertices.size(), [&vertices](size_t i) -> const VertexID & {
+            return vertices[i].get_id();
+        });
+    NG_RETURN_IF_ERROR(chunks);
+
     time::Duration addVertTime;
-    return qctx()->getStorageClient()->addVertices(ivNode->getSpace(),
-                                                   ivNode->getVertices(),
-                                                   ivNode->getPropNames(),
-                                                   ivNode->getOverwritable())
-        .via(runner())
-        .ensure([addVertTime]() {
-            VLOG(1) << "Add vertices time: " << addVertTime.elapsedInUSec() << "us";
-        })
-        .then([this](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
-            SCOPED_TIMER(&execTime_);
-            NG_RETURN_IF_ERROR(handleCompleteness(resp, true));
-            return Status::OK();
+    folly::Future<Status> future = folly::Future<Status>::makeEmpty();
+    if (chunks.value().empty()) {
+        future = qctx()->getStorageClient()->addVertices(ivNode->getSpace(),
+                                                         vertices,
+                                                         ivNode->getPropNames(),
+                                                         ivNode->getOverwritable())
+            .via(runner())
+            .then([this](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
+                SCOPED_TIMER(&execTime_);
+                addStorageMetrics(resp);
+                NG_RETURN_IF_ERROR(handleCompleteness(resp, true));
+                return Status::OK();
+            });
+    } else {
+        future = writeChunks(std::move(chunks).value(), [this, ivNode](const WriteChunk &chunk) {
+            auto &all = ivNode->getVertices();
+            std::vector<storage::cpp2::NewVertex> vertices;
+            vertices.reserve(chunk.indexes.size());
+            for (auto i : chunk.indexes) {
+                vertices.emplace_back(all[i]);
+            }
+            return qctx()->getStorageClient()->addVertices(ivNode->getSpace(),
+                                                           std::move(vertices),
+                                                           ivNode->getPropNames(),
+                                                           ivNode->getOverwritable());
         });
+    }
+    return std::move(future).ensure([this, ivNode, addVertTime]() {
+        VLOG(1) << "Add vertices time: " << addVertTime.elapsedInUSec() << "us";
+        // Invalidate after the writes are done even if some of them failed,
+        // so that no stale props could be filled back into the cache
+        auto *cache = qctx()->vertexCache();
+        if (cache != nullptr) {
+            for (auto &vertex : ivNode->getVertices()) {
+                cache->invalidate(ivNode->getSpace(), vertex.get_id());
+            }
+        }
+        auto *adjCache = qctx()->adjacencyCache();
+        if (adjCache != nullptr) {
+            for (auto &vertex : ivNode->getVertices()) {
+                adjCache->invalidate(ivNode->getSpace(), vertex.get_id());
+            }
+        }
+    });
 }
 
 folly::Future<Status> InsertEdgesExecutor::execute() {
@@ -45,20 +85,53 @@ folly::Future<Status> InsertEdgesExecutor::insertEdges() {
     SCOPED_TIMER(&execTime_);
 
     auto *ieNode = asNode<InsertEdges>(node());
+    auto &edges = ieNode->getEdges();
+    // The edges are stored in the partition of their source
+    auto chunks = chunkByParts(
+        ieNode->getSpace(), edges.size(), [&edges](size_t i) -> const VertexID & {
+            return edges[i].get_key().get_src();
+        });
+    NG_RETURN_IF_ERROR(chunks);
+
     time::Duration addEdgeTime;
-    return qctx()->getStorageClient()->addEdges(ieNode->getSpace(),
-                                                ieNode->getEdges(),
-                                                ieNode->getPropNames(),
-                                                ieNode->getOverwritable())
+    folly::Future<Status> future = folly::Future<Status>::makeEmpty();
+    if (chunks.value().empty()) {
+        future = qctx()->getStorageClient()->addEdges(ieNode->getSpace(),
+                                                      edges,
+                                                      ieNode->getPropNames(),
+                                                      ieNode->getOverwritable())
             .via(runner())
-            .ensure([addEdgeTime]() {
-                VLOG(1) << "Add edge time: " << addEdgeTime.elapsedInUSec() << "us";
-            })
             .then([this](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
                 SCOPED_TIMER(&execTime_);
+                addStorageMetrics(resp);
                 NG_RETURN_IF_ERROR(handleCompleteness(resp, true));
                 return Status::OK();
             });
+    } else {
+        future = writeChunks(std::move(chunks).value(), [this, ieNode](const WriteChunk &chunk) {
+            auto &all = ieNode->getEdges();
+            std::vector<storage::cpp2::NewEdge> edges;
+            edges.reserve(chunk.indexes.size());
+            for (auto i : chunk.indexes) {
+                edges.emplace_back(all[i]);
+            }
+            return qctx()->getStorageClient()->addEdges(ieNode->getSpace(),
+                                                        std::move(edges),
+                                                        ieNode->getPropNames(),
+                                                        ieNode->getOverwritable());
+        });
+    }
+    return std::move(future).ensure([this, ieNode, addEdgeTime]() {
+        VLOG(1) << "Add edge time: " << addEdgeTime.elapsedInUSec() << "us";
+        auto *adjCache = qctx()->adjacencyCache();
+        if (adjCache != nullptr) {
+            for (auto &edge : ieNode->getEdges()) {
+                adjCache->invalidate(ieNode->getSpace(), edge.get_key().get_src());
+                adjCache->invalidate(ieNode->getSpace(), edge.get_key().get_dst());
+            }
+        }
+    });
 }
+
 }   // namespace graph
 }   // namespace nebula
@@ -5,15 +5,47 @@
  */
 
 #include "UpdateExecutor.h"
+
+#include <numeric>
+
+#include <folly/futures/helpers.h>
+
 #include "planner/Mutate.h"
+#include "util/ExpressionUtils.h"
 #include "util/SchemaUtil.h"
 #include "context/QueryContext.h"
+#include "context/QueryExpressionContext.h"
+#include "executor/cache/AdjacencyCache.h"
+#include "executor/cache/VertexPropCache.h"
+#include "service/GraphFlags.h"
 #include "util/ScopedTimer.h"
+#include "visitor/RewriteInputPropVisitor.h"
 
 
 namespace nebula {
 namespace graph {
 
+namespace {
+
+std::unique_ptr<Expression> decodeIfInput(const std::string &encoded) {
+    if (encoded.empty()) {
+        return nullptr;
+    }
+    auto expr = Expression::decode(encoded);
+    if (!ExpressionUtils::hasAny(expr.get(),
+                                 {Expression::Kind::kInputProperty,
+                                  Expression::Kind::kVarProperty})) {
+        return nullptr;
+    }
+    return expr;
+}
+
+std::string bindExpr(const Expression *expr, ExpressionContext &ctx) {
+    return RewriteInputPropVisitor::rewrite(expr->clone(), ctx)->encode();
+}
+
+}   // namespace
+
 StatusOr<DataSet> UpdateBaseExecutor::handleResult(DataSet &&data) {
     if (data.colNames.size() <= 1) {
         if (yieldNames_.empty()) {
@@ -29,7 +61,7 @@ StatusOr<DataSet> UpdateBaseExecutor::handleResult(DataSet &&data) {
         return Status::Error("Wrong return prop size");
     }
     DataSet result;
-    result.colNames = std::move(yieldNames_);
+    result.colNames = yieldNames_;
     for (auto &row : data.rows) {
         std::vector<Value> columns;
         for (auto i = 1u; i < row.values.size(); i++) {
@@ -40,10 +72,116 @@ StatusOr<DataSet> UpdateBaseExecutor::handleResult(DataSet &&data) {
     return result;
 }
 
+void UpdateBaseExecutor::decodeInputExprs(const Update *node) {
+    for (auto &prop : node->getUpdatedProps()) {
+        updatedPropExprs_.emplace_back(decodeIfInput(prop.get_value()));
+    }
+    for (auto &prop : node->getReturnProps()) {
+        returnPropExprs_.emplace_back(decodeIfInput(prop));
+    }
+    conditionExpr_ = decodeIfInput(node->getCondition());
+}
+
+void UpdateBaseExecutor::bindRow(const Update *node,
+                                 ExpressionContext &ctx,
+                                 RowUpdate *row) const {
+    row->updatedProps = node->getUpdatedProps();
+    for (size_t i = 0; i < updatedPropExprs_.size(); ++i) {
+        if (updatedPropExprs_[i] != nullptr) {
+            row->updatedProps[i].set_value(bindExpr(updatedPropExprs_[i].get(), ctx));
+        }
+    }
+    row->returnProps = node->getReturnProps();
+    for (size_t i = 0; i < returnPropExprs_.size(); ++i) {
+        if (returnPropExprs_[i] != nullptr) {
+            row->returnProps[i] = bindExpr(returnPropExprs_[i].get(), ctx);
+        }
+    }
+    row->condition = conditionExpr_ != nullptr ? bindExpr(conditionExpr_.get(), ctx)
+                                               : node->getCondition();
+}
+
+folly::Future<Status> UpdateBaseExecutor::updateRows(std::vector<RowUpdate> rows,
+                                                     RowUpdater update) {
+    auto shared = std::make_shared<const std::vector<RowUpdate>>(std::move(rows));
+    std::vector<size_t> ids(shared->size());
+    std::iota(ids.begin(), ids.end(), 0);
+    auto concurrency = static_cast<size_t>(std::max(FLAGS_update_concurrency, 1));
+    auto futures = folly::window(
+        std::move(ids),
+        [this, shared, update](size_t i) -> folly::Future<UpdateResp> {
+            // Stop sending the rest rows once the query is cancelled
+            auto cancelled = qctx()->checkCancelled();
+            if (!cancelled.ok()) {
+                return folly::makeFuture<UpdateResp>(std::move(cancelled));
+            }
+            return update((*shared)[i]);
+        },
+        concurrency);
+    return folly::collectAll(futures).via(runner()).then(
+        [this, shared](std::vector<folly::Try<UpdateResp>> &&results) {
+            SCOPED_TIMER(&execTime_);
+            DataSet ds;
+            ds.colNames = yieldNames_;
+            size_t numFailed = 0;
+            Status error;
+            for (auto &result : results) {
+                auto status = Status::OK();
+                if (result.hasException()) {
+                    status = Status::Error("%s", result.exception().what().c_str());
+                } else if (!result.value().ok()) {
+                    status = result.value().status();
+                } else {
+                    auto value = std::move(result.value()).value();
+                    for (auto &code : value.get_result().get_failed_parts()) {
+                        status = handleErrorCode(code.get_code(), code.get_part_id());
+                        if (!status.ok()) {
+                            break;
+                        }
+                    }
+                    if (status.ok() && value.__isset.props && !yieldNames_.empty()) {
+                        auto data = handleResult(std::move(*value.get_props()));
+                        if (data.ok()) {
+                            auto yielded = std::move(data).value();
+                            ds.rows.insert(ds.rows.end(),
+                                           std::make_move_iterator(yielded.rows.begin()),
+                                           std::make_move_iterator(yielded.rows.end()));
+                        } else {
+                            status = data.status();
+                        }
+                    }
+                }
+                if (!status.ok()) {
+                    numFailed++;
+                    error = std::move(status);
+                }
+            }
+            if (numFailed > 0) {
+                // The rows updated are kept
+                LOG(ERROR) << name_ << " failed to update " << numFailed << " of "
+                           << results.size() << " rows: " << error;
+                return Status::Error("Failed to update %lu of %lu rows: %s",
+                                     numFailed,
+                                     results.size(),
+                                     error.toString().c_str());
+            }
+            if (yieldNames_.empty()) {
+                return Status::OK();
+            }
+            return finish(ResultBuilder()
+                              .value(Value(std::move(ds)))
+                              .iter(Iterator::Kind::kDefault)
+                              .finish());
+        });
+}
+
 folly::Future<Status> UpdateVertexExecutor::execute() {
     SCOPED_TIMER(&execTime_);
     auto *uvNode = asNode<UpdateVertex>(node());
     yieldNames_ = uvNode->getYieldNames();
+    if (uvNode->getVidRef() != nullptr) {
+        return updateVertices(uvNode);
+    }
     time::Duration updateVertTime;
     return qctx()->getStorageClient()->updateVertex(uvNode->getSpaceId(),
                                                     uvNode->getVId(),
@@ -53,8 +191,16 @@ folly::Future<Status> UpdateVertexExecutor::execute() {
                                                     uvNode->getReturnProps(),
                                                     uvNode->getCondition())
         .via(runner())
-        .ensure([updateVertTime]() {
+        .ensure([this, uvNode, updateVertTime]() {
             VLOG(1) << "Update vertice time: " << updateVertTime.elapsedInUSec() << "us";
+            auto *cache = qctx()->vertexCache();
+            if (cache != nullptr) {
+                cache->invalidate(uvNode->getSpaceId(), uvNode->getVId(), uvNode->getTagId());
+            }
+            auto *adjCache = qctx()->adjacencyCache();
+            if (adjCache != nullptr) {
+                adjCache->invalidate(uvNode->getSpaceId(), uvNode->getVId());
+            }
         })
         .then([this](StatusOr<storage::cpp2::UpdateResponse> resp) {
             SCOPED_TIMER(&execTime_);
@@ -80,9 +226,59 @@ folly::Future<Status> UpdateVertexExecutor::execute() {
         });
 }
 
+folly::Future<Status> UpdateVertexExecutor::updateVertices(const UpdateVertex *uvNode) {
+    decodeInputExprs(uvNode);
+    auto iter = ectx_->getResult(uvNode->inputVar()).iter();
+    std::vector<RowUpdate> rows;
+    rows.reserve(iter->size());
+    QueryExpressionContext ctx(ectx_);
+    size_t numRows = 0;
+    for (; iter->valid(); iter->next()) {
+        NG_RETURN_IF_ERROR(checkCancelled(++numRows));
+        auto vid = Expression::eval(uvNode->getVidRef(), ctx(iter.get()));
+        if (vid.isNull() || vid.empty()) {
+            VLOG(3) << "NULL or EMPTY vid";
+            continue;
+        }
+        if (!vid.isStr()) {
+            std::stringstream ss;
+            ss << "Wrong vid type `" << vid.type() << "', value `" << vid.toString() << "'";
+            return Status::Error(ss.str());
+        }
+        RowUpdate row;
+        row.vid = vid.moveStr();
+        bindRow(uvNode, ctx(iter.get()), &row);
+        rows.emplace_back(std::move(row));
+    }
+    return updateRows(std::move(rows), [this, uvNode](const RowUpdate &row) {
+        return qctx()->getStorageClient()->updateVertex(uvNode->getSpaceId(),
+                                                        row.vid,
+                                                        uvNode->getTagId(),
+                                                        row.updatedProps,
+                                                        uvNode->getInsertable(),
+                                                        row.returnProps,
+                                                        row.condition)
+            .via(runner())
+            .ensure([this, uvNode, &row]() {
+                auto *cache = qctx()->vertexCache();
+                if (cache != nullptr) {
+                    cache->invalidate(uvNode->getSpaceId(), row.vid, uvNode->getTagId());
+                }
+                auto *adjCache = qctx()->adjacencyCache();
+                if (adjCache != nullptr) {
+                    adjCache->invalidate(uvNode->getSpaceId(), row.vid);
+                }
+            });
+    });
+}
+
 folly::Future<Status> UpdateEdgeExecutor::execute() {
     SCOPED_TIMER(&execTime_);
     auto *ueNode = asNode<UpdateEdge>(node());
+    if (ueNode->getEdgeKeyRef() != nullptr) {
+        yieldNames_ = ueNode->getYieldNames();
+        return updateEdges(ueNode);
+    }
     storage::cpp2::EdgeKey edgeKey;
     edgeKey.set_src(ueNode->getSrcId());
     edgeKey.set_ranking(ueNode->getRank());
@@ -98,8 +294,13 @@ folly::Future<Status> UpdateEdgeExecutor::execute() {
                                                   ueNode->getReturnProps(),
                                                   ueNode->getCondition())
             .via(runner())
-            .ensure([updateEdgeTime]() {
+            .ensure([this, ueNode, updateEdgeTime]() {
                 VLOG(1) << "Update edge time: " << updateEdgeTime.elapsedInUSec() << "us";
+                auto *adjCache = qctx()->adjacencyCache();
+                if (adjCache != nullptr) {
+                    adjCache->invalidate(ueNode->getSpaceId(), ueNode->getSrcId());
+                    adjCache->invalidate(ueNode->getSpaceId(), ueNode->getDstId());
+                }
             })
             .then([this](StatusOr<storage::cpp2::UpdateResponse> resp) {
                 SCOPED_TIMER(&execTime_);
@@ -124,5 +325,69 @@ folly::Future<Status> UpdateEdgeExecutor::execute() {
                 return Status::OK();
             });
 }
+
+folly::Future<Status> UpdateEdgeExecutor::updateEdges(const UpdateEdge *ueNode) {
+    decodeInputExprs(ueNode);
+    auto *edgeKeyRef = ueNode->getEdgeKeyRef();
+    // The reversed edge is keyed by the destination
+    auto reversed = ueNode->getEdgeType() < 0;
+    auto iter = ectx_->getResult(ueNode->inputVar()).iter();
+    std::vector<RowUpdate> rows;
+    rows.reserve(iter->size());
+    QueryExpressionContext ctx(ectx_);
+    size_t numRows = 0;
+    for (; iter->valid(); iter->next()) {
+        NG_RETURN_IF_ERROR(checkCancelled(++numRows));
+        auto srcId = Expression::eval(edgeKeyRef->srcid(), ctx(iter.get()));
+        if (srcId.isNull() || srcId.empty()) {
+            VLOG(3) << "NULL or EMPTY vid";
+            continue;
+        }
+        if (!srcId.isStr()) {
+            std::stringstream ss;
+            ss << "Wrong srcId type `" << srcId.type()
+               << "', value `" << srcId.toString() << "'";
+            return Status::Error(ss.str());
+        }
+        auto dstId = Expression::eval(edgeKeyRef->dstid(), ctx(iter.get()));
+        if (!dstId.isStr()) {
+            std::stringstream ss;
+            ss << "Wrong dstId type `" << dstId.type()
+               << "', value `" << dstId.toString() << "'";
+            return Status::Error(ss.str());
+        }
+        auto rank = Expression::eval(edgeKeyRef->rank(), ctx(iter.get()));
+        if (!rank.isInt()) {
+            std::stringstream ss;
+            ss << "Wrong rank type `" << rank.type()
+               << "', value `" << rank.toString() << "'";
+            return Status::Error(ss.str());
+        }
+        RowUpdate row;
+        row.edgeKey.set_src(reversed ? dstId.moveStr() : srcId.moveStr());
+        row.edgeKey.set_dst(reversed ? srcId.moveStr() : dstId.moveStr());
+        row.edgeKey.set_ranking(rank.getInt());
+        row.edgeKey.set_edge_type(ueNode->getEdgeType());
+        bindRow(ueNode, ctx(iter.get()), &row);
+        rows.emplace_back(std::move(row));
+    }
+    return updateRows(std::move(rows), [this, ueNode](const RowUpdate &row) {
+        return qctx()->getStorageClient()->updateEdge(ueNode->getSpaceId(),
+                                                      row.edgeKey,
+                                                      row.updatedProps,
+                                                      ueNode->getInsertable(),
+                                                      row.returnProps,
+                                                      row.condition)
+            .via(runner())
+            .ensure([this, ueNode, &row]() {
+                auto *adjCache = qctx()->adjacencyCache();
+                if (adjCache != nullptr) {
+                    adjCache->invalidate(ueNode->getSpaceId(), row.edgeKey.get_src());
+                    adjCache->invalidate(ueNode->getSpaceId(), row.edgeKey.get_dst());
+                }
+            });
+    });
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -9,6 +9,7 @@
 
 #include "common/base/StatusOr.h"
 #include "executor/QueryStorageExecutor.h"
+#include "planner/Mutate.h"
 
 namespace nebula {
 namespace graph {
@@ -23,10 +24,36 @@ public:
     virtual ~UpdateBaseExecutor() {}
 
 protected:
+    // The update of the vertex or the edge of one row of the input of a piped update
+    struct RowUpdate {
+        VertexID                                     vid;
+        storage::cpp2::EdgeKey                       edgeKey;
+        std::vector<storage::cpp2::UpdatedProp>      updatedProps;
+        std::vector<std::string>                     returnProps;
+        std::string                                  condition;
+    };
+
+    using UpdateResp = StatusOr<storage::cpp2::UpdateResponse>;
+    using RowUpdater = std::function<folly::Future<UpdateResp>(const RowUpdate &)>;
+
     StatusOr<DataSet> handleResult(DataSet &&data);
 
+    // Decode the expressions of the update referring to the input once for all the rows
+    void decodeInputExprs(const Update *node);
+
+    // Bind the properties of the input referred by the update to the current row
+    void bindRow(const Update *node, ExpressionContext &ctx, RowUpdate *row) const;
+
+    // Send at most `--update_concurrency' updates at the same time, with the rows yielded
+    // by all of them in one result
+    folly::Future<Status> updateRows(std::vector<RowUpdate> rows, RowUpdater update);
+
 protected:
     std::vector<std::string>         yieldNames_;
+    // The expressions referring to the input decoded, null for the others sent as they are
+    std::vector<std::unique_ptr<Expression>>       updatedPropExprs_;
+    std::vector<std::unique_ptr<Expression>>       returnPropExprs_;
+    std::unique_ptr<Expression>                    conditionExpr_;
 };
 
 class UpdateVertexExecutor final : public UpdateBaseExecutor {
@@ -35,6 +62,9 @@ public:
         : UpdateBaseExecutor("UpdateVertexExecutor", node, ectx) {}
 
     folly::Future<Status> execute() override;
+
+private:
+    folly::Future<Status> updateVertices(const UpdateVertex *uvNode);
 };
 
 class UpdateEdgeExecutor final : public UpdateBaseExecutor {
@@ -43,6 +73,9 @@ public:
         : UpdateBaseExecutor("UpdateEdgeExecutor", node, ectx) {}
 
     folly::Future<Status> execute() override;
+
+private:
+    folly::Future<Status> updateEdges(const UpdateEdge *ueNode);
 };
 
 }   // namespace graph
@@ -27,7 +27,8 @@ folly::Future<Status> AggregateExecutor::execute() {
     QueryExpressionContext ctx(ectx_);
 
     std::unordered_map<List, std::vector<std::unique_ptr<AggFun>>> result;
-    for (; iter->valid(); iter->next()) {
+    for (size_t rows = 0; iter->valid(); iter->next()) {
+        NG_RETURN_IF_ERROR(checkCancelled(++rows));
         List list;
         for (auto& key : groupKeys) {
             list.values.emplace_back(key->eval(ctx(iter.get())));
@@ -52,6 +53,7 @@ folly::Future<Status> AggregateExecutor::execute() {
         }
     }
 
+    stats_.hashTableSize = result.size();
     DataSet ds;
     ds.colNames = agg->colNames();
     ds.rows.reserve(result.size());
@@ -0,0 +1,60 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/query/CursorExecutor.h"
+
+#include "context/QueryContext.h"
+#include "executor/ExecStats.h"
+#include "planner/Query.h"
+#include "util/ScopedTimer.h"
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> DeclareCursorExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    auto *declare = asNode<DeclareCursor>(node());
+    // The cursor is the only reader of its input, so the rows are moved rather than copied
+    auto value = ectx_->getResult(declare->inputVar()).valuePtr();
+    if (!value->isDataSet()) {
+        return Status::Error("The query of cursor `%s' returns no rows",
+                             declare->name().c_str());
+    }
+    auto *session = qctx()->rctx()->session();
+    auto bytes = ExecStats::estimateBytes(*value);
+    NG_RETURN_IF_ERROR(session->addCursor(declare->name(), value->moveDataSet(), bytes));
+
+    // The first page is returned at once
+    auto page = session->fetchCursor(declare->name(), declare->count());
+    NG_RETURN_IF_ERROR(page);
+    return finish(ResultBuilder()
+                      .value(Value(std::move(page).value()))
+                      .iter(Iterator::Kind::kSequential)
+                      .finish());
+}
+
+folly::Future<Status> FetchCursorExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    auto *fetch = asNode<FetchCursor>(node());
+    auto page = qctx()->rctx()->session()->fetchCursor(fetch->name(), fetch->count());
+    NG_RETURN_IF_ERROR(page);
+    return finish(ResultBuilder()
+                      .value(Value(std::move(page).value()))
+                      .iter(Iterator::Kind::kSequential)
+                      .finish());
+}
+
+folly::Future<Status> CloseCursorExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    auto *close = asNode<CloseCursor>(node());
+    return qctx()->rctx()->session()->removeCursor(close->name());
+}
+
+}   // namespace graph
+}   // namespace nebula
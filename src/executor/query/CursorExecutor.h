@@ -0,0 +1,42 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_QUERY_CURSOREXECUTOR_H_
+#define EXECUTOR_QUERY_CURSOREXECUTOR_H_
+
+#include "executor/Executor.h"
+
+namespace nebula {
+namespace graph {
+
+class DeclareCursorExecutor final : public Executor {
+public:
+    DeclareCursorExecutor(const PlanNode *node, QueryContext *qctx)
+        : Executor("DeclareCursorExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+};
+
+class FetchCursorExecutor final : public Executor {
+public:
+    FetchCursorExecutor(const PlanNode *node, QueryContext *qctx)
+        : Executor("FetchCursorExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+};
+
+class CloseCursorExecutor final : public Executor {
+public:
+    CloseCursorExecutor(const PlanNode *node, QueryContext *qctx)
+        : Executor("CloseCursorExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_QUERY_CURSOREXECUTOR_H_
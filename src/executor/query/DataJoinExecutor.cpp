@@ -61,11 +61,11 @@ folly::Future<Status> DataJoinExecutor::doInnerJoin() {
     if (!(lhsIter->empty() || rhsIter->empty())) {
         if (lhsIter->size() < rhsIter->size()) {
             buildHashTable(dataJoin->hashKeys(), lhsIter.get());
-            probe(dataJoin->probeKeys(), rhsIter.get(), resultIter.get());
+            NG_RETURN_IF_ERROR(probe(dataJoin->probeKeys(), rhsIter.get(), resultIter.get()));
         } else {
             exchange_ = true;
             buildHashTable(dataJoin->probeKeys(), rhsIter.get());
-            probe(dataJoin->hashKeys(), lhsIter.get(), resultIter.get());
+            NG_RETURN_IF_ERROR(probe(dataJoin->hashKeys(), lhsIter.get(), resultIter.get()));
         }
     }
     return finish(ResultBuilder().iter(std::move(resultIter)).finish());
@@ -84,13 +84,15 @@ void DataJoinExecutor::buildHashTable(const std::vector<Expression*>& hashKeys,
 
         VLOG(1) << "key: " << list;
         hashTable_->add(std::move(list), iter->row());
+        stats_.hashTableSize++;
     }
 }
 
-void DataJoinExecutor::probe(const std::vector<Expression*>& probeKeys,
-                             Iterator* probeIter, JoinIter* resultIter) {
+Status DataJoinExecutor::probe(const std::vector<Expression*>& probeKeys,
+                               Iterator* probeIter, JoinIter* resultIter) {
     QueryExpressionContext ctx(ectx_);
-    for (; probeIter->valid(); probeIter->next()) {
+    for (size_t rows = 0; probeIter->valid(); probeIter->next()) {
+        NG_RETURN_IF_ERROR(checkCancelled(++rows));
         List list;
         list.values.reserve(probeKeys.size());
         for (auto& col : probeKeys) {
@@ -119,6 +121,7 @@ void DataJoinExecutor::probe(const std::vector<Expression*>& probeKeys,
             resultIter->addRow(std::move(newRow));
         }
     }
+    return Status::OK();
 }
 }  // namespace graph
 }  // namespace nebula
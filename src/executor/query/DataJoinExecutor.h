@@ -57,8 +57,8 @@ private:
 
     void buildHashTable(const std::vector<Expression*>& hashKeys, Iterator* iter);
 
-    void probe(const std::vector<Expression*>& probeKeys, Iterator* probeiter,
-               JoinIter* resultIter);
+    Status probe(const std::vector<Expression*>& probeKeys, Iterator* probeiter,
+                 JoinIter* resultIter);
 
 private:
     bool                         exchange_{false};
@@ -37,6 +37,7 @@ folly::Future<Status> DedupExecutor::execute() {
             iter->next();
         }
     }
+    stats_.hashTableSize = unique.size();
     iter->reset();
     builder.iter(std::move(iter));
     return finish(builder.finish());
@@ -31,7 +31,9 @@ folly::Future<Status> FilterExecutor::execute() {
     builder.value(iter->valuePtr());
     QueryExpressionContext ctx(ectx_);
     auto condition = filter->condition();
+    size_t rows = 0;
     while (iter->valid()) {
+        NG_RETURN_IF_ERROR(checkCancelled(++rows));
         auto val = condition->eval(ctx(iter.get()));
         if (!val.isBool() && !val.isNull()) {
             return Status::Error("Internal Error: Wrong type result, "
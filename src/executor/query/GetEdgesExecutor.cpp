@@ -54,6 +54,34 @@ folly::Future<Status> GetEdgesExecutor::getEdges() {
         return finish(ResultBuilder().value(Value(DataSet(ge->colNames()))).finish());
     }
 
+    if (ge->orderBy().empty() && ge->limit() == std::numeric_limits<int64_t>::max()) {
+        // The edges are stored in the partition of the src
+        auto slices = sliceByParts(ge->space(), edges.rows, 0);
+        if (!slices.ok()) {
+            return error(std::move(slices).status());
+        }
+        if (!slices.value().empty()) {
+            return getPropsSliced(
+                std::move(slices).value(),
+                edges.colNames,
+                [ge, client](nebula::DataSet ds) {
+                    return DCHECK_NOTNULL(client)
+                        ->getProps(ge->space(),
+                                   std::move(ds),
+                                   nullptr,
+                                   &ge->props(),
+                                   ge->exprs().empty() ? nullptr : &ge->exprs(),
+                                   ge->dedup(),
+                                   ge->orderBy(),
+                                   ge->limit(),
+                                   ge->filter());
+                },
+                [this, ge](nebula::DataSet &&v, Result::State state) {
+                    return finishProps(std::move(v), ge->colNamesRef(), state);
+                });
+        }
+    }
+
     time::Duration getPropsTime;
     return DCHECK_NOTNULL(client)
         ->getProps(ge->space(),
@@ -71,6 +99,7 @@ folly::Future<Status> GetEdgesExecutor::getEdges() {
         })
         .then([this, ge](StorageRpcResponse<GetPropResponse> &&rpcResp) {
             SCOPED_TIMER(&execTime_);
+            addStorageMetrics(rpcResp);
             return handleResp(std::move(rpcResp), ge->colNamesRef());
         });
 }
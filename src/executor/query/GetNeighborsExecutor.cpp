@@ -32,6 +32,7 @@ folly::Future<Status> GetNeighborsExecutor::execute() {
 Status GetNeighborsExecutor::close() {
     // clear the members
     reqDs_.rows.clear();
+    cachedDs_ = DataSet();
     return Executor::close();
 }
 
@@ -70,6 +71,31 @@ folly::Future<Status> GetNeighborsExecutor::getNeighbors() {
                           .finish());
     }
 
+    auto* adjCache = qctx_->adjacencyCache();
+    if (adjCache != nullptr && AdjacencyCache::canCache(gn_)) {
+        lookupAdjacencyCache(adjCache);
+        if (reqDs_.rows.empty()) {
+            return finishNeighbors(List(), Result::State::kSuccess);
+        }
+    }
+
+    auto* coalescer = qctx_->storageCoalescer();
+    if (coalescer != nullptr && StorageRequestCoalescer::canCoalesce(gn_)) {
+        return getNeighborsCoalesced(coalescer);
+    }
+
+    // The rows of each vertex don't depend on the others, so the request could be sliced
+    if (!gn_->random() && gn_->orderBy().empty() &&
+        gn_->limit() == std::numeric_limits<int64_t>::max()) {
+        auto slices = sliceByParts(gn_->space(), reqDs_.rows, 0);
+        if (!slices.ok()) {
+            return error(std::move(slices).status());
+        }
+        if (!slices.value().empty()) {
+            return getNeighborsSliced(std::move(slices).value());
+        }
+    }
+
     time::Duration getNbrTime;
     GraphStorageClient* storageClient = qctx_->getStorageClient();
     return storageClient
@@ -93,15 +119,95 @@ folly::Future<Status> GetNeighborsExecutor::getNeighbors() {
         })
         .then([this](StorageRpcResponse<GetNeighborsResponse>&& resp) {
             SCOPED_TIMER(&execTime_);
+            addStorageMetrics(resp);
             return handleResponse(resp);
         });
 }
 
+folly::Future<Status> GetNeighborsExecutor::getNeighborsCoalesced(
+    StorageRequestCoalescer* coalescer) {
+    std::unordered_set<Value> vids;
+    vids.reserve(reqDs_.rows.size());
+    for (auto& row : reqDs_.rows) {
+        vids.emplace(row.values.front());
+    }
+
+    time::Duration getNbrTime;
+    return coalescer->getNeighbors(gn_, reqDs_.rows)
+        .via(runner())
+        .ensure([getNbrTime]() {
+            VLOG(1) << "Get neighbors coalesced time: " << getNbrTime.elapsedInUSec() << "us";
+        })
+        .then([this, vids = std::move(vids)](std::shared_ptr<RpcResponse> resps) {
+            SCOPED_TIMER(&execTime_);
+            addStorageMetrics(*resps);
+            // The response is shared with other queries, only the partitions of the requested
+            // vertices count, and only the requested vertices are picked
+            auto result =
+                coalescedCompleteness(resps->failedParts(), gn_->space(), reqDs_.rows, 0);
+            NG_RETURN_IF_ERROR(result);
+
+            List list;
+            for (auto& resp : resps->responses()) {
+                auto dataset = resp.get_vertices();
+                if (dataset == nullptr) {
+                    continue;
+                }
+                auto picked = StorageRequestCoalescer::pick(*dataset, vids);
+                if (!picked.rows.empty()) {
+                    list.values.emplace_back(std::move(picked));
+                }
+            }
+            return finishNeighbors(std::move(list), result.value());
+        });
+}
+
+folly::Future<Status> GetNeighborsExecutor::getNeighborsSliced(
+    std::vector<std::vector<Row>> slices) {
+    time::Duration getNbrTime;
+    GraphStorageClient* storageClient = qctx_->getStorageClient();
+    std::vector<folly::Future<RpcResponse>> futures;
+    futures.reserve(slices.size());
+    for (auto& rows : slices) {
+        futures.emplace_back(storageClient->getNeighbors(gn_->space(),
+                                                         {kVid},
+                                                         std::move(rows),
+                                                         gn_->edgeTypes(),
+                                                         gn_->edgeDirection(),
+                                                         gn_->statProps(),
+                                                         gn_->vertexProps(),
+                                                         gn_->edgeProps(),
+                                                         gn_->exprs(),
+                                                         gn_->dedup(),
+                                                         gn_->random(),
+                                                         gn_->orderBy(),
+                                                         gn_->limit(),
+                                                         gn_->filter()));
+    }
+
+    auto list = std::make_shared<List>();
+    return collectSlices<GetNeighborsResponse>(
+        std::move(futures),
+        [list](RpcResponse& resps) {
+            for (auto& resp : resps.responses()) {
+                auto dataset = resp.get_vertices();
+                if (dataset == nullptr) {
+                    LOG(INFO) << "Empty dataset in response";
+                    continue;
+                }
+                list->values.emplace_back(std::move(*dataset));
+            }
+            return true;
+        },
+        [this, list, getNbrTime](Result::State state) {
+            VLOG(1) << "Get neighbors sliced time: " << getNbrTime.elapsedInUSec() << "us";
+            return finishNeighbors(std::move(*list), state);
+        });
+}
+
 Status GetNeighborsExecutor::handleResponse(RpcResponse& resps) {
     auto result = handleCompleteness(resps, false);
     NG_RETURN_IF_ERROR(result);
-    ResultBuilder builder;
-    builder.state(result.value());
 
     auto& responses = resps.responses();
     VLOG(1) << "Resp size: " << responses.size();
@@ -116,8 +222,50 @@ Status GetNeighborsExecutor::handleResponse(RpcResponse& resps) {
         VLOG(1) << "Resp row size: " << dataset->rows.size() << "Resp : " << *dataset;
         list.values.emplace_back(std::move(*dataset));
     }
-    builder.value(Value(std::move(list)));
-    return finish(builder.iter(Iterator::Kind::kGetNeighbors).finish());
+    return finishNeighbors(std::move(list), result.value());
+}
+
+void GetNeighborsExecutor::lookupAdjacencyCache(AdjacencyCache* cache) {
+    adjCache_ = cache;
+    adjEpoch_ = cache->epoch();
+    adjSignature_ = AdjacencyCache::signature(gn_);
+    std::vector<Row> missed;
+    for (auto& row : reqDs_.rows) {
+        auto cached = cache->get(gn_->space(), row.values.front(), adjSignature_);
+        if (cached != nullptr) {
+            if (cachedDs_.colNames.empty()) {
+                cachedDs_.colNames = cached->colNames;
+            }
+            // All the rows of the same request signature share the same columns
+            if (cachedDs_.colNames == cached->colNames) {
+                cachedDs_.rows.insert(cachedDs_.rows.end(),
+                                      cached->rows.begin(),
+                                      cached->rows.end());
+                continue;
+            }
+        }
+        missed.emplace_back(std::move(row));
+    }
+    VLOG(1) << "Adjacency cache hits " << cachedDs_.rows.size() << ", misses "
+            << missed.size();
+    reqDs_.rows = std::move(missed);
+}
+
+Status GetNeighborsExecutor::finishNeighbors(List&& list, Result::State state) {
+    if (adjCache_ != nullptr) {
+        for (auto& value : list.values) {
+            adjCache_->put(gn_->space(), value.getDataSet(), adjSignature_, adjEpoch_);
+        }
+        if (!cachedDs_.rows.empty()) {
+            list.values.emplace_back(std::move(cachedDs_));
+            cachedDs_ = DataSet();
+        }
+    }
+    return finish(ResultBuilder()
+                      .value(Value(std::move(list)))
+                      .iter(Iterator::Kind::kGetNeighbors)
+                      .state(state)
+                      .finish());
 }
 
 }   // namespace graph
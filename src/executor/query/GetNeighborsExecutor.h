@@ -16,6 +16,8 @@
 #include "common/clients/storage/GraphStorageClient.h"
 
 #include "executor/QueryStorageExecutor.h"
+#include "executor/StorageRequestCoalescer.h"
+#include "executor/cache/AdjacencyCache.h"
 #include "planner/Query.h"
 
 namespace nebula {
@@ -37,12 +39,29 @@ private:
 
     folly::Future<Status> getNeighbors();
 
+    // Share one storage request with the concurrent queries exploring the same edges
+    folly::Future<Status> getNeighborsCoalesced(StorageRequestCoalescer* coalescer);
+
+    // Request each slice of the vertices separately and collect the responses as they arrive
+    folly::Future<Status> getNeighborsSliced(std::vector<std::vector<Row>> slices);
+
     using RpcResponse = storage::StorageRpcResponse<storage::cpp2::GetNeighborsResponse>;
     Status handleResponse(RpcResponse& resps);
 
+    // Move the cached supernodes out of the request to `cachedDs_'
+    void lookupAdjacencyCache(AdjacencyCache* cache);
+
+    // Cache the supernodes in `list' and append the cached ones
+    Status finishNeighbors(List&& list, Result::State state);
+
 private:
     DataSet               reqDs_;
     const GetNeighbors*   gn_;
+    AdjacencyCache*       adjCache_{nullptr};
+    std::string           adjSignature_;
+    // Taken before the request, to drop the rows of the vertices invalidated meanwhile
+    uint64_t              adjEpoch_{0};
+    DataSet               cachedDs_;
 };
 
 }   // namespace graph
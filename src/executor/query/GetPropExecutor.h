@@ -20,22 +20,115 @@ protected:
 
     Status handleResp(storage::StorageRpcResponse<storage::cpp2::GetPropResponse> &&rpcResp,
                       const std::vector<std::string> &colNames) {
+        nebula::DataSet v;
+        auto result = collectResp(std::move(rpcResp), &v);
+        NG_RETURN_IF_ERROR(result);
+        return finishProps(std::move(v), colNames, std::move(result).value());
+    }
+
+    // Merge the DataSets of all the responses to `v'
+    StatusOr<Result::State> collectResp(
+        storage::StorageRpcResponse<storage::cpp2::GetPropResponse> &&rpcResp,
+        nebula::DataSet *v) {
         auto result = handleCompleteness(rpcResp, false);
         NG_RETURN_IF_ERROR(result);
         auto state = std::move(result).value();
-        // Ok, merge DataSets to one
-        nebula::DataSet v;
+        if (!appendProps(rpcResp, v)) {
+            state = Result::State::kPartialSuccess;
+        }
+        return state;
+    }
+
+    // Append the DataSets of the responses to `v', return false if some of them are missing
+    bool appendProps(storage::StorageRpcResponse<storage::cpp2::GetPropResponse> &rpcResp,
+                     nebula::DataSet *v) {
+        bool complete = true;
         for (auto &resp : rpcResp.responses()) {
             if (resp.__isset.props) {
-                if (UNLIKELY(!v.append(std::move(*resp.get_props())))) {
+                if (UNLIKELY(!v->append(std::move(*resp.get_props())))) {
                     // it's impossible according to the interface
                     LOG(WARNING) << "Heterogeneous props dataset";
-                    state = Result::State::kPartialSuccess;
+                    complete = false;
                 }
             } else {
-                state = Result::State::kPartialSuccess;
+                complete = false;
+            }
+        }
+        return complete;
+    }
+
+    // Request each slice of `rows' by `fetch' separately, the props are merged as soon as
+    // the response of each slice arrives and passed to `onFinish' after the last one.
+    folly::Future<Status> getPropsSliced(
+        std::vector<std::vector<Row>> slices,
+        const std::vector<std::string> &reqColNames,
+        std::function<folly::Future<storage::StorageRpcResponse<storage::cpp2::GetPropResponse>>(
+            nebula::DataSet)> fetch,
+        std::function<Status(nebula::DataSet &&, Result::State)> onFinish) {
+        std::vector<folly::Future<storage::StorageRpcResponse<storage::cpp2::GetPropResponse>>>
+            futures;
+        futures.reserve(slices.size());
+        for (auto &rows : slices) {
+            nebula::DataSet ds(reqColNames);
+            ds.rows = std::move(rows);
+            futures.emplace_back(fetch(std::move(ds)));
+        }
+        auto v = std::make_shared<nebula::DataSet>();
+        return collectSlices<storage::cpp2::GetPropResponse>(
+            std::move(futures),
+            [this, v](storage::StorageRpcResponse<storage::cpp2::GetPropResponse> &rpcResp) {
+                return appendProps(rpcResp, v.get());
+            },
+            [v, onFinish = std::move(onFinish)](Result::State state) {
+                return onFinish(std::move(*v), state);
+            });
+    }
+
+    // Pick out the rows of the requested `vertices' in `space' from the response shared with
+    // other queries by the storage requests coalescing, in the requested order
+    StatusOr<Result::State> collectCoalescedResp(
+        storage::StorageRpcResponse<storage::cpp2::GetPropResponse> &rpcResp,
+        GraphSpaceID space,
+        const std::vector<Row> &vertices,
+        bool dedup,
+        nebula::DataSet *v) {
+        auto result = coalescedCompleteness(rpcResp.failedParts(), space, vertices, 0);
+        NG_RETURN_IF_ERROR(result);
+        auto state = std::move(result).value();
+        std::unordered_map<Value, std::vector<const Row *>> rowsOfVertex;
+        for (auto &resp : rpcResp.responses()) {
+            // Missing for the partitions failed, which have been counted in `state'
+            if (!resp.__isset.props) {
+                continue;
+            }
+            auto *props = resp.get_props();
+            if (v->colNames.empty()) {
+                v->colNames = props->colNames;
+            }
+            for (auto &row : props->rows) {
+                rowsOfVertex[row.values.front()].emplace_back(&row);
             }
         }
+        std::unordered_set<Value> picked;
+        for (auto &vertex : vertices) {
+            auto &vid = vertex.values.front();
+            if (dedup && !picked.emplace(vid).second) {
+                continue;
+            }
+            auto found = rowsOfVertex.find(vid);
+            if (found == rowsOfVertex.end()) {
+                continue;
+            }
+            for (auto *row : found->second) {
+                v->rows.emplace_back(*row);
+            }
+        }
+        return state;
+    }
+
+    Status finishProps(nebula::DataSet &&v,
+                       const std::vector<std::string> &colNames,
+                       Result::State state) {
         if (!colNames.empty()) {
             DCHECK_EQ(colNames.size(), v.colSize());
             v.colNames = colNames;
@@ -48,6 +48,50 @@ folly::Future<Status> GetVerticesExecutor::getVertices() {
         return finish(ResultBuilder().value(Value(DataSet(gv->colNames()))).finish());
     }
 
+    cache_ = nullptr;
+    cached_ = nebula::DataSet();
+    auto *cache = qctx()->vertexCache();
+    if (cache != nullptr && VertexPropCache::canCache(gv)) {
+        cache_ = cache;
+        cacheEpoch_ = cache->epoch();
+        vertices.rows = lookupCache(cache, std::move(vertices.rows));
+        if (vertices.rows.empty()) {
+            return finishVertices(nebula::DataSet(), Result::State::kSuccess);
+        }
+    }
+
+    auto *coalescer = qctx()->storageCoalescer();
+    if (coalescer != nullptr && StorageRequestCoalescer::canCoalesce(gv)) {
+        return getVerticesCoalesced(coalescer, std::move(vertices.rows));
+    }
+
+    if (gv->orderBy().empty() && gv->limit() == std::numeric_limits<int64_t>::max()) {
+        auto slices = sliceByParts(gv->space(), vertices.rows, 0);
+        if (!slices.ok()) {
+            return error(std::move(slices).status());
+        }
+        if (!slices.value().empty()) {
+            return getPropsSliced(
+                std::move(slices).value(),
+                {kVid},
+                [gv, storageClient](nebula::DataSet ds) {
+                    return DCHECK_NOTNULL(storageClient)
+                        ->getProps(gv->space(),
+                                   std::move(ds),
+                                   &gv->props(),
+                                   nullptr,
+                                   gv->exprs().empty() ? nullptr : &gv->exprs(),
+                                   gv->dedup(),
+                                   gv->orderBy(),
+                                   gv->limit(),
+                                   gv->filter());
+                },
+                [this](nebula::DataSet &&v, Result::State state) {
+                    return finishVertices(std::move(v), state);
+                });
+        }
+    }
+
     time::Duration getPropsTime;
     return DCHECK_NOTNULL(storageClient)
         ->getProps(gv->space(),
@@ -65,9 +109,76 @@ folly::Future<Status> GetVerticesExecutor::getVertices() {
         })
         .then([this, gv](StorageRpcResponse<GetPropResponse> &&rpcResp) {
             SCOPED_TIMER(&execTime_);
-            return handleResp(std::move(rpcResp), gv->colNamesRef());
+            addStorageMetrics(rpcResp);
+            nebula::DataSet v;
+            auto result = collectResp(std::move(rpcResp), &v);
+            NG_RETURN_IF_ERROR(result);
+            return finishVertices(std::move(v), std::move(result).value());
         });
 }
 
+folly::Future<Status> GetVerticesExecutor::getVerticesCoalesced(
+    StorageRequestCoalescer *coalescer,
+    std::vector<Row> vertices) {
+    auto *gv = asNode<GetVertices>(node());
+    time::Duration getPropsTime;
+    auto future = coalescer->getProps(gv, vertices);
+    return std::move(future)
+        .via(runner())
+        .ensure([getPropsTime]() {
+            VLOG(1) << "Get props coalesced time: " << getPropsTime.elapsedInUSec() << "us";
+        })
+        .then([this, gv, vertices = std::move(vertices)](
+                  std::shared_ptr<StorageRpcResponse<GetPropResponse>> rpcResp) {
+            SCOPED_TIMER(&execTime_);
+            addStorageMetrics(*rpcResp);
+            nebula::DataSet v;
+            auto result =
+                collectCoalescedResp(*rpcResp, gv->space(), vertices, gv->dedup(), &v);
+            NG_RETURN_IF_ERROR(result);
+            return finishVertices(std::move(v), std::move(result).value());
+        });
+}
+
+std::vector<Row> GetVerticesExecutor::lookupCache(VertexPropCache *cache,
+                                                  std::vector<Row> &&vertices) {
+    auto *gv = asNode<GetVertices>(node());
+    std::vector<Row> missed;
+    std::unordered_set<Value> visited;
+    for (auto &vertex : vertices) {
+        auto &vid = vertex.values.front();
+        if (gv->dedup() && !visited.emplace(vid).second) {
+            continue;
+        }
+        Row row;
+        if (cache->get(gv->space(), vid, gv->props(), &row, &cached_.colNames)) {
+            cached_.rows.emplace_back(std::move(row));
+        } else {
+            missed.emplace_back(std::move(vertex));
+        }
+    }
+    VLOG(1) << "Vertex cache hits " << cached_.rows.size() << ", misses " << missed.size();
+    return missed;
+}
+
+Status GetVerticesExecutor::finishVertices(nebula::DataSet &&v, Result::State state) {
+    auto *gv = asNode<GetVertices>(node());
+    if (cache_ == nullptr) {
+        return finishProps(std::move(v), gv->colNamesRef(), state);
+    }
+    if (!v.rows.empty()) {
+        cache_->put(gv->space(), v, gv->props(), cacheEpoch_);
+    }
+    if (!cached_.rows.empty()) {
+        if (v.colNames.empty()) {
+            v.colNames = std::move(cached_.colNames);
+        }
+        v.rows.reserve(v.rows.size() + cached_.rows.size());
+        std::move(cached_.rows.begin(), cached_.rows.end(), std::back_inserter(v.rows));
+        cached_ = nebula::DataSet();
+    }
+    return finishProps(std::move(v), gv->colNamesRef(), state);
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -7,6 +7,8 @@
 #ifndef EXECUTOR_QUERY_GETVERTICESEXECUTOR_H_
 #define EXECUTOR_QUERY_GETVERTICESEXECUTOR_H_
 
+#include "executor/StorageRequestCoalescer.h"
+#include "executor/cache/VertexPropCache.h"
 #include "executor/query/GetPropExecutor.h"
 
 namespace nebula {
@@ -21,6 +23,20 @@ public:
 
 private:
     folly::Future<Status> getVertices();
+
+    folly::Future<Status> getVerticesCoalesced(StorageRequestCoalescer *coalescer,
+                                               std::vector<Row> vertices);
+
+    // Move the cached vertices to `cached_' and return the ones to fetch from storage
+    std::vector<Row> lookupCache(VertexPropCache *cache, std::vector<Row> &&vertices);
+
+    // Fill the cache by the fetched props and merge the cached ones
+    Status finishVertices(nebula::DataSet &&v, Result::State state);
+
+    VertexPropCache                *cache_{nullptr};
+    // Taken before the request, to drop the response of the vertices invalidated meanwhile
+    uint64_t                        cacheEpoch_{0};
+    nebula::DataSet                 cached_;
 };
 
 }   // namespace graph
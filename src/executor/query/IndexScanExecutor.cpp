@@ -30,6 +30,7 @@ folly::Future<Status> IndexScanExecutor::indexScan() {
                                       *lookup->returnColumns())
         .via(runner())
         .then([this](StorageRpcResponse<LookupIndexResp> &&rpcResp) {
+            addStorageMetrics(rpcResp);
             return handleResp(std::move(rpcResp));
         });
 }
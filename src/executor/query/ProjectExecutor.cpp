@@ -25,7 +25,8 @@ folly::Future<Status> ProjectExecutor::execute() {
     VLOG(1) << "input: " << project->inputVar();
     DataSet ds;
     ds.colNames = project->colNames();
-    for (; iter->valid(); iter->next()) {
+    for (size_t rows = 0; iter->valid(); iter->next()) {
+        NG_RETURN_IF_ERROR(checkCancelled(++rows));
         Row row;
         for (auto& col : columns) {
             Value val = col->expr()->eval(ctx(iter.get()));
@@ -0,0 +1,72 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+#include <gtest/gtest.h>
+
+#include "common/datatypes/List.h"
+#include "executor/cache/AdjacencyCache.h"
+
+namespace nebula {
+namespace graph {
+
+static DataSet neighbors() {
+    DataSet ds({kVid, "_stats", "_tag:person:name", "_edge:+like:_dst", "_expr"});
+    List tim;
+    for (auto dst : {"Tony", "Jack", "Kobe"}) {
+        tim.values.emplace_back(List({dst}));
+    }
+    ds.rows.emplace_back(Row({"Tim", Value(), List({"Tim"}), tim, Value()}));
+    ds.rows.emplace_back(Row({"Tony", Value(), List({"Tony"}), List({List({"Tim"})}), Value()}));
+    return ds;
+}
+
+TEST(AdjacencyCacheTest, Degree) {
+    auto ds = neighbors();
+    EXPECT_EQ(3, AdjacencyCache::degree(ds.colNames, ds.rows[0]));
+    EXPECT_EQ(1, AdjacencyCache::degree(ds.colNames, ds.rows[1]));
+}
+
+TEST(AdjacencyCacheTest, OnlySupernodes) {
+    AdjacencyCache cache(100, 0, 2);
+    auto ds = neighbors();
+    cache.put(1, ds, "sig", cache.epoch());
+
+    auto tim = cache.get(1, "Tim", "sig");
+    ASSERT_NE(nullptr, tim);
+    EXPECT_EQ(ds.colNames, tim->colNames);
+    ASSERT_EQ(1, tim->rows.size());
+    EXPECT_EQ(ds.rows[0], tim->rows[0]);
+
+    // Below the degree threshold
+    EXPECT_EQ(nullptr, cache.get(1, "Tony", "sig"));
+    // Other request and other space
+    EXPECT_EQ(nullptr, cache.get(1, "Tim", "other"));
+    EXPECT_EQ(nullptr, cache.get(2, "Tim", "sig"));
+    EXPECT_EQ(1, cache.hits());
+    EXPECT_EQ(3, cache.misses());
+}
+
+TEST(AdjacencyCacheTest, Invalidate) {
+    AdjacencyCache cache(100, 0, 1);
+    auto ds = neighbors();
+    cache.put(1, ds, "sig1", cache.epoch());
+    cache.put(1, ds, "sig2", cache.epoch());
+    EXPECT_NE(nullptr, cache.get(1, "Tim", "sig1"));
+    EXPECT_NE(nullptr, cache.get(1, "Tim", "sig2"));
+
+    cache.invalidate(1, "Tim");
+    EXPECT_EQ(nullptr, cache.get(1, "Tim", "sig1"));
+    EXPECT_EQ(nullptr, cache.get(1, "Tim", "sig2"));
+    EXPECT_NE(nullptr, cache.get(1, "Tony", "sig1"));
+
+    // The rows read before the invalidation are not filled back
+    auto epoch = cache.epoch();
+    cache.invalidate(1, "Tim");
+    cache.put(1, ds, "sig1", epoch);
+    EXPECT_EQ(nullptr, cache.get(1, "Tim", "sig1"));
+}
+
+}   // namespace graph
+}   // namespace nebula
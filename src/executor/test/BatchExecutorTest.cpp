@@ -0,0 +1,142 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "context/QueryContext.h"
+#include "executor/admin/BatchExecutor.h"
+#include "executor/test/QueryTestBase.h"
+#include "planner/Admin.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+class BatchExecutorTest : public QueryTestBase {
+protected:
+    Batch* makeBatch(std::vector<std::string> queries) {
+        auto* batch = Batch::make(qctx_.get(), nullptr, std::move(queries));
+        batch->setColNames({"Query", "ErrorCode", "ErrorMsg", "Data"});
+        return batch;
+    }
+
+    // Holds the queries until they are answered, counting how many are running at most
+    void holdQueries() {
+        qctx_->setBatchRunner([this](const std::string& query) {
+            auto& promise = pending_[query];
+            running_++;
+            maxRunning_ = std::max(maxRunning_, running_);
+            return promise.getFuture();
+        });
+    }
+
+    void answer(const std::string& query, cpp2::ExecutionResponse resp) {
+        running_--;
+        pending_[query].setValue(std::move(resp));
+    }
+
+    std::unordered_map<std::string, folly::Promise<cpp2::ExecutionResponse>> pending_;
+    int32_t running_{0};
+    int32_t maxRunning_{0};
+};
+
+TEST_F(BatchExecutorTest, Order) {
+    qctx_->setBatchRunner([](const std::string& query) {
+        cpp2::ExecutionResponse resp;
+        resp.set_error_code(cpp2::ErrorCode::SUCCEEDED);
+        DataSet ds({"q"});
+        ds.emplace_back(Row({query}));
+        resp.set_data(std::move(ds));
+        return folly::makeFuture(std::move(resp));
+    });
+    auto* batch = makeBatch({"YIELD 1", "YIELD 2", "YIELD 3"});
+    auto exec = Executor::create(batch, qctx_.get());
+    ASSERT_TRUE(exec->execute().get().ok());
+
+    auto& result = qctx_->ectx()->getResult(batch->outputVar());
+    auto& ds = result.value().getDataSet();
+    ASSERT_EQ(3, ds.rows.size());
+    for (size_t i = 0; i < ds.rows.size(); ++i) {
+        auto& query = batch->queries()[i];
+        EXPECT_EQ(Value(query), ds.rows[i].values[0]);
+        EXPECT_EQ(Value("SUCCEEDED"), ds.rows[i].values[1]);
+        EXPECT_EQ(Value::kNullValue, ds.rows[i].values[2]);
+        DataSet expected({"q"});
+        expected.emplace_back(Row({query}));
+        EXPECT_EQ(Value(expected), ds.rows[i].values[3]);
+    }
+}
+
+TEST_F(BatchExecutorTest, FailedQuery) {
+    qctx_->setBatchRunner([](const std::string& query) {
+        if (query == "GO") {
+            cpp2::ExecutionResponse resp;
+            resp.set_error_code(cpp2::ErrorCode::E_SYNTAX_ERROR);
+            resp.set_error_msg("syntax error near `GO'");
+            return folly::makeFuture(std::move(resp));
+        }
+        if (query == "THROW") {
+            return folly::makeFuture<cpp2::ExecutionResponse>(std::runtime_error("lost"));
+        }
+        cpp2::ExecutionResponse resp;
+        resp.set_error_code(cpp2::ErrorCode::SUCCEEDED);
+        return folly::makeFuture(std::move(resp));
+    });
+    auto* batch = makeBatch({"GO", "YIELD 1", "THROW"});
+    auto exec = Executor::create(batch, qctx_.get());
+    // One failed query does not fail the batch
+    ASSERT_TRUE(exec->execute().get().ok());
+
+    auto& ds = qctx_->ectx()->getResult(batch->outputVar()).value().getDataSet();
+    ASSERT_EQ(3, ds.rows.size());
+    EXPECT_EQ(Value("E_SYNTAX_ERROR"), ds.rows[0].values[1]);
+    EXPECT_EQ(Value("syntax error near `GO'"), ds.rows[0].values[2]);
+    EXPECT_EQ(Value("SUCCEEDED"), ds.rows[1].values[1]);
+    EXPECT_EQ(Value::kNullValue, ds.rows[1].values[2]);
+    EXPECT_EQ(Value::kNullValue, ds.rows[1].values[3]);
+    EXPECT_EQ(Value("E_EXECUTION_ERROR"), ds.rows[2].values[1]);
+    EXPECT_EQ(Value("lost"), ds.rows[2].values[2]);
+}
+
+TEST_F(BatchExecutorTest, Parallelism) {
+    auto parallelism = FLAGS_batch_execute_parallelism;
+    FLAGS_batch_execute_parallelism = 2;
+    holdQueries();
+    auto* batch = makeBatch({"YIELD 1", "YIELD 2", "YIELD 3", "YIELD 4", "YIELD 5"});
+    auto exec = Executor::create(batch, qctx_.get());
+    auto future = exec->execute();
+    EXPECT_EQ(2, running_);
+    EXPECT_EQ(2, pending_.size());
+
+    // The next query starts as soon as one is done
+    cpp2::ExecutionResponse resp;
+    resp.set_error_code(cpp2::ErrorCode::SUCCEEDED);
+    answer("YIELD 2", resp);
+    EXPECT_EQ(2, running_);
+    EXPECT_EQ(3, pending_.size());
+    // The others are answered in order, each of them has started by then
+    for (auto& query : batch->queries()) {
+        if (query != "YIELD 2") {
+            answer(query, resp);
+        }
+    }
+    ASSERT_TRUE(std::move(future).get().ok());
+    EXPECT_EQ(2, maxRunning_);
+    EXPECT_EQ(5, qctx_->ectx()->getResult(batch->outputVar()).value().getDataSet().rows.size());
+    FLAGS_batch_execute_parallelism = parallelism;
+}
+
+TEST_F(BatchExecutorTest, Nested) {
+    // The queries of a batch have no runner
+    auto* batch = makeBatch({"YIELD 1"});
+    auto exec = Executor::create(batch, qctx_.get());
+    auto status = exec->execute().get();
+    ASSERT_FALSE(status.ok());
+    EXPECT_EQ("BATCH could not be run in a batch.", status.toString());
+}
+
+}   // namespace graph
+}   // namespace nebula
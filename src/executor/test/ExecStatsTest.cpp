@@ -0,0 +1,64 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "executor/ExecStats.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(ExecStatsTest, EstimateBytes) {
+    auto base = ExecStats::estimateBytes(Value(1));
+    ASSERT_EQ(sizeof(Value), base);
+    ASSERT_EQ(base + 5, ExecStats::estimateBytes(Value("hello")));
+
+    DataSet ds({"a", "b"});
+    ds.rows.emplace_back(Row({Value(1), Value("xyz")}));
+    ds.rows.emplace_back(Row({Value(2), Value("uvw")}));
+    auto small = ExecStats::estimateBytes(Value(ds));
+    ds.rows.emplace_back(Row({Value(3), Value("rst")}));
+    ASSERT_LT(small, ExecStats::estimateBytes(Value(ds)));
+}
+
+TEST(ExecStatsTest, ToMap) {
+    ExecStats stats;
+    stats.rowsIn = 10;
+    stats.addStorageLatency("127.0.0.1:44500", 100, 150);
+    stats.addStorageLatency("127.0.0.1:44500", 200, 250);
+    stats.storageRespBytes = 1024;
+
+    auto map = stats.toMap();
+    ASSERT_EQ("10", map.at("rows_in"));
+    ASSERT_EQ("1024", map.at("storage_resp_bytes"));
+    ASSERT_EQ("calls: 2, latency_in_us: 300, e2e_latency_in_us: 400",
+              map.at("storage 127.0.0.1:44500"));
+    ASSERT_EQ(0, map.count("hash_table_size"));
+    ASSERT_EQ(0, map.count("iterations"));
+
+    stats.iterations = 3;
+    stats.reset();
+    map = stats.toMap();
+    ASSERT_EQ("3", map.at("iterations"));
+    ASSERT_EQ(0, map.count("storage_resp_bytes"));
+}
+
+TEST(ExecStatsTest, PartWrites) {
+    ExecStats stats;
+    auto &part = stats.partWrites[3];
+    part.rows = 2000;
+    part.chunks = 2;
+    part.retries = 1;
+
+    auto map = stats.toMap();
+    ASSERT_EQ("rows: 2000, chunks: 2, retries: 1, failed: 0", map.at("part 3"));
+
+    stats.reset();
+    ASSERT_EQ(0, stats.toMap().count("part 3"));
+}
+
+}   // namespace graph
+}   // namespace nebula
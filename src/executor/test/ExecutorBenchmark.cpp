@@ -0,0 +1,331 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <cmath>
+#include <random>
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include "common/expression/ArithmeticExpression.h"
+#include "common/expression/ConstantExpression.h"
+#include "common/expression/PropertyExpression.h"
+#include "common/expression/RelationalExpression.h"
+#include "context/Iterator.h"
+#include "context/QueryContext.h"
+#include "executor/Executor.h"
+#include "planner/Logic.h"
+#include "planner/Query.h"
+
+// Run with `--json' to get the results in JSON, e.g. to track the regressions per commit,
+// and with `--bm_regex' to pick out some of the benchmarks.
+DEFINE_int64(bm_rows, 10000, "Number of the rows in the generated data sets");
+DEFINE_int64(bm_keys, 100, "Cardinality of the key column in the generated data sets");
+DEFINE_double(bm_skew, 0.0, "Zipf exponent of the key distribution, 0 for uniform");
+DEFINE_int64(bm_edges_per_vertex, 10, "Number of the edges of each vertex in GetNeighbors");
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+std::unique_ptr<QueryContext> gQctx;
+std::shared_ptr<Value> gNeighbors;
+
+class KeyGenerator final {
+public:
+    explicit KeyGenerator(uint32_t seed) : engine_(seed) {
+        std::vector<double> weights;
+        weights.reserve(FLAGS_bm_keys);
+        for (int64_t i = 1; i <= FLAGS_bm_keys; ++i) {
+            weights.emplace_back(1.0 / std::pow(static_cast<double>(i), FLAGS_bm_skew));
+        }
+        keys_ = std::discrete_distribution<int64_t>(weights.begin(), weights.end());
+    }
+
+    int64_t key() {
+        return keys_(engine_);
+    }
+
+    int64_t value() {
+        return values_(engine_);
+    }
+
+private:
+    std::mt19937                                engine_;
+    std::discrete_distribution<int64_t>         keys_;
+    std::uniform_int_distribution<int64_t>      values_{0, 999};
+};
+
+// Columns: key, val, name, the name is determined by the key
+DataSet makeDataSet(uint32_t seed) {
+    KeyGenerator gen(seed);
+    DataSet ds({"key", "val", "name"});
+    ds.rows.reserve(FLAGS_bm_rows);
+    for (int64_t i = 0; i < FLAGS_bm_rows; ++i) {
+        auto key = gen.key();
+        ds.emplace_back(Row({key, gen.value(), folly::stringPrintf("name_%ld", key)}));
+    }
+    return ds;
+}
+
+// Same shape as the response of GetNeighbors, the destinations follow the key distribution
+std::shared_ptr<Value> makeNeighbors(uint32_t seed) {
+    KeyGenerator gen(seed);
+    DataSet ds({kVid, "_stats", "_tag:person:name:age", "_edge:+like:_dst:likeness", "_expr"});
+    auto vertices = std::max<int64_t>(FLAGS_bm_rows / FLAGS_bm_edges_per_vertex, 1);
+    for (int64_t i = 0; i < vertices; ++i) {
+        Row row;
+        auto vid = folly::to<std::string>(i);
+        row.values.emplace_back(vid);
+        row.values.emplace_back(Value::kEmpty);
+        row.values.emplace_back(List({"name_" + vid, gen.value()}));
+        List edges;
+        for (int64_t j = 0; j < FLAGS_bm_edges_per_vertex; ++j) {
+            edges.values.emplace_back(List({folly::to<std::string>(gen.key()), gen.value()}));
+        }
+        row.values.emplace_back(std::move(edges));
+        row.values.emplace_back(Value::kEmpty);
+        ds.rows.emplace_back(std::move(row));
+    }
+    List datasets;
+    datasets.values.emplace_back(std::move(ds));
+    return std::make_shared<Value>(std::move(datasets));
+}
+
+void setUp() {
+    gQctx = std::make_unique<QueryContext>();
+    auto *ectx = gQctx->ectx();
+    // The right side shares about half of the rows with the left side
+    auto left = makeDataSet(1);
+    auto right = makeDataSet(2);
+    for (size_t i = 0; i < right.rows.size(); i += 2) {
+        right.rows[i] = left.rows[i];
+    }
+    ectx->setResult("left",
+                    ResultBuilder().value(Value(std::move(left))).iter(Iterator::Kind::kSequential)
+                        .finish());
+    ectx->setResult("right",
+                    ResultBuilder().value(Value(std::move(right))).iter(Iterator::Kind::kSequential)
+                        .finish());
+    gNeighbors = makeNeighbors(3);
+    ectx->setResult("neighbors",
+                    ResultBuilder().value(gNeighbors).iter(Iterator::Kind::kGetNeighbors)
+                        .finish());
+}
+
+template <typename T, typename... Args>
+T *expr(Args&&... args) {
+    return gQctx->objPool()->makeAndAdd<T>(std::forward<Args>(args)...);
+}
+
+Expression *inputProp(const char *prop) {
+    return expr<InputPropertyExpression>(new std::string(prop));
+}
+
+// The inputs are only read by the executors, only the outputs are dropped between iterations
+size_t runExecutor(size_t iters, PlanNode *node) {
+    Executor *exe = nullptr;
+    BENCHMARK_SUSPEND {
+        exe = Executor::create(node, gQctx.get());
+    }
+    for (size_t i = 0; i < iters; ++i) {
+        auto status = exe->execute().get();
+        CHECK(status.ok()) << status;
+        BENCHMARK_SUSPEND {
+            gQctx->ectx()->deleteValue(node->varName());
+        }
+    }
+    return iters;
+}
+
+template <typename Node>
+Node *withInput(Node *node, const std::string &input) {
+    node->setInputVar(input);
+    return node;
+}
+
+template <typename Node>
+Node *setOp(Node *node) {
+    node->setLeftVar("left");
+    node->setRightVar("right");
+    return node;
+}
+
+}   // namespace
+
+size_t filter(size_t iters) {
+    PlanNode *node = nullptr;
+    BENCHMARK_SUSPEND {
+        // Keeps about a half of the rows
+        auto *cond = new RelationalExpression(Expression::Kind::kRelLT,
+                                              new InputPropertyExpression(new std::string("val")),
+                                              new ConstantExpression(500));
+        node = withInput(Filter::make(gQctx.get(), nullptr, gQctx->objPool()->add(cond)), "left");
+    }
+    return runExecutor(iters, node);
+}
+
+size_t filterGetNeighbors(size_t iters) {
+    PlanNode *node = nullptr;
+    BENCHMARK_SUSPEND {
+        auto *cond = new RelationalExpression(
+            Expression::Kind::kRelLT,
+            new EdgePropertyExpression(new std::string("like"), new std::string("likeness")),
+            new ConstantExpression(500));
+        node =
+            withInput(Filter::make(gQctx.get(), nullptr, gQctx->objPool()->add(cond)), "neighbors");
+    }
+    return runExecutor(iters, node);
+}
+
+size_t project(size_t iters) {
+    PlanNode *node = nullptr;
+    BENCHMARK_SUSPEND {
+        auto *cols = gQctx->objPool()->add(new YieldColumns());
+        cols->addColumn(new YieldColumn(new InputPropertyExpression(new std::string("key"))));
+        cols->addColumn(new YieldColumn(
+            new ArithmeticExpression(Expression::Kind::kAdd,
+                                     new InputPropertyExpression(new std::string("val")),
+                                     new ConstantExpression(1))));
+        auto *proj = withInput(Project::make(gQctx.get(), nullptr, cols), "left");
+        proj->setColNames({"key", "val"});
+        node = proj;
+    }
+    return runExecutor(iters, node);
+}
+
+size_t aggregate(size_t iters) {
+    PlanNode *node = nullptr;
+    BENCHMARK_SUSPEND {
+        // GROUP BY key YIELD key, count(*), sum(val)
+        std::vector<Expression *> groupKeys = {inputProp("key")};
+        std::vector<Aggregate::GroupItem> groupItems;
+        groupItems.emplace_back(inputProp("key"), AggFun::Function::kNone, false);
+        groupItems.emplace_back(inputProp("val"), AggFun::Function::kCount, false);
+        groupItems.emplace_back(inputProp("val"), AggFun::Function::kSum, false);
+        auto *agg = withInput(
+            Aggregate::make(gQctx.get(), nullptr, std::move(groupKeys), std::move(groupItems)),
+            "left");
+        agg->setColNames({"key", "count", "sum"});
+        node = agg;
+    }
+    return runExecutor(iters, node);
+}
+
+size_t dedup(size_t iters) {
+    PlanNode *node = nullptr;
+    BENCHMARK_SUSPEND {
+        // Dedup the rows of the project, which is the way DISTINCT is planned
+        auto *cols = gQctx->objPool()->add(new YieldColumns());
+        cols->addColumn(new YieldColumn(new InputPropertyExpression(new std::string("key"))));
+        cols->addColumn(new YieldColumn(new InputPropertyExpression(new std::string("name"))));
+        auto *proj = withInput(Project::make(gQctx.get(), nullptr, cols), "left");
+        proj->setColNames({"key", "name"});
+        auto *exe = Executor::create(proj, gQctx.get());
+        CHECK(exe->execute().get().ok());
+        node = withInput(Dedup::make(gQctx.get(), nullptr), proj->varName());
+    }
+    return runExecutor(iters, node);
+}
+
+size_t sort(size_t iters) {
+    PlanNode *node = nullptr;
+    BENCHMARK_SUSPEND {
+        std::vector<std::pair<std::string, OrderFactor::OrderType>> factors = {
+            {"val", OrderFactor::OrderType::ASCEND},
+            {"key", OrderFactor::OrderType::DESCEND},
+        };
+        node = withInput(Sort::make(gQctx.get(), nullptr, std::move(factors)), "left");
+    }
+    return runExecutor(iters, node);
+}
+
+size_t limit(size_t iters) {
+    PlanNode *node = nullptr;
+    BENCHMARK_SUSPEND {
+        node = withInput(Limit::make(gQctx.get(), nullptr, FLAGS_bm_rows / 4, FLAGS_bm_rows / 2),
+                         "left");
+    }
+    return runExecutor(iters, node);
+}
+
+size_t dataJoin(size_t iters) {
+    PlanNode *node = nullptr;
+    BENCHMARK_SUSPEND {
+        std::vector<Expression *> hashKeys = {
+            expr<VariablePropertyExpression>(new std::string("left"), new std::string("key"))};
+        std::vector<Expression *> probeKeys = {
+            expr<VariablePropertyExpression>(new std::string("right"), new std::string("key"))};
+        auto *join = DataJoin::make(gQctx.get(),
+                                    nullptr,
+                                    {"left", 0},
+                                    {"right", 0},
+                                    std::move(hashKeys),
+                                    std::move(probeKeys));
+        join->setColNames({"key", "val", "name", "key", "val", "name"});
+        node = join;
+    }
+    return runExecutor(iters, node);
+}
+
+size_t unionAll(size_t iters) {
+    PlanNode *node = nullptr;
+    BENCHMARK_SUSPEND {
+        auto *start = StartNode::make(gQctx.get());
+        node = setOp(Union::make(gQctx.get(), start, start));
+    }
+    return runExecutor(iters, node);
+}
+
+size_t intersect(size_t iters) {
+    PlanNode *node = nullptr;
+    BENCHMARK_SUSPEND {
+        auto *start = StartNode::make(gQctx.get());
+        node = setOp(Intersect::make(gQctx.get(), start, start));
+    }
+    return runExecutor(iters, node);
+}
+
+size_t minus(size_t iters) {
+    PlanNode *node = nullptr;
+    BENCHMARK_SUSPEND {
+        auto *start = StartNode::make(gQctx.get());
+        node = setOp(Minus::make(gQctx.get(), start, start));
+    }
+    return runExecutor(iters, node);
+}
+
+size_t getNeighborsIterCtor(size_t iters) {
+    for (size_t i = 0; i < iters; ++i) {
+        GetNeighborsIter iter(gNeighbors);
+        folly::doNotOptimizeAway(iter);
+    }
+    return iters;
+}
+
+BENCHMARK_NAMED_PARAM_MULTI(filter, seq)
+BENCHMARK_NAMED_PARAM_MULTI(filterGetNeighbors, get_neighbors)
+BENCHMARK_NAMED_PARAM_MULTI(project, two_columns)
+BENCHMARK_NAMED_PARAM_MULTI(aggregate, count_sum)
+BENCHMARK_NAMED_PARAM_MULTI(dedup, two_columns)
+BENCHMARK_NAMED_PARAM_MULTI(sort, two_factors)
+BENCHMARK_NAMED_PARAM_MULTI(limit, half)
+BENCHMARK_NAMED_PARAM_MULTI(dataJoin, key)
+BENCHMARK_NAMED_PARAM_MULTI(unionAll, seq)
+BENCHMARK_NAMED_PARAM_MULTI(intersect, seq)
+BENCHMARK_NAMED_PARAM_MULTI(minus, seq)
+BENCHMARK_NAMED_PARAM_MULTI(getNeighborsIterCtor, ctor)
+
+}   // namespace graph
+}   // namespace nebula
+
+int main(int argc, char **argv) {
+    folly::init(&argc, &argv, true);
+    nebula::graph::setUp();
+    folly::runBenchmarks();
+    return 0;
+}
@@ -0,0 +1,71 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+#include <gtest/gtest.h>
+
+#include "executor/StorageRequestCoalescer.h"
+
+namespace nebula {
+namespace graph {
+
+using Queue = StorageRequestCoalescer::GetNeighborsQueue;
+
+TEST(StorageRequestCoalescerTest, MergeInWindow) {
+    Queue queue;
+    std::vector<std::vector<Row>> requested;
+    auto fetcher = [&requested](std::vector<Row> rows) {
+        requested.emplace_back(std::move(rows));
+        return folly::makeFuture<Queue::RpcResponse>(Queue::RpcResponse(1));
+    };
+    auto window = std::chrono::seconds(10);
+    auto f1 = queue.add("key", {Row({"a"}), Row({"b"})}, fetcher, window, 100);
+    auto f2 = queue.add("key", {Row({"b"}), Row({"c"})}, fetcher, window, 100);
+    auto f3 = queue.add("other", {Row({"a"})}, fetcher, window, 100);
+    EXPECT_TRUE(requested.empty());
+
+    queue.flush(true);
+    ASSERT_EQ(2, requested.size());
+    std::vector<size_t> sizes = {requested[0].size(), requested[1].size()};
+    std::sort(sizes.begin(), sizes.end());
+    EXPECT_EQ(std::vector<size_t>({1, 3}), sizes);
+
+    auto r1 = std::move(f1).get();
+    auto r2 = std::move(f2).get();
+    EXPECT_EQ(r1.get(), r2.get());
+    EXPECT_NE(r1.get(), std::move(f3).get().get());
+}
+
+TEST(StorageRequestCoalescerTest, FlushWhenFull) {
+    Queue queue;
+    size_t numRequests = 0;
+    auto fetcher = [&numRequests](std::vector<Row> rows) {
+        ++numRequests;
+        EXPECT_EQ(2, rows.size());
+        return folly::makeFuture<Queue::RpcResponse>(Queue::RpcResponse(1));
+    };
+    auto window = std::chrono::seconds(10);
+    auto f1 = queue.add("key", {Row({"a"})}, fetcher, window, 2);
+    EXPECT_EQ(0, numRequests);
+    auto f2 = queue.add("key", {Row({"b"})}, fetcher, window, 2);
+    EXPECT_EQ(1, numRequests);
+    EXPECT_TRUE(std::move(f1).get() != nullptr);
+    queue.flush(true);
+    EXPECT_EQ(1, numRequests);
+}
+
+TEST(StorageRequestCoalescerTest, Pick) {
+    DataSet ds({kVid, "_edge:+like:_dst"});
+    ds.emplace_back(Row({"a", 1}));
+    ds.emplace_back(Row({"b", 2}));
+    ds.emplace_back(Row({"c", 3}));
+    auto picked = StorageRequestCoalescer::pick(ds, {"a", "c"});
+    DataSet expected({kVid, "_edge:+like:_dst"});
+    expected.emplace_back(Row({"a", 1}));
+    expected.emplace_back(Row({"c", 3}));
+    EXPECT_EQ(expected, picked);
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,75 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+#include <gtest/gtest.h>
+
+#include "executor/cache/VertexPropCache.h"
+
+namespace nebula {
+namespace graph {
+
+static storage::cpp2::VertexProp vertexProp(TagID tag, std::vector<std::string> props) {
+    storage::cpp2::VertexProp prop;
+    prop.tag = tag;
+    prop.props = std::move(props);
+    return prop;
+}
+
+TEST(VertexPropCacheTest, PutAndGet) {
+    VertexPropCache cache(100, 0);
+    std::vector<storage::cpp2::VertexProp> props = {vertexProp(1, {"name", "age"})};
+    DataSet ds({kVid, "person:name", "person:age"});
+    ds.emplace_back(Row({"Tim", "Tim", 18}));
+    ds.emplace_back(Row({"Tony", "Tony", 20}));
+    cache.put(1, ds, props, cache.epoch());
+
+    Row row;
+    std::vector<std::string> colNames;
+    ASSERT_TRUE(cache.get(1, "Tim", props, &row, &colNames));
+    EXPECT_EQ(Row({"Tim", "Tim", 18}), row);
+    EXPECT_EQ(ds.colNames, colNames);
+
+    // Subset of the cached props in another order
+    std::vector<storage::cpp2::VertexProp> ageOnly = {vertexProp(1, {"age"})};
+    colNames.clear();
+    ASSERT_TRUE(cache.get(1, "Tony", ageOnly, &row, &colNames));
+    EXPECT_EQ(Row({"Tony", 20}), row);
+    EXPECT_EQ(std::vector<std::string>({kVid, "person:age"}), colNames);
+
+    // Other space, other tag and uncached vertex
+    EXPECT_FALSE(cache.get(2, "Tim", props, &row, &colNames));
+    EXPECT_FALSE(cache.get(1, "Tim", {vertexProp(2, {"name"})}, &row, &colNames));
+    EXPECT_FALSE(cache.get(1, "Jack", props, &row, &colNames));
+    EXPECT_EQ(2, cache.hits());
+    EXPECT_EQ(3, cache.misses());
+}
+
+TEST(VertexPropCacheTest, Invalidate) {
+    VertexPropCache cache(100, 0);
+    std::vector<storage::cpp2::VertexProp> props = {vertexProp(1, {"name"}),
+                                                    vertexProp(2, {"level"})};
+    DataSet ds({kVid, "person:name", "student:level"});
+    ds.emplace_back(Row({"Tim", "Tim", 3}));
+    ds.emplace_back(Row({"Tony", "Tony", 4}));
+    cache.put(1, ds, props, cache.epoch());
+
+    Row row;
+    std::vector<std::string> colNames;
+    cache.invalidate(1, "Tim", 2);
+    EXPECT_FALSE(cache.get(1, "Tim", props, &row, &colNames));
+    EXPECT_TRUE(cache.get(1, "Tim", {vertexProp(1, {"name"})}, &row, &colNames));
+
+    cache.invalidate(1, "Tony");
+    EXPECT_FALSE(cache.get(1, "Tony", {vertexProp(1, {"name"})}, &row, &colNames));
+
+    // The response read before the invalidation is not filled back
+    auto epoch = cache.epoch();
+    cache.invalidate(1, "Tim", 1);
+    cache.put(1, ds, props, epoch);
+    EXPECT_FALSE(cache.get(1, "Tim", {vertexProp(1, {"name"})}, &row, &colNames));
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,154 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "mock/BenchGraph.h"
+
+#include <random>
+
+#include <folly/hash/Hash.h>
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+// Knuth's multiplicative constant, a prime, to scatter the destinations
+// so that the popular sources are not the popular destinations too
+constexpr uint64_t kScatter = 2654435761UL;
+
+class EndpointSampler final {
+public:
+    EndpointSampler(size_t numVertices, double skew, uint32_t seed)
+        : engine_(seed), numVertices_(numVertices) {
+        cdf_.reserve(numVertices);
+        double total = 0.0;
+        for (size_t i = 0; i < numVertices; ++i) {
+            total += 1.0 / std::pow(static_cast<double>(i + 1), skew);
+            cdf_.emplace_back(total);
+        }
+        uniform_ = std::uniform_real_distribution<double>(0.0, total);
+        scatter_ = numVertices % kScatter == 0 ? 1 : kScatter;
+    }
+
+    std::pair<uint32_t, uint32_t> next() {
+        auto src = sample();
+        auto dst = static_cast<uint32_t>(sample() * scatter_ % numVertices_);
+        return std::make_pair(src, dst);
+    }
+
+private:
+    uint32_t sample() {
+        auto it = std::upper_bound(cdf_.begin(), cdf_.end(), uniform_(engine_));
+        return static_cast<uint32_t>(std::min<size_t>(it - cdf_.begin(), numVertices_ - 1));
+    }
+
+private:
+    std::mt19937_64                             engine_;
+    size_t                                      numVertices_;
+    std::vector<double>                         cdf_;
+    std::uniform_real_distribution<double>      uniform_;
+    uint64_t                                    scatter_;
+};
+
+void toOffsets(std::vector<uint64_t> &offsets) {
+    uint64_t sum = 0;
+    for (auto &offset : offsets) {
+        auto degree = offset;
+        offset = sum;
+        sum += degree;
+    }
+}
+
+void sortNeighbors(const std::vector<uint64_t> &offsets, std::vector<uint32_t> &neighbors) {
+    for (size_t i = 0; i + 1 < offsets.size(); ++i) {
+        std::sort(neighbors.begin() + offsets[i], neighbors.begin() + offsets[i + 1]);
+    }
+}
+
+}   // namespace
+
+// static
+std::unique_ptr<BenchGraph> BenchGraph::generate(const Options &options) {
+    CHECK_GT(options.numVertices, 0UL);
+    CHECK_LE(options.numVertices, std::numeric_limits<uint32_t>::max());
+    auto numEdges = options.numVertices * options.avgDegree;
+    std::unique_ptr<BenchGraph> graph(new BenchGraph());
+
+    // Count the degrees in the first pass and fill the neighbors in the second one,
+    // the same seed gives the same edges, so the edge list is never materialized.
+    graph->outOffsets_.resize(options.numVertices + 1, 0);
+    graph->inOffsets_.resize(options.numVertices + 1, 0);
+    {
+        EndpointSampler sampler(options.numVertices, options.skew, options.seed);
+        for (size_t i = 0; i < numEdges; ++i) {
+            auto edge = sampler.next();
+            graph->outOffsets_[edge.first]++;
+            graph->inOffsets_[edge.second]++;
+        }
+    }
+    toOffsets(graph->outOffsets_);
+    toOffsets(graph->inOffsets_);
+
+    graph->outNeighbors_.resize(numEdges);
+    graph->inNeighbors_.resize(numEdges);
+    auto outCursors = graph->outOffsets_;
+    auto inCursors = graph->inOffsets_;
+    {
+        EndpointSampler sampler(options.numVertices, options.skew, options.seed);
+        for (size_t i = 0; i < numEdges; ++i) {
+            auto edge = sampler.next();
+            graph->outNeighbors_[outCursors[edge.first]++] = edge.second;
+            graph->inNeighbors_[inCursors[edge.second]++] = edge.first;
+        }
+    }
+    sortNeighbors(graph->outOffsets_, graph->outNeighbors_);
+    sortNeighbors(graph->inOffsets_, graph->inNeighbors_);
+
+    uint64_t maxDegree = 0;
+    for (size_t i = 0; i < options.numVertices; ++i) {
+        maxDegree = std::max<uint64_t>(maxDegree, graph->outEdges(i).size());
+    }
+    LOG(INFO) << "Generated a graph of " << options.numVertices << " vertices and " << numEdges
+              << " edges, the max out degree is " << maxDegree;
+    return graph;
+}
+
+bool BenchGraph::hasEdge(uint32_t src, uint32_t dst) const {
+    auto dsts = outEdges(src);
+    return std::binary_search(dsts.begin(), dsts.end(), dst);
+}
+
+folly::Optional<uint32_t> BenchGraph::toVertex(const Value &vid) const {
+    if (!vid.isStr()) {
+        return folly::none;
+    }
+    auto vertex = folly::tryTo<uint32_t>(vid.getStr());
+    if (vertex.hasError() || vertex.value() >= numVertices()) {
+        return folly::none;
+    }
+    return vertex.value();
+}
+
+// static
+Value BenchGraph::propOf(uint64_t entity, folly::StringPiece prop, Value::Type type) {
+    auto hash =
+        folly::hash::twang_mix64(entity ^ folly::hash::fnv64_buf(prop.data(), prop.size()));
+    switch (type) {
+        case Value::Type::BOOL:
+            return Value((hash & 1) == 1);
+        case Value::Type::INT:
+            return static_cast<int64_t>(hash % 100);
+        case Value::Type::FLOAT:
+            return static_cast<double>(hash % 10000) / 100;
+        case Value::Type::STRING:
+            return folly::stringPrintf("%s_%lu", prop.str().c_str(), hash % 10000);
+        default:
+            return Value(NullType::__NULL__);
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
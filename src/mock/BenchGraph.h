@@ -0,0 +1,92 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef MOCK_BENCHGRAPH_H_
+#define MOCK_BENCHGRAPH_H_
+
+#include "common/base/Base.h"
+#include "common/datatypes/Value.h"
+#include <folly/Range.h>
+
+namespace nebula {
+namespace graph {
+
+/**
+ * A generated graph kept in the compressed sparse rows, i.e. the neighbors of all the
+ * vertices in one array and the offset of each vertex in another, both directions are kept.
+ * The vertices are numbered from 0 and the vids are the decimal strings of the numbers.
+ *
+ * The graph has no schema, the properties are derived from the vertex or edge and the name
+ * of the property, so it only takes about 16 bytes for each edge.
+ */
+class BenchGraph final {
+public:
+    struct Options {
+        size_t      numVertices{1000000};
+        size_t      avgDegree{10};
+        // The exponent of the power-law degree distribution, 0 for the uniform random graph
+        double      skew{1.0};
+        uint32_t    seed{0};
+    };
+
+    // Both endpoints of each edge are drawn by the weight `1 / (rank + 1) ^ skew',
+    // so the degrees are power-law distributed as the real social graphs.
+    static std::unique_ptr<BenchGraph> generate(const Options &options);
+
+    size_t numVertices() const {
+        return outOffsets_.size() - 1;
+    }
+
+    size_t numEdges() const {
+        return outNeighbors_.size();
+    }
+
+    // The sorted destinations of the out edges
+    folly::Range<const uint32_t*> outEdges(uint32_t vertex) const {
+        return neighbors(outOffsets_, outNeighbors_, vertex);
+    }
+
+    // The sorted sources of the in edges
+    folly::Range<const uint32_t*> inEdges(uint32_t vertex) const {
+        return neighbors(inOffsets_, inNeighbors_, vertex);
+    }
+
+    bool hasEdge(uint32_t src, uint32_t dst) const;
+
+    folly::Optional<uint32_t> toVertex(const Value &vid) const;
+
+    static std::string toVid(uint32_t vertex) {
+        return folly::to<std::string>(vertex);
+    }
+
+    static uint64_t edgeOf(uint32_t src, uint32_t dst) {
+        return (static_cast<uint64_t>(src) << 32) | dst;
+    }
+
+    // The same value for the same entity and property all the time
+    static Value propOf(uint64_t entity, folly::StringPiece prop, Value::Type type);
+
+private:
+    BenchGraph() = default;
+
+    static folly::Range<const uint32_t*> neighbors(const std::vector<uint64_t> &offsets,
+                                                   const std::vector<uint32_t> &all,
+                                                   uint32_t vertex) {
+        return folly::Range<const uint32_t*>(all.data() + offsets[vertex],
+                                             all.data() + offsets[vertex + 1]);
+    }
+
+private:
+    std::vector<uint64_t>       outOffsets_;
+    std::vector<uint32_t>       outNeighbors_;
+    std::vector<uint64_t>       inOffsets_;
+    std::vector<uint32_t>       inNeighbors_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // MOCK_BENCHGRAPH_H_
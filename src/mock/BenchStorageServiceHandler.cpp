@@ -0,0 +1,437 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "mock/BenchStorageServiceHandler.h"
+
+#include <folly/Random.h>
+#include <folly/futures/Future.h>
+
+#include "util/SchemaUtil.h"
+
+namespace nebula {
+namespace graph {
+
+BenchStorageServiceHandler::BenchStorageServiceHandler(uint16_t metaPort,
+                                                       std::shared_ptr<const BenchGraph> graph,
+                                                       Options options)
+    : graph_(std::move(graph)), options_(options) {
+    auto threadPool = std::make_shared<folly::IOThreadPoolExecutor>(1);
+    auto hostStatus = network::NetworkUtils::resolveHost("127.0.0.1", metaPort);
+    meta::MetaClientOptions metaOptions;
+    metaOptions.serviceName_ = "BenchStorage";
+    metaClient_ = std::make_unique<meta::MetaClient>(threadPool,
+                                                     std::move(hostStatus).value(), metaOptions);
+    metaClient_->waitForMetadReady();
+    mgr_ = std::make_unique<meta::ServerBasedSchemaManager>();
+    mgr_->init(metaClient_.get());
+}
+
+template <typename Resp>
+folly::Future<Resp> BenchStorageServiceHandler::respond(Resp &&resp,
+                                                        const Status &status) const {
+    auto latency = options_.latencyUs;
+    if (options_.jitterUs > 0) {
+        latency += folly::Random::rand64(options_.jitterUs + 1);
+    }
+    storage::cpp2::ResponseCommon result;
+    std::vector<storage::cpp2::PartitionResult> failedParts;
+    if (!status.ok()) {
+        LOG(ERROR) << status;
+        storage::cpp2::PartitionResult partResult;
+        partResult.set_code(storage::cpp2::ErrorCode::E_UNKNOWN);
+        failedParts.emplace_back(std::move(partResult));
+    }
+    result.set_failed_parts(std::move(failedParts));
+    result.set_latency_in_us(latency);
+    resp.set_result(std::move(result));
+    if (latency <= 0) {
+        return folly::makeFuture<Resp>(std::move(resp));
+    }
+    return folly::futures::sleep(std::chrono::microseconds(latency))
+        .then([resp = std::move(resp)]() mutable { return std::move(resp); });
+}
+
+folly::Future<storage::cpp2::GetNeighborsResponse>
+BenchStorageServiceHandler::future_getNeighbors(const storage::cpp2::GetNeighborsRequest& req) {
+    storage::cpp2::GetNeighborsResponse resp;
+    auto result = getNeighbors(req);
+    auto status = result.status();
+    if (status.ok()) {
+        resp.set_vertices(std::move(result).value());
+    }
+    return respond(std::move(resp), status);
+}
+
+folly::Future<storage::cpp2::GetPropResponse>
+BenchStorageServiceHandler::future_getProps(const storage::cpp2::GetPropRequest& req) {
+    storage::cpp2::GetPropResponse resp;
+    auto result = req.__isset.edge_props ? getEdgeProps(req) : getVertexProps(req);
+    auto status = result.status();
+    if (status.ok()) {
+        resp.set_props(std::move(result).value());
+    }
+    return respond(std::move(resp), status);
+}
+
+folly::Future<storage::cpp2::LookupIndexResp>
+BenchStorageServiceHandler::future_lookupIndex(const storage::cpp2::LookupIndexRequest& req) {
+    storage::cpp2::LookupIndexResp resp;
+    auto result = lookupIndex(req);
+    auto status = result.status();
+    if (status.ok()) {
+        resp.set_data(std::move(result).value());
+    }
+    return respond(std::move(resp), status);
+}
+
+folly::Future<storage::cpp2::ExecResponse>
+BenchStorageServiceHandler::future_addVertices(const storage::cpp2::AddVerticesRequest& req) {
+    UNUSED(req);
+    return respond(storage::cpp2::ExecResponse(), Status::OK());
+}
+
+folly::Future<storage::cpp2::ExecResponse>
+BenchStorageServiceHandler::future_addEdges(const storage::cpp2::AddEdgesRequest& req) {
+    UNUSED(req);
+    return respond(storage::cpp2::ExecResponse(), Status::OK());
+}
+
+folly::Future<storage::cpp2::ExecResponse>
+BenchStorageServiceHandler::future_deleteEdges(const storage::cpp2::DeleteEdgesRequest& req) {
+    UNUSED(req);
+    return respond(storage::cpp2::ExecResponse(), Status::OK());
+}
+
+folly::Future<storage::cpp2::ExecResponse>
+BenchStorageServiceHandler::future_deleteVertices(
+    const storage::cpp2::DeleteVerticesRequest& req) {
+    UNUSED(req);
+    return respond(storage::cpp2::ExecResponse(), Status::OK());
+}
+
+StatusOr<BenchStorageServiceHandler::PropsSpec>
+BenchStorageServiceHandler::tagSpec(GraphSpaceID space,
+                                    TagID tag,
+                                    const std::vector<std::string> &props) const {
+    auto name = mgr_->toTagName(space, tag);
+    NG_RETURN_IF_ERROR(name);
+    auto schema = mgr_->getTagSchema(space, tag);
+    if (schema == nullptr) {
+        return Status::Error("TagId `%d' not exist", tag);
+    }
+    return propsSpec(std::move(name).value(), std::move(schema), props);
+}
+
+StatusOr<BenchStorageServiceHandler::PropsSpec>
+BenchStorageServiceHandler::edgeSpec(GraphSpaceID space,
+                                     EdgeType type,
+                                     const std::vector<std::string> &props) const {
+    auto name = mgr_->toEdgeName(space, std::abs(type));
+    NG_RETURN_IF_ERROR(name);
+    auto schema = mgr_->getEdgeSchema(space, std::abs(type));
+    if (schema == nullptr) {
+        return Status::Error("EdgeType `%d' not exist", type);
+    }
+    return propsSpec(std::move(name).value(), std::move(schema), props);
+}
+
+StatusOr<BenchStorageServiceHandler::PropsSpec>
+BenchStorageServiceHandler::propsSpec(std::string name,
+                                      std::shared_ptr<const meta::NebulaSchemaProvider> schema,
+                                      const std::vector<std::string> &props) const {
+    PropsSpec spec;
+    spec.name = std::move(name);
+    // All the properties are returned if none is specified, as storaged does
+    if (props.empty()) {
+        for (size_t i = 0; i < schema->getNumFields(); ++i) {
+            auto *field = schema->field(i);
+            spec.props.emplace_back(field->name());
+            spec.types.emplace_back(SchemaUtil::propTypeToValueType(field->type()));
+        }
+        return spec;
+    }
+    for (auto &prop : props) {
+        auto *field = schema->field(prop);
+        // The reserved properties such as `_dst' are not in the schema
+        if (field == nullptr && (prop.empty() || prop[0] != '_')) {
+            return Status::Error("Prop `%s' not found in `%s'", prop.c_str(), spec.name.c_str());
+        }
+        spec.props.emplace_back(prop);
+        spec.types.emplace_back(field == nullptr
+                                    ? Value::Type::__EMPTY__
+                                    : SchemaUtil::propTypeToValueType(field->type()));
+    }
+    return spec;
+}
+
+List BenchStorageServiceHandler::tagProps(uint32_t vertex, const PropsSpec &spec) const {
+    List values;
+    values.values.reserve(spec.props.size());
+    for (size_t i = 0; i < spec.props.size(); ++i) {
+        values.values.emplace_back(BenchGraph::propOf(vertex, spec.props[i], spec.types[i]));
+    }
+    return values;
+}
+
+List BenchStorageServiceHandler::edgeProps(uint32_t src,
+                                           uint32_t dst,
+                                           EdgeType type,
+                                           const PropsSpec &spec) const {
+    // The reverse edge has the same properties as the forward one
+    auto edge = type > 0 ? BenchGraph::edgeOf(src, dst) : BenchGraph::edgeOf(dst, src);
+    List values;
+    values.values.reserve(spec.props.size());
+    for (size_t i = 0; i < spec.props.size(); ++i) {
+        auto &prop = spec.props[i];
+        if (prop == kSrc) {
+            values.values.emplace_back(BenchGraph::toVid(src));
+        } else if (prop == kDst) {
+            values.values.emplace_back(BenchGraph::toVid(dst));
+        } else if (prop == kRank) {
+            values.values.emplace_back(0L);
+        } else if (prop == kType) {
+            values.values.emplace_back(static_cast<int64_t>(type));
+        } else {
+            values.values.emplace_back(BenchGraph::propOf(edge, prop, spec.types[i]));
+        }
+    }
+    return values;
+}
+
+StatusOr<DataSet> BenchStorageServiceHandler::getNeighbors(
+    const storage::cpp2::GetNeighborsRequest& req) const {
+    auto space = req.get_space_id();
+    auto &traverse = req.get_traverse_spec();
+    DataSet ds;
+    ds.colNames = {kVid, "_stats"};
+
+    std::vector<PropsSpec> tags;
+    if (traverse.__isset.vertex_props) {
+        for (auto &prop : *traverse.get_vertex_props()) {
+            auto spec = tagSpec(space, prop.get_tag(), prop.get_props());
+            NG_RETURN_IF_ERROR(spec);
+            tags.emplace_back(std::move(spec).value());
+        }
+    }
+    std::vector<std::pair<EdgeType, PropsSpec>> edges;
+    if (traverse.__isset.edge_props) {
+        for (auto &prop : *traverse.get_edge_props()) {
+            auto spec = edgeSpec(space, prop.get_type(), prop.get_props());
+            NG_RETURN_IF_ERROR(spec);
+            edges.emplace_back(prop.get_type(), std::move(spec).value());
+        }
+    } else {
+        for (auto type : traverse.get_edge_types()) {
+            auto spec = edgeSpec(space, type, {});
+            NG_RETURN_IF_ERROR(spec);
+            edges.emplace_back(type, std::move(spec).value());
+        }
+    }
+    for (auto &tag : tags) {
+        auto col = "_tag:" + tag.name;
+        for (auto &prop : tag.props) {
+            col.append(":").append(prop);
+        }
+        ds.colNames.emplace_back(std::move(col));
+    }
+    for (auto &edge : edges) {
+        auto col = std::string("_edge:") + (edge.first > 0 ? "+" : "-") + edge.second.name;
+        for (auto &prop : edge.second.props) {
+            col.append(":").append(prop);
+        }
+        ds.colNames.emplace_back(std::move(col));
+    }
+    ds.colNames.emplace_back("_expr");
+
+    for (auto &part : req.get_parts()) {
+        for (auto &input : part.second) {
+            if (input.values.empty()) {
+                continue;
+            }
+            auto &vid = input.values.front();
+            auto vertex = graph_->toVertex(vid);
+            Row row;
+            row.values.reserve(ds.colNames.size());
+            row.values.emplace_back(vid);
+            row.values.emplace_back(Value::kEmpty);
+            for (auto &tag : tags) {
+                row.values.emplace_back(vertex ? Value(tagProps(*vertex, tag)) : Value::kEmpty);
+            }
+            for (auto &edge : edges) {
+                if (!vertex) {
+                    row.values.emplace_back(Value::kEmpty);
+                    continue;
+                }
+                auto neighbors =
+                    edge.first > 0 ? graph_->outEdges(*vertex) : graph_->inEdges(*vertex);
+                if (neighbors.empty()) {
+                    row.values.emplace_back(Value::kEmpty);
+                    continue;
+                }
+                List list;
+                list.values.reserve(neighbors.size());
+                for (auto neighbor : neighbors) {
+                    list.values.emplace_back(edgeProps(*vertex, neighbor, edge.first, edge.second));
+                }
+                row.values.emplace_back(std::move(list));
+            }
+            row.values.emplace_back(Value::kEmpty);
+            ds.rows.emplace_back(std::move(row));
+        }
+    }
+    return ds;
+}
+
+StatusOr<DataSet> BenchStorageServiceHandler::getVertexProps(
+    const storage::cpp2::GetPropRequest& req) const {
+    auto space = req.get_space_id();
+    DataSet ds({kVid});
+    std::vector<PropsSpec> tags;
+    if (req.__isset.vertex_props) {
+        for (auto &prop : *req.get_vertex_props()) {
+            auto spec = tagSpec(space, prop.get_tag(), prop.get_props());
+            NG_RETURN_IF_ERROR(spec);
+            for (auto &name : spec.value().props) {
+                ds.colNames.emplace_back(spec.value().name + "." + name);
+            }
+            tags.emplace_back(std::move(spec).value());
+        }
+    }
+    for (auto &part : req.get_parts()) {
+        for (auto &input : part.second) {
+            if (input.values.empty()) {
+                continue;
+            }
+            auto vertex = graph_->toVertex(input.values.front());
+            if (!vertex) {
+                continue;
+            }
+            Row row;
+            row.values.reserve(ds.colNames.size());
+            row.values.emplace_back(input.values.front());
+            for (auto &tag : tags) {
+                auto values = tagProps(*vertex, tag);
+                std::move(values.values.begin(), values.values.end(),
+                          std::back_inserter(row.values));
+            }
+            ds.rows.emplace_back(std::move(row));
+        }
+    }
+    return ds;
+}
+
+StatusOr<DataSet> BenchStorageServiceHandler::getEdgeProps(
+    const storage::cpp2::GetPropRequest& req) const {
+    auto space = req.get_space_id();
+    DataSet ds;
+    std::vector<std::pair<EdgeType, PropsSpec>> edges;
+    for (auto &prop : *req.get_edge_props()) {
+        auto spec = edgeSpec(space, prop.get_type(), prop.get_props());
+        NG_RETURN_IF_ERROR(spec);
+        for (auto &name : spec.value().props) {
+            ds.colNames.emplace_back(spec.value().name + "." + name);
+        }
+        edges.emplace_back(prop.get_type(), std::move(spec).value());
+    }
+    for (auto &part : req.get_parts()) {
+        // Each row is the key of an edge: src, type, rank, dst
+        for (auto &input : part.second) {
+            if (input.values.size() < 4 || !input.values[1].isInt()) {
+                continue;
+            }
+            auto src = graph_->toVertex(input.values[0]);
+            auto dst = graph_->toVertex(input.values[3]);
+            auto type = static_cast<EdgeType>(input.values[1].getInt());
+            if (!src || !dst) {
+                continue;
+            }
+            auto exists = type > 0 ? graph_->hasEdge(*src, *dst) : graph_->hasEdge(*dst, *src);
+            if (!exists) {
+                continue;
+            }
+            Row row;
+            row.values.reserve(ds.colNames.size());
+            for (auto &edge : edges) {
+                if (edge.first != type) {
+                    row.values.resize(row.values.size() + edge.second.props.size(),
+                                      Value(NullType::__NULL__));
+                    continue;
+                }
+                auto values = edgeProps(*src, *dst, type, edge.second);
+                std::move(values.values.begin(), values.values.end(),
+                          std::back_inserter(row.values));
+            }
+            ds.rows.emplace_back(std::move(row));
+        }
+    }
+    return ds;
+}
+
+StatusOr<DataSet> BenchStorageServiceHandler::lookupIndex(
+    const storage::cpp2::LookupIndexRequest& req) const {
+    // The index conditions are not evaluated, all the vertices or edges of the parts hit
+    auto space = req.get_space_id();
+    auto &index = req.get_indices();
+    std::vector<std::string> props;
+    if (req.__isset.return_columns) {
+        props = *req.get_return_columns();
+    }
+    auto numParts = metaClient_->partsNum(space);
+    NG_RETURN_IF_ERROR(numParts);
+    std::unordered_set<PartitionID> parts(req.get_parts().begin(), req.get_parts().end());
+
+    DataSet ds;
+    if (index.get_is_edge()) {
+        EdgeType type = index.get_tag_or_edge_id();
+        auto spec = edgeSpec(space, type, props);
+        NG_RETURN_IF_ERROR(spec);
+        ds.colNames = {kSrc, kRank, kDst};
+        for (auto &prop : spec.value().props) {
+            ds.colNames.emplace_back(spec.value().name + "." + prop);
+        }
+        for (uint32_t src = 0; src < graph_->numVertices(); ++src) {
+            auto vid = BenchGraph::toVid(src);
+            if (parts.count(metaClient_->partId(numParts.value(), vid)) == 0) {
+                continue;
+            }
+            for (auto dst : graph_->outEdges(src)) {
+                Row row;
+                row.values.reserve(ds.colNames.size());
+                row.values.emplace_back(vid);
+                row.values.emplace_back(0L);
+                row.values.emplace_back(BenchGraph::toVid(dst));
+                auto values = edgeProps(src, dst, type, spec.value());
+                std::move(values.values.begin(), values.values.end(),
+                          std::back_inserter(row.values));
+                ds.rows.emplace_back(std::move(row));
+            }
+        }
+        return ds;
+    }
+
+    auto spec = tagSpec(space, index.get_tag_or_edge_id(), props);
+    NG_RETURN_IF_ERROR(spec);
+    ds.colNames = {kVid};
+    for (auto &prop : spec.value().props) {
+        ds.colNames.emplace_back(spec.value().name + "." + prop);
+    }
+    for (uint32_t vertex = 0; vertex < graph_->numVertices(); ++vertex) {
+        auto vid = BenchGraph::toVid(vertex);
+        if (parts.count(metaClient_->partId(numParts.value(), vid)) == 0) {
+            continue;
+        }
+        Row row;
+        row.values.reserve(ds.colNames.size());
+        row.values.emplace_back(std::move(vid));
+        auto values = tagProps(vertex, spec.value());
+        std::move(values.values.begin(), values.values.end(), std::back_inserter(row.values));
+        ds.rows.emplace_back(std::move(row));
+    }
+    return ds;
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,107 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef MOCK_BENCHSTORAGESERVICEHANDLER_H_
+#define MOCK_BENCHSTORAGESERVICEHANDLER_H_
+
+#include "common/base/Base.h"
+#include "common/base/StatusOr.h"
+#include "common/clients/meta/MetaClient.h"
+#include "common/interface/gen-cpp2/GraphStorageService.h"
+#include "common/meta/ServerBasedSchemaManager.h"
+#include "mock/BenchGraph.h"
+#include <folly/futures/Future.h>
+
+namespace nebula {
+namespace graph {
+
+/**
+ * The in-process stand-in of storaged to benchmark graphd end to end on one box.
+ * It serves the reads from a generated `BenchGraph', in which every vertex has all the tags
+ * and every edge is of all the edge types, the properties are typed by the schemas in meta.
+ * The filters, stats, expressions and limits pushed down are not evaluated, the writes
+ * are acknowledged and dropped.
+ */
+class BenchStorageServiceHandler final : public storage::cpp2::GraphStorageServiceSvIf {
+public:
+    struct Options {
+        // The artificial latency added to each response to simulate the network and disks,
+        // plus a uniformly random jitter in [0, jitterUs]
+        int64_t     latencyUs{0};
+        int64_t     jitterUs{0};
+    };
+
+    BenchStorageServiceHandler(uint16_t metaPort,
+                               std::shared_ptr<const BenchGraph> graph,
+                               Options options);
+
+    folly::Future<storage::cpp2::GetNeighborsResponse>
+    future_getNeighbors(const storage::cpp2::GetNeighborsRequest& req) override;
+
+    folly::Future<storage::cpp2::GetPropResponse>
+    future_getProps(const storage::cpp2::GetPropRequest& req) override;
+
+    folly::Future<storage::cpp2::LookupIndexResp>
+    future_lookupIndex(const storage::cpp2::LookupIndexRequest& req) override;
+
+    folly::Future<storage::cpp2::ExecResponse>
+    future_addVertices(const storage::cpp2::AddVerticesRequest& req) override;
+
+    folly::Future<storage::cpp2::ExecResponse>
+    future_addEdges(const storage::cpp2::AddEdgesRequest& req) override;
+
+    folly::Future<storage::cpp2::ExecResponse>
+    future_deleteEdges(const storage::cpp2::DeleteEdgesRequest& req) override;
+
+    folly::Future<storage::cpp2::ExecResponse>
+    future_deleteVertices(const storage::cpp2::DeleteVerticesRequest& req) override;
+
+private:
+    // The properties asked for one tag or edge type
+    struct PropsSpec {
+        std::string                     name;
+        std::vector<std::string>        props;
+        std::vector<Value::Type>        types;
+    };
+
+    StatusOr<PropsSpec> tagSpec(GraphSpaceID space,
+                                TagID tag,
+                                const std::vector<std::string> &props) const;
+
+    StatusOr<PropsSpec> edgeSpec(GraphSpaceID space,
+                                 EdgeType type,
+                                 const std::vector<std::string> &props) const;
+
+    StatusOr<PropsSpec> propsSpec(std::string name,
+                                  std::shared_ptr<const meta::NebulaSchemaProvider> schema,
+                                  const std::vector<std::string> &props) const;
+
+    List tagProps(uint32_t vertex, const PropsSpec &spec) const;
+
+    List edgeProps(uint32_t src, uint32_t dst, EdgeType type, const PropsSpec &spec) const;
+
+    StatusOr<DataSet> getNeighbors(const storage::cpp2::GetNeighborsRequest& req) const;
+
+    StatusOr<DataSet> getVertexProps(const storage::cpp2::GetPropRequest& req) const;
+
+    StatusOr<DataSet> getEdgeProps(const storage::cpp2::GetPropRequest& req) const;
+
+    StatusOr<DataSet> lookupIndex(const storage::cpp2::LookupIndexRequest& req) const;
+
+    template <typename Resp>
+    folly::Future<Resp> respond(Resp &&resp, const Status &status) const;
+
+private:
+    std::shared_ptr<const BenchGraph>                   graph_;
+    Options                                             options_;
+    std::unique_ptr<meta::MetaClient>                   metaClient_;
+    std::unique_ptr<meta::ServerBasedSchemaManager>     mgr_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // MOCK_BENCHSTORAGESERVICEHANDLER_H_
@@ -9,6 +9,7 @@
 
 #include "common/base/Base.h"
 #include "common/thread/NamedThread.h"
+#include "mock/BenchStorageServiceHandler.h"
 #include "mock/MockMetaServiceHandler.h"
 #include "mock/MockStorageServiceHandler.h"
 #include <thrift/lib/cpp2/server/ThriftServer.h>
@@ -83,6 +84,18 @@ public:
         return storageServer_->getPort();
     }
 
+    // Serve the storage requests from a generated graph instead, for the benchmarks
+    uint16_t startBenchStorage(uint16_t metaPort,
+                               std::shared_ptr<const BenchGraph> graph,
+                               BenchStorageServiceHandler::Options options) {
+        auto handler =
+            std::make_shared<BenchStorageServiceHandler>(metaPort, std::move(graph), options);
+        storageServer_ = std::make_unique<Server>();
+        storageServer_->mock("bench_storage", handler);
+        LOG(INFO) << "Start bench storage service port: " << storageServer_->getPort();
+        return storageServer_->getPort();
+    }
+
     uint16_t startGraph() {
         auto threadPool = std::make_shared<folly::IOThreadPoolExecutor>(1);
         auto handler = std::make_shared<GraphService>();
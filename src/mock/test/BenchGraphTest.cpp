@@ -0,0 +1,102 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "mock/BenchGraph.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+size_t maxOutDegree(const BenchGraph &graph) {
+    size_t degree = 0;
+    for (uint32_t i = 0; i < graph.numVertices(); ++i) {
+        degree = std::max(degree, graph.outEdges(i).size());
+    }
+    return degree;
+}
+
+}   // namespace
+
+TEST(BenchGraphTest, Generate) {
+    BenchGraph::Options options;
+    options.numVertices = 1000;
+    options.avgDegree = 8;
+    options.skew = 1.0;
+    auto graph = BenchGraph::generate(options);
+    ASSERT_EQ(1000, graph->numVertices());
+    ASSERT_EQ(8000, graph->numEdges());
+
+    size_t numOut = 0;
+    size_t numIn = 0;
+    for (uint32_t i = 0; i < graph->numVertices(); ++i) {
+        auto dsts = graph->outEdges(i);
+        numOut += dsts.size();
+        numIn += graph->inEdges(i).size();
+        EXPECT_TRUE(std::is_sorted(dsts.begin(), dsts.end()));
+        for (auto dst : dsts) {
+            EXPECT_TRUE(graph->hasEdge(i, dst));
+            // Each out edge is an in edge of the destination
+            auto srcs = graph->inEdges(dst);
+            EXPECT_TRUE(std::binary_search(srcs.begin(), srcs.end(), i));
+        }
+    }
+    EXPECT_EQ(8000, numOut);
+    EXPECT_EQ(8000, numIn);
+}
+
+TEST(BenchGraphTest, Deterministic) {
+    BenchGraph::Options options;
+    options.numVertices = 100;
+    options.avgDegree = 4;
+    options.seed = 7;
+    auto graph1 = BenchGraph::generate(options);
+    auto graph2 = BenchGraph::generate(options);
+    for (uint32_t i = 0; i < graph1->numVertices(); ++i) {
+        auto dsts1 = graph1->outEdges(i);
+        auto dsts2 = graph2->outEdges(i);
+        EXPECT_TRUE(std::equal(dsts1.begin(), dsts1.end(), dsts2.begin(), dsts2.end()));
+    }
+}
+
+TEST(BenchGraphTest, Skew) {
+    BenchGraph::Options options;
+    options.numVertices = 10000;
+    options.avgDegree = 10;
+    options.skew = 0.0;
+    auto uniform = BenchGraph::generate(options);
+    options.skew = 1.0;
+    auto skewed = BenchGraph::generate(options);
+    // The hubs of the power-law graph have far more edges
+    EXPECT_GT(maxOutDegree(*skewed), 10 * maxOutDegree(*uniform));
+}
+
+TEST(BenchGraphTest, Vid) {
+    BenchGraph::Options options;
+    options.numVertices = 10;
+    options.avgDegree = 1;
+    auto graph = BenchGraph::generate(options);
+    EXPECT_EQ(3, graph->toVertex(Value(BenchGraph::toVid(3))).value());
+    EXPECT_FALSE(graph->toVertex(Value("10")).hasValue());
+    EXPECT_FALSE(graph->toVertex(Value("abc")).hasValue());
+    EXPECT_FALSE(graph->toVertex(Value(3)).hasValue());
+}
+
+TEST(BenchGraphTest, Props) {
+    auto edge = BenchGraph::edgeOf(1, 2);
+    EXPECT_EQ(BenchGraph::propOf(edge, "weight", Value::Type::INT),
+              BenchGraph::propOf(edge, "weight", Value::Type::INT));
+    EXPECT_TRUE(BenchGraph::propOf(edge, "weight", Value::Type::INT).isInt());
+    EXPECT_TRUE(BenchGraph::propOf(1, "name", Value::Type::STRING).isStr());
+    EXPECT_TRUE(BenchGraph::propOf(1, "score", Value::Type::FLOAT).isFloat());
+    EXPECT_TRUE(BenchGraph::propOf(1, "male", Value::Type::BOOL).isBool());
+    EXPECT_TRUE(BenchGraph::propOf(1, "born", Value::Type::DATE).isNull());
+}
+
+}   // namespace graph
+}   // namespace nebula
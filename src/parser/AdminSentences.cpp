@@ -44,6 +44,22 @@ std::string ShowCollationSentence::toString() const {
     return std::string("SHOW COLLATION");
 }
 
+std::string ShowQueriesSentence::toString() const {
+    return std::string("SHOW QUERIES");
+}
+
+std::string KillQuerySentence::toString() const {
+    return folly::stringPrintf("KILL QUERY %ld", queryId_);
+}
+
+std::string ShowQueryStatsSentence::toString() const {
+    return std::string("SHOW QUERY STATS");
+}
+
+std::string ResetQueryStatsSentence::toString() const {
+    return std::string("RESET QUERY STATS");
+}
+
 std::string SpaceOptItem::toString() const {
     switch (optType_) {
         case PARTITION_NUM:
@@ -119,6 +119,46 @@ public:
     std::string toString() const override;
 };
 
+class ShowQueriesSentence final : public Sentence {
+public:
+    ShowQueriesSentence() {
+        kind_ = Kind::kShowQueries;
+    }
+    std::string toString() const override;
+};
+
+class KillQuerySentence final : public Sentence {
+public:
+    explicit KillQuerySentence(int64_t queryId) : queryId_(queryId) {
+        kind_ = Kind::kKillQuery;
+    }
+
+    std::string toString() const override;
+
+    int64_t queryId() const {
+        return queryId_;
+    }
+
+private:
+    int64_t             queryId_;
+};
+
+class ShowQueryStatsSentence final : public Sentence {
+public:
+    ShowQueryStatsSentence() {
+        kind_ = Kind::kShowQueryStats;
+    }
+    std::string toString() const override;
+};
+
+class ResetQueryStatsSentence final : public Sentence {
+public:
+    ResetQueryStatsSentence() {
+        kind_ = Kind::kResetQueryStats;
+    }
+    std::string toString() const override;
+};
+
 class SpaceOptItem final {
 public:
     using Value = boost::variant<int64_t, std::string>;
@@ -0,0 +1,33 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "parser/CursorSentences.h"
+
+namespace nebula {
+
+std::string DeclareCursorSentence::toString() const {
+    std::string buf;
+    buf.reserve(256);
+
+    buf += "DECLARE ";
+    buf += *name_;
+    buf += " CURSOR FOR ";
+    buf += sentence_->toString();
+    return buf;
+}
+
+std::string FetchCursorSentence::toString() const {
+    if (count_ < 0) {
+        return folly::stringPrintf("FETCH NEXT FROM %s", name_->c_str());
+    }
+    return folly::stringPrintf("FETCH NEXT %ld FROM %s", count_, name_->c_str());
+}
+
+std::string CloseCursorSentence::toString() const {
+    return folly::stringPrintf("CLOSE %s", name_->c_str());
+}
+
+}  // namespace nebula
@@ -0,0 +1,82 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+#ifndef PARSER_CURSORSENTENCES_H_
+#define PARSER_CURSORSENTENCES_H_
+
+#include "common/base/Base.h"
+#include "parser/Sentence.h"
+
+namespace nebula {
+
+// DECLARE name CURSOR FOR <query>
+class DeclareCursorSentence final : public Sentence {
+public:
+    DeclareCursorSentence(std::string *name, Sentence *sentence) {
+        kind_ = Kind::kDeclareCursor;
+        name_.reset(name);
+        sentence_.reset(sentence);
+    }
+
+    const std::string* name() const {
+        return name_.get();
+    }
+
+    Sentence* sentence() const {
+        return sentence_.get();
+    }
+
+    std::string toString() const override;
+
+private:
+    std::unique_ptr<std::string>    name_;
+    std::unique_ptr<Sentence>       sentence_;
+};
+
+// FETCH NEXT [count] FROM name
+class FetchCursorSentence final : public Sentence {
+public:
+    explicit FetchCursorSentence(std::string *name, int64_t count = -1) {
+        kind_ = Kind::kFetchCursor;
+        name_.reset(name);
+        count_ = count;
+    }
+
+    const std::string* name() const {
+        return name_.get();
+    }
+
+    // -1 if not given
+    int64_t count() const {
+        return count_;
+    }
+
+    std::string toString() const override;
+
+private:
+    std::unique_ptr<std::string>    name_;
+    int64_t                         count_{-1};
+};
+
+// CLOSE name
+class CloseCursorSentence final : public Sentence {
+public:
+    explicit CloseCursorSentence(std::string *name) {
+        kind_ = Kind::kCloseCursor;
+        name_.reset(name);
+    }
+
+    const std::string* name() const {
+        return name_.get();
+    }
+
+    std::string toString() const override;
+
+private:
+    std::unique_ptr<std::string>    name_;
+};
+
+}  // namespace nebula
+#endif  // PARSER_CURSORSENTENCES_H_
@@ -9,4 +9,11 @@
 #include "common/base/Base.h"
 
 namespace nebula {
+
+// static
+GQLParser& GQLParser::threadLocal() {
+    static thread_local GQLParser parser;
+    return parser;
+}
+
 }   // namespace nebula
@@ -37,13 +37,19 @@ public:
         if (sentences_ != nullptr) delete sentences_;
     }
 
-    StatusOr<std::unique_ptr<Sentence>> parse(std::string query) {
-        // Since GraphScanner needs a writable buffer, we have to copy the query string
-        buffer_ = std::move(query);
-        pos_ = &buffer_[0];
-        end_ = pos_ + buffer_.size();
+    // The parser of the current thread, reused by the queries to save constructing the scanner
+    // and the parser each time. It must not be used by the nested parsing of the same thread.
+    static GQLParser& threadLocal();
 
-        scanner_.setQuery(&buffer_);
+    StatusOr<std::unique_ptr<Sentence>> parse(const std::string &query) {
+        // The scanner copies the input into its own buffer by `readBuffer', so the query is
+        // only read and never copied here
+        pos_ = query.data();
+        end_ = pos_ + query.size();
+
+        // Reset the state left by the last parsing, i.e. the end of its input or a failure
+        scanner_.reset();
+        scanner_.setQuery(&query);
         if (parser_.parse() != 0) {
             pos_ = nullptr;
             end_ = nullptr;
@@ -57,17 +63,16 @@ public:
             return Status::SyntaxError(error_);
         }
 
+        scanner_.setQuery(nullptr);
         if (sentences_ == nullptr) {
             return Status::StatementEmpty();
         }
         auto *sentences = sentences_;
         sentences_ = nullptr;
-        scanner_.setQuery(nullptr);
         return std::unique_ptr<Sentence>(sentences);
     }
 
 private:
-    std::string                     buffer_;
     const char                     *pos_{nullptr};
     const char                     *end_{nullptr};
     nebula::GraphScanner            scanner_;
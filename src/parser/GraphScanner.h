@@ -43,11 +43,15 @@ public:
         yy_flush_buffer(yy_buffer_stack ? yy_buffer_stack[yy_buffer_stack_top] : nullptr);
     }
 
-    void setQuery(std::string *query) {
+    // Invoked by GQLParser before each parsing to drop all the state left by the last one,
+    // e.g. the start condition of a string or a comment not terminated, and the line number
+    void reset();
+
+    void setQuery(const std::string *query) {
         query_ = query;
     }
 
-    std::string* query() {
+    const std::string* query() {
         return query_;
     }
 
@@ -99,7 +103,7 @@ private:
     size_t                              sbufSize_{0};
     size_t                              sbufPos_{0};
     std::function<int(char*, int)>      readBuffer_;
-    std::string*                        query_{nullptr};
+    const std::string*                  query_{nullptr};
 };
 
 }   // namespace nebula
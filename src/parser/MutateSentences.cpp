@@ -236,11 +236,16 @@ std::string UpdateEdgeSentence::toString() const {
         buf += "UPDATE ";
     }
     buf += "EDGE ";
-    buf += srcId_->toString();
-    buf += "->";
-    buf += dstId_->toString();
-    buf += " AT" + std::to_string(rank_);
-    buf += " OF " + *name_;
+    if (edgeKeyRef_ != nullptr) {
+        buf += "ON " + *name_ + " ";
+        buf += edgeKeyRef_->toString();
+    } else {
+        buf += srcId_->toString();
+        buf += "->";
+        buf += dstId_->toString();
+        buf += " AT" + std::to_string(rank_);
+        buf += " OF " + *name_;
+    }
     buf += " SET ";
     buf += updateList_->toString();
     if (whenClause_ != nullptr) {
@@ -439,6 +439,12 @@ public:
         return vid_.get();
     }
 
+    // Whether the vertices updated are given by the input or a variable
+    bool isRef() const {
+        return vid_->kind() == Expression::Kind::kInputProperty ||
+               vid_->kind() == Expression::Kind::kVarProperty;
+    }
+
     const UpdateList* updateList() const {
         return updateList_.get();
     }
@@ -475,6 +481,17 @@ public:
         rank_ = rank;
     }
 
+    UpdateEdgeSentence(EdgeKeyRef *edgeKeyRef,
+                       std::string *edgeName,
+                       UpdateList *updateList,
+                       WhenClause *whenClause,
+                       YieldClause *yieldClause,
+                       bool isInsertable = false)
+        : UpdateBaseSentence(updateList, whenClause, yieldClause, edgeName, isInsertable) {
+        kind_ = Kind::kUpdateEdge;
+        edgeKeyRef_.reset(edgeKeyRef);
+    }
+
     Expression* getSrcId() const {
         return srcId_.get();
     }
@@ -487,12 +504,22 @@ public:
         return rank_;
     }
 
+    EdgeKeyRef* edgeKeyRef() const {
+        return edgeKeyRef_.get();
+    }
+
+    // Whether the edges updated are given by the input or a variable
+    bool isRef() const {
+        return edgeKeyRef_ != nullptr;
+    }
+
     std::string toString() const override;
 
 private:
     std::unique_ptr<Expression>                 srcId_;
     std::unique_ptr<Expression>                 dstId_;
     int64_t                                     rank_{0L};
+    std::unique_ptr<EdgeKeyRef>                 edgeKeyRef_;
 };
 
 
@@ -632,7 +659,7 @@ public:
 
 private:
     std::unique_ptr<std::string>                host_;
-    int32_t                                     port_;
+    int32_t                                     port_{0};
     std::unique_ptr<std::string>                path_;
 };
 
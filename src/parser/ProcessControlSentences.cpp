@@ -22,4 +22,65 @@ std::string ReturnSentence::toString() const {
     }
     return buf;
 }
+
+std::string PrepareSentence::toString() const {
+    std::string buf;
+    buf.reserve(256);
+
+    buf += "PREPARE ";
+    buf += *name_;
+    buf += " FROM \"";
+    buf += *query_;
+    buf += "\"";
+    return buf;
+}
+
+std::string ParameterList::toString() const {
+    std::string buf;
+    buf.reserve(256);
+
+    for (auto &param : params_) {
+        if (!buf.empty()) {
+            buf += ", ";
+        }
+        buf += "$";
+        buf += *param.first;
+        buf += " = ";
+        buf += param.second->toString();
+    }
+    return buf;
+}
+
+std::string ExecuteSentence::toString() const {
+    std::string buf;
+    buf.reserve(256);
+
+    buf += "EXECUTE ";
+    buf += *name_;
+    if (params_ != nullptr) {
+        buf += " USING ";
+        buf += params_->toString();
+    }
+    return buf;
+}
+
+std::string DeallocateSentence::toString() const {
+    return folly::stringPrintf("DEALLOCATE PREPARE %s", name_->c_str());
+}
+
+std::string BatchSentence::toString() const {
+    std::string buf;
+    buf.reserve(256);
+
+    buf += "BATCH ";
+    for (size_t i = 0; i < queries_.size(); ++i) {
+        if (i > 0) {
+            buf += ", ";
+        }
+        buf += "\"";
+        buf += queries_[i];
+        buf += "\"";
+    }
+    return buf;
+}
 }  // namespace nebula
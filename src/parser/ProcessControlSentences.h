@@ -7,6 +7,7 @@
 #define PARSER_PROCESSCONTROLSENTENCES_H_
 
 #include "common/base/Base.h"
+#include "common/expression/Expression.h"
 #include "parser/Sentence.h"
 
 namespace nebula {
@@ -32,5 +33,110 @@ private:
     std::unique_ptr<std::string>    condition_;
     std::unique_ptr<std::string>    var_;
 };
+
+class PrepareSentence final : public Sentence {
+public:
+    PrepareSentence(std::string *name, std::string *query) {
+        kind_ = Kind::kPrepare;
+        name_.reset(name);
+        query_.reset(query);
+    }
+
+    const std::string* name() const {
+        return name_.get();
+    }
+
+    const std::string* query() const {
+        return query_.get();
+    }
+
+    std::string toString() const override;
+
+private:
+    std::unique_ptr<std::string>    name_;
+    std::unique_ptr<std::string>    query_;
+};
+
+// The values of the parameters, e.g. `$p1 = "a", $p2 = "b"'
+class ParameterList final {
+public:
+    void add(std::string *name, Expression *expr) {
+        params_.emplace_back(std::unique_ptr<std::string>(name),
+                             std::unique_ptr<Expression>(expr));
+    }
+
+    const std::vector<std::pair<std::unique_ptr<std::string>, std::unique_ptr<Expression>>>&
+    params() const {
+        return params_;
+    }
+
+    std::string toString() const;
+
+private:
+    std::vector<std::pair<std::unique_ptr<std::string>, std::unique_ptr<Expression>>> params_;
+};
+
+class ExecuteSentence final : public Sentence {
+public:
+    ExecuteSentence(std::string *name, ParameterList *params) {
+        kind_ = Kind::kExecute;
+        name_.reset(name);
+        params_.reset(params);
+    }
+
+    const std::string* name() const {
+        return name_.get();
+    }
+
+    // nullptr if no USING clause
+    const ParameterList* params() const {
+        return params_.get();
+    }
+
+    std::string toString() const override;
+
+private:
+    std::unique_ptr<std::string>    name_;
+    std::unique_ptr<ParameterList>  params_;
+};
+
+class DeallocateSentence final : public Sentence {
+public:
+    explicit DeallocateSentence(std::string *name) {
+        kind_ = Kind::kDeallocate;
+        name_.reset(name);
+    }
+
+    const std::string* name() const {
+        return name_.get();
+    }
+
+    std::string toString() const override;
+
+private:
+    std::unique_ptr<std::string>    name_;
+};
+
+// BATCH "query", "query", ...
+class BatchSentence final : public Sentence {
+public:
+    BatchSentence() {
+        kind_ = Kind::kBatch;
+    }
+
+    void addQuery(std::string *query) {
+        queries_.emplace_back(std::move(*query));
+        delete query;
+    }
+
+    const std::vector<std::string>& queries() const {
+        return queries_;
+    }
+
+    std::string toString() const override;
+
+private:
+    std::vector<std::string>        queries_;
+};
 }  // namespace nebula
 #endif  // PARSER_PROCESSCONTROLSENTENCES_H_
@@ -105,6 +105,17 @@ public:
         kDropSnapshot,
         kAdminJob,
         kGetSubgraph,
+        kShowQueries,
+        kKillQuery,
+        kShowQueryStats,
+        kResetQueryStats,
+        kPrepare,
+        kExecute,
+        kDeallocate,
+        kBatch,
+        kDeclareCursor,
+        kFetchCursor,
+        kCloseCursor,
     };
 
     Kind kind() const {
@@ -15,6 +15,7 @@
 #include "parser/UserSentences.h"
 #include "parser/MatchSentence.h"
 #include "parser/ProcessControlSentences.h"
+#include "parser/CursorSentences.h"
 
 namespace nebula {
 
@@ -112,6 +112,8 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
     MatchEdge                              *match_edge;
     MatchEdgeProp                          *match_edge_prop;
     MatchReturn                            *match_return;
+    nebula::ParameterList                  *param_list;
+    nebula::BatchSentence                  *batch_sentence;
 }
 
 /* destructors */
@@ -142,6 +144,9 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %token KW_IS KW_NULL KW_DEFAULT
 %token KW_SNAPSHOT KW_SNAPSHOTS KW_LOOKUP
 %token KW_JOBS KW_JOB KW_RECOVER KW_FLUSH KW_COMPACT KW_SUBMIT
+%token KW_KILL KW_QUERY KW_QUERIES KW_STATS KW_RESET
+%token KW_PREPARE KW_EXECUTE KW_DEALLOCATE KW_USING KW_BATCH
+%token KW_CURSOR KW_FOR KW_NEXT KW_CLOSE
 %token KW_BIDIRECT
 %token KW_USER KW_USERS KW_ACCOUNT
 %token KW_PASSWORD KW_CHANGE KW_ROLE KW_ROLES
@@ -171,7 +176,7 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %type <expr> input_prop_expression
 %type <expr> var_prop_expression
 %type <expr> vid_ref_expression
-%type <expr> vid
+%type <expr> vid param_vid
 %type <expr> function_call_expression
 %type <expr> uuid_expression
 %type <expr> list_expression
@@ -185,7 +190,7 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %type <type> type_spec
 %type <step_clause> step_clause
 %type <from_clause> from_clause
-%type <vid_list> vid_list
+%type <vid_list> vid_list param_vid_list
 %type <over_edge> over_edge
 %type <over_edges> over_edges
 %type <over_clause> over_clause
@@ -259,6 +264,7 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %type <sentence> describe_tag_index_sentence describe_edge_index_sentence
 %type <sentence> rebuild_tag_index_sentence rebuild_edge_index_sentence
 %type <sentence> create_snapshot_sentence drop_snapshot_sentence
+%type <sentence> kill_query_sentence reset_query_stats_sentence
 
 %type <sentence> admin_job_sentence
 %type <sentence> create_user_sentence alter_user_sentence drop_user_sentence change_password_sentence
@@ -280,6 +286,11 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %type <sentence> grant_sentence revoke_sentence
 %type <sentence> set_config_sentence get_config_sentence balance_sentence
 %type <sentence> process_control_sentence return_sentence
+%type <sentence> prepare_sentence execute_sentence deallocate_sentence batch_sentence
+%type <sentence> cursor_sentence declare_cursor_sentence fetch_cursor_sentence
+%type <sentence> close_cursor_sentence
+%type <param_list> param_list opt_using_clause
+%type <batch_sentence> batch_query_list
 %type <sentence> sentence
 %type <seq_sentences> seq_sentences
 %type <explain_sentence> explain_sentence
@@ -344,6 +355,21 @@ unreserved_keyword
     | KW_UUID               { $$ = new std::string("uuid"); }
     | KW_JOB                { $$ = new std::string("job"); }
     | KW_JOBS               { $$ = new std::string("jobs"); }
+    | KW_KILL               { $$ = new std::string("kill"); }
+    | KW_QUERY              { $$ = new std::string("query"); }
+    | KW_QUERIES            { $$ = new std::string("queries"); }
+    | KW_STATS              { $$ = new std::string("stats"); }
+    | KW_RESET              { $$ = new std::string("reset"); }
+    | KW_PREPARE            { $$ = new std::string("prepare"); }
+    | KW_EXECUTE            { $$ = new std::string("execute"); }
+    | KW_DEALLOCATE         { $$ = new std::string("deallocate"); }
+    | KW_USING              { $$ = new std::string("using"); }
+    | KW_BATCH              { $$ = new std::string("batch"); }
+    | KW_DECLARE            { $$ = new std::string("declare"); }
+    | KW_CURSOR             { $$ = new std::string("cursor"); }
+    | KW_FOR                { $$ = new std::string("for"); }
+    | KW_NEXT               { $$ = new std::string("next"); }
+    | KW_CLOSE              { $$ = new std::string("close"); }
     | KW_BIDIRECT           { $$ = new std::string("bidirect"); }
     | KW_OFFLINE            { $$ = new std::string("offline"); }
     | KW_FORCE              { $$ = new std::string("force"); }
@@ -735,7 +761,7 @@ step_clause
     ;
 
 from_clause
-    : KW_FROM vid_list {
+    : KW_FROM param_vid_list {
         $$ = new FromClause($2);
     }
     | KW_FROM vid_ref_expression {
@@ -754,6 +780,27 @@ vid_list
     }
     ;
 
+/* The `$param' placeholders are bound by EXECUTE, only allowed in the prepared statements */
+param_vid_list
+    : param_vid {
+        $$ = new VertexIDList();
+        $$->add($1);
+    }
+    | param_vid_list COMMA param_vid {
+        $$ = $1;
+        $$->add($3);
+    }
+    ;
+
+param_vid
+    : vid {
+        $$ = $1;
+    }
+    | VARIABLE {
+        $$ = new VariableExpression($1);
+    }
+    ;
+
 /* The difference from 1.0 is that 2.0 only supports vid of type STRING */
 vid
     : function_call_expression {
@@ -1041,13 +1088,13 @@ order_by_sentence
     ;
 
 fetch_vertices_sentence
-    : KW_FETCH KW_PROP KW_ON name_label vid_list yield_clause {
+    : KW_FETCH KW_PROP KW_ON name_label param_vid_list yield_clause {
         $$ = new FetchVerticesSentence($4, $5, $6);
     }
     | KW_FETCH KW_PROP KW_ON name_label vid_ref_expression yield_clause {
         $$ = new FetchVerticesSentence($4, $5, $6);
     }
-    | KW_FETCH KW_PROP KW_ON STAR vid_list {
+    | KW_FETCH KW_PROP KW_ON STAR param_vid_list {
         $$ = new FetchVerticesSentence($5);
     }
     | KW_FETCH KW_PROP KW_ON STAR vid_ref_expression {
@@ -1141,7 +1188,7 @@ find_path_upto_clause
     ;
 
 to_clause
-    : KW_TO vid_list {
+    : KW_TO param_vid_list {
         $$ = new ToClause($2);
     }
     | KW_TO vid_ref_expression {
@@ -1494,6 +1541,8 @@ traverse_sentence
     | get_subgraph_sentence { $$ = $1; }
     | delete_vertex_sentence { $$ = $1; }
     | delete_edge_sentence { $$ = $1; }
+    | update_vertex_sentence { $$ = $1; }
+    | update_edge_sentence { $$ = $1; }
     ;
 
 piped_sentence
@@ -1703,6 +1752,16 @@ update_vertex_sentence
         auto sentence = new UpdateVertexSentence($5, $4, $7, $8, $9, true);
         $$ = sentence;
     }
+    | KW_UPDATE KW_VERTEX KW_ON name_label vid_ref_expression
+      KW_SET update_list when_clause yield_clause {
+        auto sentence = new UpdateVertexSentence($5, $4, $7, $8, $9);
+        $$ = sentence;
+    }
+    | KW_UPSERT KW_VERTEX KW_ON name_label vid_ref_expression
+      KW_SET update_list when_clause yield_clause {
+        auto sentence = new UpdateVertexSentence($5, $4, $7, $8, $9, true);
+        $$ = sentence;
+    }
     ;
 
 update_edge_sentence
@@ -1748,6 +1807,16 @@ update_edge_sentence
         auto sentence = new UpdateEdgeSentence($5, $7, $9, $4, $11, $12, $13, true);
         $$ = sentence;
     }
+    | KW_UPDATE KW_EDGE KW_ON name_label edge_key_ref
+      KW_SET update_list when_clause yield_clause {
+        auto sentence = new UpdateEdgeSentence($5, $4, $7, $8, $9);
+        $$ = sentence;
+    }
+    | KW_UPSERT KW_EDGE KW_ON name_label edge_key_ref
+      KW_SET update_list when_clause yield_clause {
+        auto sentence = new UpdateEdgeSentence($5, $4, $7, $8, $9, true);
+        $$ = sentence;
+    }
     ;
 
 delete_vertex_sentence
@@ -1898,6 +1967,12 @@ show_sentence
     | KW_SHOW KW_COLLATION {
         $$ = new ShowCollationSentence();
     }
+    | KW_SHOW KW_QUERIES {
+        $$ = new ShowQueriesSentence();
+    }
+    | KW_SHOW KW_QUERY KW_STATS {
+        $$ = new ShowQueryStatsSentence();
+    }
     ;
 
 config_module_enum
@@ -2164,11 +2239,21 @@ drop_snapshot_sentence
     }
     ;
 
+kill_query_sentence
+    : KW_KILL KW_QUERY legal_integer {
+        $$ = new KillQuerySentence($3);
+    }
+    ;
+
+reset_query_stats_sentence
+    : KW_RESET KW_QUERY KW_STATS {
+        $$ = new ResetQueryStatsSentence();
+    }
+    ;
+
 mutate_sentence
     : insert_vertex_sentence { $$ = $1; }
     | insert_edge_sentence { $$ = $1; }
-    | update_vertex_sentence { $$ = $1; }
-    | update_edge_sentence { $$ = $1; }
     | download_sentence { $$ = $1; }
     | ingest_sentence { $$ = $1; }
     | admin_job_sentence { $$ = $1; }
@@ -2205,6 +2290,8 @@ maintain_sentence
     | get_config_sentence { $$ = $1; }
     | set_config_sentence { $$ = $1; }
     | balance_sentence { $$ = $1; }
+    | kill_query_sentence { $$ = $1; }
+    | reset_query_stats_sentence { $$ = $1; }
     | create_snapshot_sentence { $$ = $1; };
     | drop_snapshot_sentence { $$ = $1; };
     ;
@@ -2214,8 +2301,91 @@ return_sentence
         $$ = new ReturnSentence($2, $4);
     }
 
+prepare_sentence
+    : KW_PREPARE name_label KW_FROM STRING {
+        $$ = new PrepareSentence($2, $4);
+    }
+    ;
+
+execute_sentence
+    : KW_EXECUTE name_label opt_using_clause {
+        $$ = new ExecuteSentence($2, $3);
+    }
+    ;
+
+opt_using_clause
+    : %empty { $$ = nullptr; }
+    | KW_USING param_list { $$ = $2; }
+    ;
+
+param_list
+    : VARIABLE ASSIGN expression {
+        $$ = new ParameterList();
+        $$->add($1, $3);
+    }
+    | param_list COMMA VARIABLE ASSIGN expression {
+        $$ = $1;
+        $$->add($3, $5);
+    }
+    ;
+
+deallocate_sentence
+    : KW_DEALLOCATE name_label {
+        $$ = new DeallocateSentence($2);
+    }
+    | KW_DEALLOCATE KW_PREPARE name_label {
+        $$ = new DeallocateSentence($3);
+    }
+    ;
+
+batch_query_list
+    : KW_BATCH STRING {
+        $$ = new BatchSentence();
+        $$->addQuery($2);
+    }
+    | batch_query_list COMMA STRING {
+        $$ = $1;
+        $$->addQuery($3);
+    }
+    ;
+
+batch_sentence
+    : batch_query_list { $$ = $1; }
+    ;
+
 process_control_sentence
     : return_sentence { $$ = $1; }
+    | prepare_sentence { $$ = $1; }
+    | execute_sentence { $$ = $1; }
+    | deallocate_sentence { $$ = $1; }
+    | batch_sentence { $$ = $1; }
+    ;
+
+declare_cursor_sentence
+    : KW_DECLARE name_label KW_CURSOR KW_FOR set_sentence {
+        $$ = new DeclareCursorSentence($2, $5);
+    }
+    ;
+
+fetch_cursor_sentence
+    : KW_FETCH KW_NEXT KW_FROM name_label {
+        $$ = new FetchCursorSentence($4);
+    }
+    | KW_FETCH KW_NEXT legal_integer KW_FROM name_label {
+        $$ = new FetchCursorSentence($5, $3);
+    }
+    ;
+
+close_cursor_sentence
+    : KW_CLOSE name_label {
+        $$ = new CloseCursorSentence($2);
+    }
+    ;
+
+cursor_sentence
+    : declare_cursor_sentence { $$ = $1; }
+    | fetch_cursor_sentence { $$ = $1; }
+    | close_cursor_sentence { $$ = $1; }
     ;
 
 sentence
@@ -2225,6 +2395,7 @@ sentence
     | assignment_sentence { $$ = $1; }
     | mutate_sentence { $$ = $1; }
     | process_control_sentence { $$ = $1; }
+    | cursor_sentence { $$ = $1; }
     ;
 
 seq_sentences
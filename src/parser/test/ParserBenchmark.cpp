@@ -5,11 +5,18 @@
  */
 #include "common/base/Base.h"
 #include <folly/Benchmark.h>
+#include <folly/FileUtil.h>
 #include "parser/GQLParser.h"
 #include "common/expression/Expression.h"
 
+DEFINE_string(corpus, "", "The source file of the queries benchmarked as a corpus, "
+                          "ParserTest.cpp beside this file by default");
+
 using nebula::GQLParser;
 
+// The queries in `std::string query = "...";' of the corpus file
+std::vector<std::string> corpus;
+
 auto simpleQuery =  "USE myspace";
 auto complexQuery =  "GO UPTO 2 STEPS FROM 123456789 OVER myedge "
                      "WHERE alias.prop1 + alias.prop2 * alias.prop3 > alias.prop4 && "
@@ -64,6 +71,77 @@ size_t ComplexQuery(size_t iters, size_t nrThreads) {
     return iters * ops;
 }
 
+// Extract the queries from the C++ string literals in the form of the tests
+std::vector<std::string> loadCorpus(const std::string &path) {
+    std::string content;
+    CHECK(folly::readFile(path.c_str(), content)) << "Failed to read " << path;
+    static const std::string kPrefix = "std::string query = ";
+    std::vector<std::string> queries;
+    auto pos = content.find(kPrefix);
+    while (pos != std::string::npos) {
+        pos += kPrefix.size();
+        std::string query;
+        // Adjacent literals are concatenated until the `;'
+        while (pos < content.size() && content[pos] != ';') {
+            if (content[pos] != '"') {
+                ++pos;
+                continue;
+            }
+            for (++pos; pos < content.size() && content[pos] != '"'; ++pos) {
+                if (content[pos] != '\\' || pos + 1 == content.size()) {
+                    query.push_back(content[pos]);
+                    continue;
+                }
+                auto escaped = content[++pos];
+                switch (escaped) {
+                    case 'n':
+                        query.push_back('\n');
+                        break;
+                    case 't':
+                        query.push_back('\t');
+                        break;
+                    default:
+                        query.push_back(escaped);
+                        break;
+                }
+            }
+            ++pos;
+        }
+        queries.emplace_back(std::move(query));
+        pos = content.find(kPrefix, pos);
+    }
+    return queries;
+}
+
+// Parse the whole corpus with a new parser for each query, as graphd did
+size_t CorpusNewParser(size_t iters) {
+    for (auto i = 0UL; i < iters; i++) {
+        for (auto &query : corpus) {
+            GQLParser parser;
+            auto result = parser.parse(query);
+            folly::doNotOptimizeAway(result);
+        }
+    }
+    return iters * corpus.size();
+}
+
+// Parse the whole corpus with the parser of the thread
+size_t CorpusThreadLocalParser(size_t iters) {
+    auto &parser = GQLParser::threadLocal();
+    for (auto i = 0UL; i < iters; i++) {
+        for (auto &query : corpus) {
+            auto result = parser.parse(query);
+            folly::doNotOptimizeAway(result);
+        }
+    }
+    return iters * corpus.size();
+}
+
+BENCHMARK_MULTI(CorpusNewParser)
+BENCHMARK_RELATIVE_MULTI(CorpusThreadLocalParser)
+
+BENCHMARK_DRAW_LINE();
+
 BENCHMARK_NAMED_PARAM_MULTI(SimpleQuery, 1_thread, 1)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(SimpleQuery, 2_thread, 2)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(SimpleQuery, 4_thread, 4)
@@ -85,6 +163,13 @@ BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(ComplexQuery, 48_thread, 48)
 int
 main(int argc, char **argv) {
     gflags::ParseCommandLineFlags(&argc, &argv, true);
+    if (FLAGS_corpus.empty()) {
+        std::string file = __FILE__;
+        FLAGS_corpus = file.substr(0, file.rfind('/') + 1) + "ParserTest.cpp";
+    }
+    corpus = loadCorpus(FLAGS_corpus);
+    CHECK(!corpus.empty()) << "No query in " << FLAGS_corpus;
+    LOG(INFO) << corpus.size() << " queries in the corpus";
     {
         GQLParser parser;
         auto result = parser.parse(simpleQuery);
@@ -820,6 +820,31 @@ TEST(Parser, UpdateVertex) {
         auto result = parser.parse(query);
         ASSERT_TRUE(result.ok()) << result.status();
     }
+    // piped
+    {
+        GQLParser parser;
+        std::string query = "GO FROM \"12345\" OVER like "
+                            "YIELD like._dst AS id, like.score AS score "
+                            "| UPDATE VERTEX ON person $-.id "
+                            "SET score = $-.score "
+                            "WHEN score < $-.score "
+                            "YIELD $-.id AS id, score";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "$var = GO FROM \"12345\" OVER like YIELD like._dst AS id; "
+                            "UPSERT VERTEX ON person $var.id SET age = age + 1";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "UPDATE VERTEX $-.id SET person.age = 1";
+        auto result = parser.parse(query);
+        ASSERT_FALSE(result.ok());
+    }
 }
 
 TEST(Parser, InsertEdge) {
@@ -960,6 +985,28 @@ TEST(Parser, UpdateEdge) {
         auto result = parser.parse(query);
         ASSERT_TRUE(result.ok()) << result.status();
     }
+    // piped
+    {
+        GQLParser parser;
+        std::string query = "GO FROM \"1\" OVER transfer "
+                            "YIELD transfer._src AS src, transfer._dst AS dst, "
+                            "transfer._rank AS rank, transfer.amount AS amount "
+                            "| UPDATE EDGE ON transfer $-.src -> $-.dst @ $-.rank "
+                            "SET amount = amount + $-.amount "
+                            "WHEN amount > 3.14 "
+                            "YIELD amount";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "$var = GO FROM \"1\" OVER transfer "
+                            "YIELD transfer._src AS src, transfer._dst AS dst; "
+                            "UPSERT EDGE ON transfer $var.src -> $var.dst "
+                            "SET time = 1537408527";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
 }
 
 TEST(Parser, DeleteVertex) {
@@ -1373,6 +1420,183 @@ TEST(Parser, AdminOperation) {
         auto result = parser.parse(query);
         ASSERT_TRUE(result.ok()) << result.status();
     }
+    {
+        GQLParser parser;
+        std::string query = "SHOW QUERIES";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "SHOW QUERY STATS";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), "SHOW QUERY STATS");
+    }
+    {
+        GQLParser parser;
+        std::string query = "RESET QUERY STATS";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), "RESET QUERY STATS");
+    }
+}
+
+TEST(Parser, KillQuery) {
+    {
+        GQLParser parser;
+        std::string query = "KILL QUERY 1";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), "KILL QUERY 1");
+    }
+    {
+        GQLParser parser;
+        std::string query = "KILL QUERY";
+        auto result = parser.parse(query);
+        ASSERT_FALSE(result.ok());
+    }
+}
+
+TEST(Parser, PreparedStatement) {
+    {
+        GQLParser parser;
+        std::string query = "PREPARE q1 FROM \"GO FROM $p1, \\\"1\\\" OVER like\"";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), "PREPARE q1 FROM \"GO FROM $p1, \"1\" OVER like\"");
+    }
+    {
+        GQLParser parser;
+        std::string query = "GO FROM $p1 OVER like";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "FETCH PROP ON person $p1, $p2";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "EXECUTE q1";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), "EXECUTE q1");
+    }
+    {
+        GQLParser parser;
+        std::string query = "EXECUTE q1 USING $p1 = \"1\", $p2 = \"2\"";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "EXECUTE q1 USING";
+        auto result = parser.parse(query);
+        ASSERT_FALSE(result.ok());
+    }
+    {
+        GQLParser parser;
+        std::string query = "DEALLOCATE q1";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), "DEALLOCATE PREPARE q1");
+    }
+    {
+        GQLParser parser;
+        std::string query = "DEALLOCATE PREPARE q1";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), "DEALLOCATE PREPARE q1");
+    }
+    // The keywords are not reserved
+    {
+        GQLParser parser;
+        std::string query = "CREATE TAG prepare(execute string, deallocate int, using int)";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+}
+
+TEST(Parser, Batch) {
+    {
+        GQLParser parser;
+        std::string query = "BATCH \"YIELD 1\", \"FETCH PROP ON person \\\"1\\\"\"";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(),
+                  "BATCH \"YIELD 1\", \"FETCH PROP ON person \"1\"\"");
+    }
+    {
+        GQLParser parser;
+        std::string query = "BATCH \"YIELD 1\"";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "BATCH";
+        auto result = parser.parse(query);
+        ASSERT_FALSE(result.ok());
+    }
+    {
+        GQLParser parser;
+        std::string query = "BATCH YIELD 1";
+        auto result = parser.parse(query);
+        ASSERT_FALSE(result.ok());
+    }
+}
+
+TEST(Parser, Cursor) {
+    {
+        GQLParser parser;
+        std::string query = "DECLARE c1 CURSOR FOR GO FROM \"1\" OVER like | LIMIT 10";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "DECLARE c1 CURSOR FOR YIELD 1";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), "DECLARE c1 CURSOR FOR YIELD 1");
+    }
+    {
+        GQLParser parser;
+        std::string query = "DECLARE c1 CURSOR";
+        auto result = parser.parse(query);
+        ASSERT_FALSE(result.ok());
+    }
+    {
+        GQLParser parser;
+        std::string query = "FETCH NEXT FROM c1";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), "FETCH NEXT FROM c1");
+    }
+    {
+        GQLParser parser;
+        std::string query = "FETCH NEXT 100 FROM c1";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), "FETCH NEXT 100 FROM c1");
+    }
+    {
+        GQLParser parser;
+        std::string query = "CLOSE c1";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), "CLOSE c1");
+    }
+    // The keywords are not reserved
+    {
+        GQLParser parser;
+        std::string query = "CREATE TAG cursor(next string, close int, declare int)";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
 }
 
 TEST(Parser, UserOperation) {
@@ -2352,4 +2576,52 @@ TEST(Parser, Match) {
     }
 }
 
+TEST(Parser, ReuseParser) {
+    auto &parser = GQLParser::threadLocal();
+    ASSERT_EQ(&parser, &GQLParser::threadLocal());
+    {
+        auto result = parser.parse("GO FROM \"1\" OVER friend");
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(Sentence::Kind::kSequential, result.value()->kind());
+    }
+    // The failure in the middle of a query
+    {
+        auto result = parser.parse("GO FROM \"1\" OVER friend WHERE");
+        ASSERT_FALSE(result.ok());
+    }
+    // The failures leaving the scanner in a string or a comment
+    for (auto query : {"YIELD \"abc", "YIELD 'abc", "YIELD \"a\nbc\"", "YIELD 1 /* comment"}) {
+        auto result = parser.parse(query);
+        ASSERT_FALSE(result.ok()) << query;
+        result = parser.parse("YIELD 1");
+        ASSERT_TRUE(result.ok()) << query << ": " << result.status();
+    }
+    // The unary minus left by the failure must not change the next query
+    {
+        auto result = parser.parse("YIELD -");
+        ASSERT_FALSE(result.ok());
+        result = parser.parse("YIELD 9223372036854775808");
+        ASSERT_FALSE(result.ok());
+    }
+    {
+        auto result = parser.parse("");
+        ASSERT_TRUE(result.status().isStatementEmpty());
+    }
+    {
+        auto result = parser.parse("YIELD 1; YIELD 2");
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    // Each thread has its own parser
+    {
+        GQLParser *other = nullptr;
+        std::thread thread([&other] () {
+            other = &GQLParser::threadLocal();
+            auto result = other->parse("YIELD 1");
+            ASSERT_TRUE(result.ok()) << result.status();
+        });
+        thread.join();
+        ASSERT_NE(&parser, other);
+    }
+}
+
 }   // namespace nebula
@@ -8,6 +8,7 @@
 #include "planner/Admin.h"
 
 #include "common/interface/gen-cpp2/graph_types.h"
+#include "context/PreparedStatement.h"
 #include "util/ToJson.h"
 
 namespace nebula {
@@ -161,5 +162,30 @@ std::unique_ptr<cpp2::PlanNodeDescription> ShowBalance::explain() const {
     return desc;
 }
 
+std::unique_ptr<cpp2::PlanNodeDescription> KillQuery::explain() const {
+    auto desc = SingleInputNode::explain();
+    addDescription("queryId", util::toJson(queryId_), desc.get());
+    return desc;
+}
+
+std::unique_ptr<cpp2::PlanNodeDescription> Prepare::explain() const {
+    auto desc = SingleInputNode::explain();
+    addDescription("name", name_, desc.get());
+    addDescription("query", statement_->query(), desc.get());
+    return desc;
+}
+
+std::unique_ptr<cpp2::PlanNodeDescription> Deallocate::explain() const {
+    auto desc = SingleInputNode::explain();
+    addDescription("name", name_, desc.get());
+    return desc;
+}
+
+std::unique_ptr<cpp2::PlanNodeDescription> Batch::explain() const {
+    auto desc = SingleInputNode::explain();
+    addDescription("queries", folly::toJson(util::toJson(queries_)), desc.get());
+    return desc;
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -20,6 +20,8 @@
 namespace nebula {
 namespace graph {
 
+class PreparedStatement;
+
 // Some template node such as Create template for the node create something(user,tag...)
 // Fit the conflict create process
 class CreateNode : public SingleDependencyNode {
@@ -767,6 +769,129 @@ private:
     explicit ShowCollation(int64_t id, PlanNode* input)
         : SingleInputNode(id, Kind::kShowCollation, input) {}
 };
+
+class ShowQueries final : public SingleInputNode {
+public:
+    static ShowQueries* make(QueryContext* qctx, PlanNode* input) {
+        return qctx->objPool()->add(new ShowQueries(qctx->genId(), input));
+    }
+
+private:
+    explicit ShowQueries(int64_t id, PlanNode* input)
+        : SingleInputNode(id, Kind::kShowQueries, input) {}
+};
+
+class KillQuery final : public SingleInputNode {
+public:
+    static KillQuery* make(QueryContext* qctx, PlanNode* input, int64_t queryId) {
+        return qctx->objPool()->add(new KillQuery(qctx->genId(), input, queryId));
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
+    int64_t queryId() const {
+        return queryId_;
+    }
+
+private:
+    KillQuery(int64_t id, PlanNode* input, int64_t queryId)
+        : SingleInputNode(id, Kind::kKillQuery, input), queryId_(queryId) {}
+
+    int64_t queryId_;
+};
+
+class ShowQueryStats final : public SingleInputNode {
+public:
+    static ShowQueryStats* make(QueryContext* qctx, PlanNode* input) {
+        return qctx->objPool()->add(new ShowQueryStats(qctx->genId(), input));
+    }
+
+private:
+    explicit ShowQueryStats(int64_t id, PlanNode* input)
+        : SingleInputNode(id, Kind::kShowQueryStats, input) {}
+};
+
+class ResetQueryStats final : public SingleInputNode {
+public:
+    static ResetQueryStats* make(QueryContext* qctx, PlanNode* input) {
+        return qctx->objPool()->add(new ResetQueryStats(qctx->genId(), input));
+    }
+
+private:
+    explicit ResetQueryStats(int64_t id, PlanNode* input)
+        : SingleInputNode(id, Kind::kResetQueryStats, input) {}
+};
+
+class Prepare final : public SingleInputNode {
+public:
+    static Prepare* make(QueryContext* qctx,
+                         PlanNode* input,
+                         std::string name,
+                         std::shared_ptr<const PreparedStatement> statement) {
+        return qctx->objPool()->add(
+            new Prepare(qctx->genId(), input, std::move(name), std::move(statement)));
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
+    const std::string& name() const {
+        return name_;
+    }
+
+    const std::shared_ptr<const PreparedStatement>& statement() const {
+        return statement_;
+    }
+
+private:
+    Prepare(int64_t id,
+            PlanNode* input,
+            std::string name,
+            std::shared_ptr<const PreparedStatement> statement)
+        : SingleInputNode(id, Kind::kPrepare, input),
+          name_(std::move(name)),
+          statement_(std::move(statement)) {}
+
+    std::string                                 name_;
+    std::shared_ptr<const PreparedStatement>    statement_;
+};
+
+class Deallocate final : public SingleInputNode {
+public:
+    static Deallocate* make(QueryContext* qctx, PlanNode* input, std::string name) {
+        return qctx->objPool()->add(new Deallocate(qctx->genId(), input, std::move(name)));
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
+    const std::string& name() const {
+        return name_;
+    }
+
+private:
+    Deallocate(int64_t id, PlanNode* input, std::string name)
+        : SingleInputNode(id, Kind::kDeallocate, input), name_(std::move(name)) {}
+
+    std::string                                 name_;
+};
+
+class Batch final : public SingleInputNode {
+public:
+    static Batch* make(QueryContext* qctx, PlanNode* input, std::vector<std::string> queries) {
+        return qctx->objPool()->add(new Batch(qctx->genId(), input, std::move(queries)));
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
+    const std::vector<std::string>& queries() const {
+        return queries_;
+    }
+
+private:
+    Batch(int64_t id, PlanNode* input, std::vector<std::string> queries)
+        : SingleInputNode(id, Kind::kBatch, input), queries_(std::move(queries)) {}
+
+    std::vector<std::string>                    queries_;
+};
 }  // namespace graph
 }  // namespace nebula
 #endif  // PLANNER_ADMIN_H_
@@ -55,6 +55,7 @@ std::unique_ptr<cpp2::PlanNodeDescription> UpdateVertex::explain() const {
     auto desc = Update::explain();
     addDescription("vid", folly::to<std::string>(vId_), desc.get());
     addDescription("tagId", folly::to<std::string>(tagId_), desc.get());
+    addDescription("vidRef", vidRef_ ? vidRef_->toString() : "", desc.get());
     return desc;
 }
 
@@ -64,6 +65,7 @@ std::unique_ptr<cpp2::PlanNodeDescription> UpdateEdge::explain() const {
     addDescription("dstId", dstId_, desc.get());
     addDescription("rank", folly::to<std::string>(rank_), desc.get());
     addDescription("edgeType", folly::to<std::string>(edgeType_), desc.get());
+    addDescription("edgeKeyRef", edgeKeyRef_ ? edgeKeyRef_->toString() : "", desc.get());
     return desc;
 }
 
@@ -219,6 +219,15 @@ public:
         return tagId_;
     }
 
+    // The vids evaluated on each row of the input for the piped update, null for only one vid
+    Expression* getVidRef() const {
+        return vidRef_;
+    }
+
+    void setVidRef(Expression* vidRef) {
+        vidRef_ = vidRef;
+    }
+
 private:
     UpdateVertex(int64_t id,
                  PlanNode* input,
@@ -247,6 +256,7 @@ private:
 private:
     std::string vId_;
     TagID tagId_{-1};
+    Expression* vidRef_{nullptr};
 };
 
 class UpdateEdge final : public Update {
@@ -301,6 +311,16 @@ public:
         return updatedProps_;
     }
 
+    // The edge keys evaluated on each row of the input for the piped update, with the source
+    // and the destination swapped for the reversed edge type, null for only one edge
+    EdgeKeyRef* getEdgeKeyRef() const {
+        return edgeKeyRef_;
+    }
+
+    void setEdgeKeyRef(EdgeKeyRef* edgeKeyRef) {
+        edgeKeyRef_ = edgeKeyRef;
+    }
+
 private:
     UpdateEdge(int64_t id,
                PlanNode* input,
@@ -335,6 +355,7 @@ private:
     std::string dstId_;
     int64_t rank_{0};
     EdgeType edgeType_{-1};
+    EdgeKeyRef* edgeKeyRef_{nullptr};
 };
 
 class DeleteVertices final : public SingleInputNode {
@@ -158,6 +158,26 @@ const char* PlanNode::toString(PlanNode::Kind kind) {
             return "SetConfig";
         case Kind::kGetConfig:
             return "GetConfig";
+        case Kind::kShowQueries:
+            return "ShowQueries";
+        case Kind::kKillQuery:
+            return "KillQuery";
+        case Kind::kShowQueryStats:
+            return "ShowQueryStats";
+        case Kind::kResetQueryStats:
+            return "ResetQueryStats";
+        case Kind::kPrepare:
+            return "Prepare";
+        case Kind::kDeallocate:
+            return "Deallocate";
+        case Kind::kBatch:
+            return "Batch";
+        case Kind::kDeclareCursor:
+            return "DeclareCursor";
+        case Kind::kFetchCursor:
+            return "FetchCursor";
+        case Kind::kCloseCursor:
+            return "CloseCursor";
             // no default so the compiler will warning when lack
     }
     LOG(FATAL) << "Impossible kind plan node " << static_cast<int>(kind);
@@ -93,6 +93,16 @@ public:
         kShowConfigs,
         kSetConfig,
         kGetConfig,
+        kShowQueries,
+        kKillQuery,
+        kShowQueryStats,
+        kResetQueryStats,
+        kPrepare,
+        kDeallocate,
+        kBatch,
+        kDeclareCursor,
+        kFetchCursor,
+        kCloseCursor,
     };
 
     PlanNode(int64_t id, Kind kind);
@@ -130,5 +130,25 @@ std::unique_ptr<cpp2::PlanNodeDescription> DataJoin::explain() const {
     return desc;
 }
 
+std::unique_ptr<cpp2::PlanNodeDescription> DeclareCursor::explain() const {
+    auto desc = SingleInputNode::explain();
+    addDescription("name", name_, desc.get());
+    addDescription("count", folly::to<std::string>(count_), desc.get());
+    return desc;
+}
+
+std::unique_ptr<cpp2::PlanNodeDescription> FetchCursor::explain() const {
+    auto desc = SingleInputNode::explain();
+    addDescription("name", name_, desc.get());
+    addDescription("count", folly::to<std::string>(count_), desc.get());
+    return desc;
+}
+
+std::unique_ptr<cpp2::PlanNodeDescription> CloseCursor::explain() const {
+    auto desc = SingleInputNode::explain();
+    addDescription("name", name_, desc.get());
+    return desc;
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -870,6 +870,94 @@ private:
     std::vector<Expression*>                probeKeys_;
 };
 
+/**
+ * Keep the result of the input in the session as a cursor, and return its first page.
+ */
+class DeclareCursor final : public SingleInputNode {
+public:
+    static DeclareCursor* make(QueryContext* qctx,
+                               PlanNode* input,
+                               std::string name,
+                               int64_t count) {
+        return qctx->objPool()->add(
+            new DeclareCursor(qctx->genId(), input, std::move(name), count));
+    }
+
+    const std::string& name() const {
+        return name_;
+    }
+
+    int64_t count() const {
+        return count_;
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
+private:
+    DeclareCursor(int64_t id, PlanNode* input, std::string name, int64_t count)
+        : SingleInputNode(id, Kind::kDeclareCursor, input), name_(std::move(name)) {
+        count_ = count;
+    }
+
+private:
+    std::string     name_;
+    int64_t         count_{-1};
+};
+
+/**
+ * Take the next rows of a cursor in the session.
+ */
+class FetchCursor final : public SingleInputNode {
+public:
+    static FetchCursor* make(QueryContext* qctx,
+                             PlanNode* input,
+                             std::string name,
+                             int64_t count) {
+        return qctx->objPool()->add(
+            new FetchCursor(qctx->genId(), input, std::move(name), count));
+    }
+
+    const std::string& name() const {
+        return name_;
+    }
+
+    int64_t count() const {
+        return count_;
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
+private:
+    FetchCursor(int64_t id, PlanNode* input, std::string name, int64_t count)
+        : SingleInputNode(id, Kind::kFetchCursor, input), name_(std::move(name)) {
+        count_ = count;
+    }
+
+private:
+    std::string     name_;
+    int64_t         count_{-1};
+};
+
+class CloseCursor final : public SingleInputNode {
+public:
+    static CloseCursor* make(QueryContext* qctx, PlanNode* input, std::string name) {
+        return qctx->objPool()->add(new CloseCursor(qctx->genId(), input, std::move(name)));
+    }
+
+    const std::string& name() const {
+        return name_;
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
+private:
+    CloseCursor(int64_t id, PlanNode* input, std::string name)
+        : SingleInputNode(id, Kind::kCloseCursor, input), name_(std::move(name)) {}
+
+private:
+    std::string     name_;
+};
+
 class ProduceSemiShortestPath : public PlanNode {
 public:
 };
@@ -0,0 +1,55 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "scheduler/QueryRunner.h"
+
+namespace nebula {
+namespace graph {
+
+void QueryRunner::add(folly::Func func) {
+    runner_->add([self = shared_from_this(), func = std::move(func)]() mutable {
+        Guard guard(std::move(self));
+        func();
+    });
+}
+
+void QueryRunner::whenIdle(folly::Func idle) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (running_ == 0) {
+        idle();
+        return;
+    }
+    idle_ = std::move(idle);
+}
+
+void QueryRunner::clearIdle() {
+    std::lock_guard<std::mutex> guard(lock_);
+    idle_ = nullptr;
+}
+
+size_t QueryRunner::running() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return running_;
+}
+
+void QueryRunner::enter() {
+    std::lock_guard<std::mutex> guard(lock_);
+    ++running_;
+}
+
+void QueryRunner::leave() {
+    std::lock_guard<std::mutex> guard(lock_);
+    DCHECK_GT(running_, 0);
+    if (--running_ == 0 && idle_) {
+        // Invoked with the lock held, so that no task starts before it returns
+        auto idle = std::move(idle_);
+        idle_ = nullptr;
+        idle();
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,74 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef SCHEDULER_QUERYRUNNER_H_
+#define SCHEDULER_QUERYRUNNER_H_
+
+#include <mutex>
+
+#include <folly/Executor.h>
+
+#include "common/base/Base.h"
+#include "common/cpp/helpers.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * QueryRunner runs the tasks of a query on the runner it wraps, and knows whether any of them
+ * is running, so that the states shared by the tasks could be dropped once none of them is,
+ * e.g. the intermediate results of a cancelled query still waiting for its storage requests.
+ *
+ * The queued tasks keep the runner alive, so it should be held by a shared pointer.
+ */
+class QueryRunner final : public folly::Executor,
+                          public std::enable_shared_from_this<QueryRunner>,
+                          private cpp::NonCopyable,
+                          private cpp::NonMovable {
+public:
+    explicit QueryRunner(folly::Executor *runner) : runner_(runner) {}
+
+    void add(folly::Func func) override;
+
+    // Marks the code of the query run out of the runner, e.g. by the thread receiving it
+    class Guard final : private cpp::NonCopyable, private cpp::NonMovable {
+    public:
+        explicit Guard(std::shared_ptr<QueryRunner> runner) : runner_(std::move(runner)) {
+            runner_->enter();
+        }
+
+        ~Guard() {
+            runner_->leave();
+        }
+
+    private:
+        std::shared_ptr<QueryRunner>    runner_;
+    };
+
+    // Invoke `idle' once none of the tasks is running, or at once if none is. The tasks
+    // starting meanwhile wait for it to return. Only the last one given is invoked.
+    void whenIdle(folly::Func idle);
+
+    // Never invoke the `idle' given, e.g. since the states it drops are gone
+    void clearIdle();
+
+    size_t running() const;
+
+private:
+    void enter();
+
+    void leave();
+
+    folly::Executor                    *runner_{nullptr};
+    mutable std::mutex                  lock_;
+    size_t                              running_{0};
+    folly::Func                         idle_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // SCHEDULER_QUERYRUNNER_H_
@@ -155,6 +155,8 @@ folly::Future<Status> Scheduler::iterate(LoopExecutor *loop) {
         }
         auto cond = val.moveBool();
         if (!cond) return folly::makeFuture(Status::OK());
+        auto cancelled = qctx_->checkCancelled();
+        if (!cancelled.ok()) return loop->error(std::move(cancelled));
         return doSchedule(loop->loopBody()).then(task(loop, [loop, this](Status s) {
             if (!s.ok()) return loop->error(std::move(s));
             return iterate(loop);
@@ -163,6 +165,15 @@ folly::Future<Status> Scheduler::iterate(LoopExecutor *loop) {
 }
 
 folly::Future<Status> Scheduler::execute(Executor *executor) {
+    // Stop scheduling the rest executors once the query is killed or timed out
+    auto cancelled = qctx_->checkCancelled();
+    if (!cancelled.ok()) {
+        return executor->error(std::move(cancelled));
+    }
+    auto *trace = qctx_->trace();
+    if (trace != nullptr) {
+        return traceExecute(executor, trace);
+    }
     auto status = executor->open();
     if (!status.ok()) {
         return executor->error(std::move(status));
@@ -173,5 +184,24 @@ folly::Future<Status> Scheduler::execute(Executor *executor) {
     });
 }
 
+folly::Future<Status> Scheduler::traceExecute(Executor *executor, QueryTrace *trace) {
+    auto lane = folly::stringPrintf("%s %ld", executor->name().c_str(), executor->id());
+    auto begin = trace->now();
+    auto status = executor->open();
+    trace->addSpanOn(lane, "open", "executor", begin, trace->now());
+    if (!status.ok()) {
+        return executor->error(std::move(status));
+    }
+    begin = trace->now();
+    return executor->execute().then([executor, trace, lane, begin](Status s) {
+        trace->addSpanOn(lane, "execute", "executor", begin, trace->now());
+        NG_RETURN_IF_ERROR(s);
+        auto closeBegin = trace->now();
+        auto closed = executor->close();
+        trace->addSpanOn(lane, "close", "executor", closeBegin, trace->now());
+        return closed;
+    });
+}
+
 }   // namespace graph
 }   // namespace nebula
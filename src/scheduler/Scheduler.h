@@ -25,6 +25,7 @@ namespace graph {
 class Executor;
 class QueryContext;
 class LoopExecutor;
+class QueryTrace;
 
 class Scheduler final : private cpp::NonCopyable, private cpp::NonMovable {
 public:
@@ -67,6 +68,8 @@ private:
     folly::Future<Status> doScheduleParallel(const std::set<Executor *> &dependents);
     folly::Future<Status> iterate(LoopExecutor *loop);
     folly::Future<Status> execute(Executor *executor);
+    // Execute and record the spans of each step on the lane of the executor
+    folly::Future<Status> traceExecute(Executor *executor, QueryTrace *trace);
 
     struct PassThroughData {
         folly::SpinLock lock;
@@ -0,0 +1,142 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "scheduler/WorkStealingExecutor.h"
+
+#include <folly/system/ThreadName.h>
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+// The pool and the index of the worker running on the current thread
+thread_local const WorkStealingExecutor *tlsPool = nullptr;
+thread_local size_t tlsIndex = 0;
+
+}   // namespace
+
+WorkStealingExecutor::WorkStealingExecutor(size_t numThreads, const std::string &name) {
+    DCHECK_GT(numThreads, 0);
+    workers_.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        auto worker = std::make_unique<Worker>();
+        worker->runner = std::make_unique<Runner>(this, i);
+        workers_.emplace_back(std::move(worker));
+    }
+    // Start the threads after all the workers are ready to be stolen from
+    for (size_t i = 0; i < numThreads; ++i) {
+        workers_[i]->thread = std::thread([this, i, name]() {
+            folly::setThreadName(folly::sformat("{}{}", name, i));
+            tlsPool = this;
+            tlsIndex = i;
+            loop(i);
+        });
+    }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+    stop();
+}
+
+void WorkStealingExecutor::stop() {
+    if (stopped_.exchange(true)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(sleepLock_);
+        wakeup_.notify_all();
+    }
+    for (auto &worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+void WorkStealingExecutor::add(folly::Func func) {
+    if (tlsPool == this) {
+        push(tlsIndex, std::move(func));
+    } else {
+        push(next_.fetch_add(1, std::memory_order_relaxed) % workers_.size(), std::move(func));
+    }
+}
+
+folly::Executor* WorkStealingExecutor::runner() {
+    auto index = next_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+    return workers_[index]->runner.get();
+}
+
+void WorkStealingExecutor::push(size_t index, folly::Func func) {
+    // Count the task before it could be popped
+    pending_.fetch_add(1);
+    auto &worker = *workers_[index];
+    {
+        std::lock_guard<std::mutex> guard(worker.lock);
+        worker.tasks.emplace_back(std::move(func));
+    }
+    // A worker going to sleep either sees the pending task, or is counted as a sleeper here
+    if (sleepers_.load() > 0) {
+        std::lock_guard<std::mutex> guard(sleepLock_);
+        wakeup_.notify_one();
+    }
+}
+
+bool WorkStealingExecutor::pop(size_t index, folly::Func *func) {
+    {
+        auto &worker = *workers_[index];
+        std::lock_guard<std::mutex> guard(worker.lock);
+        if (!worker.tasks.empty()) {
+            *func = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+            pending_.fetch_sub(1);
+            return true;
+        }
+    }
+    for (size_t i = 1; i < workers_.size(); ++i) {
+        auto &victim = *workers_[(index + i) % workers_.size()];
+        // Skip the busy victims rather than wait for them
+        std::unique_lock<std::mutex> guard(victim.lock, std::try_to_lock);
+        if (!guard.owns_lock() || victim.tasks.empty()) {
+            continue;
+        }
+        *func = std::move(victim.tasks.back());
+        victim.tasks.pop_back();
+        pending_.fetch_sub(1);
+        stolen_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingExecutor::loop(size_t index) {
+    while (true) {
+        folly::Func func;
+        if (pop(index, &func)) {
+            try {
+                func();
+            } catch (const std::exception &e) {
+                LOG(ERROR) << "Uncaught exception in the executor: " << e.what();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> guard(sleepLock_);
+        if (stopped_.load() && pending_.load() == 0) {
+            return;
+        }
+        sleepers_.fetch_add(1);
+        // Retry at once if any task is pending, it might be skipped by `pop' since the victim
+        // was locked at that moment.
+        wakeup_.wait(guard, [this]() {
+            return pending_.load() > 0 || stopped_.load();
+        });
+        sleepers_.fetch_sub(1);
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,101 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef SCHEDULER_WORKSTEALINGEXECUTOR_H_
+#define SCHEDULER_WORKSTEALINGEXECUTOR_H_
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <folly/Executor.h>
+
+#include "common/base/Base.h"
+#include "common/cpp/helpers.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * WorkStealingExecutor is a thread pool to run the tasks of queries, where each worker has
+ * its own task queue instead of sharing a single one.
+ *
+ * A query is bound to one worker by the runner returned from `runner()', so that all the
+ * continuations of the query are queued to the same worker and likely run on the same core.
+ * The idle workers steal the tasks from the busy ones, so that the load keeps balanced.
+ */
+class WorkStealingExecutor final : public folly::Executor,
+                                   private cpp::NonCopyable,
+                                   private cpp::NonMovable {
+public:
+    explicit WorkStealingExecutor(size_t numThreads, const std::string &name = "executor");
+
+    ~WorkStealingExecutor() override;
+
+    // Queue the task to the current worker if called from one, otherwise to the workers in turn
+    void add(folly::Func func) override;
+
+    // The runner to bind a query to one of the workers, the workers are assigned in turn.
+    // The runner lives as long as this executor.
+    folly::Executor* runner();
+
+    size_t numThreads() const {
+        return workers_.size();
+    }
+
+    // Number of the tasks run by a worker other than the one they were queued to
+    uint64_t stolen() const {
+        return stolen_.load(std::memory_order_relaxed);
+    }
+
+    void stop();
+
+private:
+    struct Worker;
+
+    // Runner of the tasks queued to a particular worker
+    class Runner final : public folly::Executor {
+    public:
+        Runner(WorkStealingExecutor *pool, size_t index) : pool_(pool), index_(index) {}
+
+        void add(folly::Func func) override {
+            pool_->push(index_, std::move(func));
+        }
+
+    private:
+        WorkStealingExecutor       *pool_;
+        size_t                      index_;
+    };
+
+    struct Worker {
+        std::mutex                  lock;
+        std::deque<folly::Func>     tasks;
+        std::unique_ptr<Runner>     runner;
+        std::thread                 thread;
+    };
+
+    void push(size_t index, folly::Func func);
+
+    // Take the oldest task of its own, or steal the newest one of the others
+    bool pop(size_t index, folly::Func *func);
+
+    void loop(size_t index);
+
+    std::vector<std::unique_ptr<Worker>>            workers_;
+    std::atomic<size_t>                             next_{0};
+    std::atomic<size_t>                             pending_{0};
+    std::atomic<size_t>                             sleepers_{0};
+    std::atomic<bool>                               stopped_{false};
+    std::atomic<uint64_t>                           stolen_{0};
+    std::mutex                                      sleepLock_;
+    std::condition_variable                         wakeup_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // SCHEDULER_WORKSTEALINGEXECUTOR_H_
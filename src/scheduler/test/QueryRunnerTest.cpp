@@ -0,0 +1,74 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include <folly/executors/InlineExecutor.h>
+#include <folly/executors/ManualExecutor.h>
+
+#include "common/base/Base.h"
+#include "scheduler/QueryRunner.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(QueryRunner, IdleAtOnce) {
+    auto runner = std::make_shared<QueryRunner>(&folly::InlineExecutor::instance());
+    bool idle = false;
+    runner->whenIdle([&idle]() { idle = true; });
+    ASSERT_TRUE(idle);
+}
+
+TEST(QueryRunner, IdleAfterTasks) {
+    folly::ManualExecutor pool;
+    auto runner = std::make_shared<QueryRunner>(&pool);
+    bool idle = false;
+    size_t running = 0;
+    runner->add([&]() {
+        // Given by a task, so invoked once it returns
+        runner->whenIdle([&idle]() { idle = true; });
+        running = runner->running();
+    });
+    {
+        QueryRunner::Guard guard(runner);
+        pool.drain();
+        ASSERT_EQ(2, running);
+        // Still running on the thread receiving the query
+        ASSERT_FALSE(idle);
+    }
+    ASSERT_TRUE(idle);
+    ASSERT_EQ(0, runner->running());
+}
+
+TEST(QueryRunner, ClearIdle) {
+    folly::ManualExecutor pool;
+    auto runner = std::make_shared<QueryRunner>(&pool);
+    bool idle = false;
+    runner->add([&]() {
+        runner->whenIdle([&idle]() { idle = true; });
+        runner->clearIdle();
+    });
+    pool.drain();
+    ASSERT_FALSE(idle);
+}
+
+TEST(QueryRunner, KeptByTasks) {
+    folly::ManualExecutor pool;
+    std::weak_ptr<QueryRunner> weak;
+    bool ran = false;
+    {
+        auto runner = std::make_shared<QueryRunner>(&pool);
+        weak = runner;
+        runner->add([&ran]() { ran = true; });
+    }
+    ASSERT_FALSE(weak.expired());
+    pool.drain();
+    ASSERT_TRUE(ran);
+    ASSERT_TRUE(weak.expired());
+}
+
+}   // namespace graph
+}   // namespace nebula
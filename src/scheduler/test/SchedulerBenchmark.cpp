@@ -0,0 +1,73 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+#include "common/base/Base.h"
+#include <folly/Benchmark.h>
+#include <folly/futures/Future.h>
+#include <thrift/lib/cpp/concurrency/PosixThreadFactory.h>
+#include <thrift/lib/cpp/concurrency/ThreadManager.h>
+#include "scheduler/WorkStealingExecutor.h"
+
+DEFINE_int32(bm_threads, 0, "Number of threads of the pools, 0 for number of CPU cores");
+DEFINE_int32(bm_queries, 256, "Number of concurrent queries");
+DEFINE_int32(bm_steps, 64, "Number of continuations of each query");
+
+using apache::thrift::concurrency::PosixThreadFactory;
+using apache::thrift::concurrency::ThreadManager;
+using nebula::graph::WorkStealingExecutor;
+
+static std::shared_ptr<ThreadManager> threadManager;
+static std::unique_ptr<WorkStealingExecutor> workStealing;
+
+// Each query is a chain of continuations, like the executors of a plan scheduled one by one
+size_t runQueries(size_t iters, std::function<folly::Executor*()> runnerOf) {
+    for (auto i = 0UL; i < iters; i++) {
+        std::vector<folly::Future<int64_t>> futures;
+        futures.reserve(FLAGS_bm_queries);
+        for (auto q = 0; q < FLAGS_bm_queries; q++) {
+            std::vector<int64_t> rows(256, q);
+            auto future = folly::makeFuture<int64_t>(0).via(runnerOf());
+            for (auto s = 0; s < FLAGS_bm_steps; s++) {
+                future = std::move(future).then([rows](int64_t sum) {
+                    for (auto row : rows) {
+                        sum += row;
+                    }
+                    return sum;
+                });
+            }
+            futures.emplace_back(std::move(future));
+        }
+        auto results = folly::collectAll(futures).get();
+        folly::doNotOptimizeAway(results);
+    }
+    return iters * FLAGS_bm_queries * FLAGS_bm_steps;
+}
+
+BENCHMARK_MULTI(ThreadManager, iters) {
+    return runQueries(iters, []() -> folly::Executor* { return threadManager.get(); });
+}
+
+BENCHMARK_RELATIVE_MULTI(WorkStealing, iters) {
+    return runQueries(iters, []() { return workStealing->runner(); });
+}
+
+int
+main(int argc, char **argv) {
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    if (FLAGS_bm_threads <= 0) {
+        FLAGS_bm_threads = std::thread::hardware_concurrency();
+    }
+
+    threadManager = ThreadManager::newSimpleThreadManager(FLAGS_bm_threads);
+    threadManager->threadFactory(std::make_shared<PosixThreadFactory>());
+    threadManager->start();
+    workStealing = std::make_unique<WorkStealingExecutor>(FLAGS_bm_threads);
+
+    folly::runBenchmarks();
+
+    workStealing->stop();
+    threadManager->join();
+    return 0;
+}
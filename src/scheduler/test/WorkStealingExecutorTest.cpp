@@ -0,0 +1,70 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include <folly/futures/Future.h>
+#include <folly/synchronization/Baton.h>
+
+#include "common/base/Base.h"
+#include "scheduler/WorkStealingExecutor.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(WorkStealingExecutor, RunAll) {
+    WorkStealingExecutor pool(4);
+    std::atomic<int32_t> count{0};
+    std::vector<folly::Future<folly::Unit>> futures;
+    for (auto i = 0; i < 1000; ++i) {
+        futures.emplace_back(folly::via(&pool, [&count]() { ++count; }));
+    }
+    folly::collectAll(futures).wait();
+    ASSERT_EQ(1000, count.load());
+}
+
+TEST(WorkStealingExecutor, Continuations) {
+    WorkStealingExecutor pool(4);
+    std::vector<folly::Future<int32_t>> futures;
+    for (auto q = 0; q < 16; ++q) {
+        auto future = folly::makeFuture<int32_t>(0).via(pool.runner());
+        for (auto s = 0; s < 100; ++s) {
+            future = std::move(future).then([](int32_t v) { return v + 1; });
+        }
+        futures.emplace_back(std::move(future));
+    }
+    for (auto &result : folly::collectAll(futures).get()) {
+        ASSERT_EQ(100, result.value());
+    }
+}
+
+TEST(WorkStealingExecutor, Steal) {
+    WorkStealingExecutor pool(2);
+    auto *runner = pool.runner();
+    folly::Baton<> blocked, done;
+    // Block the bound worker, the other one has to steal the next task
+    runner->add([&blocked]() { blocked.wait(); });
+    runner->add([&done]() { done.post(); });
+    done.wait();
+    blocked.post();
+    ASSERT_GE(pool.stolen(), 1);
+}
+
+TEST(WorkStealingExecutor, Stop) {
+    std::atomic<int32_t> count{0};
+    {
+        WorkStealingExecutor pool(2);
+        for (auto i = 0; i < 100; ++i) {
+            pool.add([&count]() { ++count; });
+        }
+        pool.stop();
+    }
+    // The queued tasks are drained before the workers exit
+    ASSERT_EQ(100, count.load());
+}
+
+}   // namespace graph
+}   // namespace nebula
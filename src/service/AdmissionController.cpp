@@ -0,0 +1,187 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "service/AdmissionController.h"
+
+#include <regex>
+
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+AdmissionController::AdmissionController(size_t maxRunning,
+                                         size_t maxQueued,
+                                         std::unordered_map<std::string, int32_t> userWeights)
+    : maxRunning_(maxRunning), maxQueued_(maxQueued), userWeights_(std::move(userWeights)) {
+    DCHECK_GT(maxRunning_, 0);
+}
+
+// static
+bool AdmissionController::enabled() {
+    return FLAGS_max_running_queries > 0;
+}
+
+// static
+std::unique_ptr<AdmissionController> AdmissionController::create() {
+    auto weights = parseWeights(FLAGS_admission_user_weights);
+    if (!weights.ok()) {
+        LOG(ERROR) << "Ignore the invalid user weights: " << weights.status();
+        weights = std::unordered_map<std::string, int32_t>();
+    }
+    return std::make_unique<AdmissionController>(FLAGS_max_running_queries,
+                                                 std::max(FLAGS_max_queued_queries, 0),
+                                                 std::move(weights).value());
+}
+
+// static
+AdmissionController::Priority AdmissionController::priorityOf(const std::string &query) {
+    // Skip the other hints before
+    static const std::regex kPriorityHint(
+        R"(^\s*(?:/\*\+[^*]*\*/\s*)*?/\*\+\s*PRIORITY\s*\(\s*(HIGH|NORMAL|LOW)\s*\)\s*\*/)",
+        std::regex::icase);
+    std::smatch match;
+    if (!std::regex_search(query, match, kPriorityHint)) {
+        return Priority::kNormal;
+    }
+    auto priority = match[1].str();
+    if (!strcasecmp(priority.c_str(), "HIGH")) {
+        return Priority::kHigh;
+    }
+    if (!strcasecmp(priority.c_str(), "LOW")) {
+        return Priority::kLow;
+    }
+    return Priority::kNormal;
+}
+
+// static
+StatusOr<std::unordered_map<std::string, int32_t>>
+AdmissionController::parseWeights(const std::string &str) {
+    std::unordered_map<std::string, int32_t> weights;
+    std::vector<folly::StringPiece> items;
+    folly::split(",", str, items, true);
+    for (auto &item : items) {
+        auto trimmed = folly::trimWhitespace(item);
+        if (trimmed.empty()) {
+            continue;
+        }
+        folly::StringPiece user, weight;
+        if (!folly::split(":", trimmed, user, weight)) {
+            return Status::Error("Bad user weight `%s'", trimmed.str().c_str());
+        }
+        auto value = folly::tryTo<int32_t>(folly::trimWhitespace(weight));
+        if (!value.hasValue() || value.value() <= 0) {
+            return Status::Error("Bad user weight `%s'", trimmed.str().c_str());
+        }
+        weights[folly::trimWhitespace(user).str()] = value.value();
+    }
+    return weights;
+}
+
+int32_t AdmissionController::weightOf(const std::string &user) const {
+    auto found = userWeights_.find(user);
+    return found == userWeights_.end() ? 1 : found->second;
+}
+
+Status AdmissionController::admit(int64_t sessionId,
+                                  const std::string &user,
+                                  Priority priority,
+                                  folly::Executor *runner,
+                                  Run run) {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (running_ < maxRunning_) {
+            ++running_;
+        } else if (queued_ >= maxQueued_) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return Status::Error("Too many queries, %lu running and %lu queued",
+                                 running_, queued_);
+        } else {
+            auto cls = static_cast<size_t>(priority);
+            auto iter = queues_[cls].find(sessionId);
+            if (iter == queues_[cls].end()) {
+                SessionQueue queue;
+                queue.pass = vtime_[cls];
+                queue.stride = kStride / weightOf(user);
+                iter = queues_[cls].emplace(sessionId, std::move(queue)).first;
+            }
+            Waiter waiter;
+            waiter.runner = runner;
+            waiter.run = std::move(run);
+            iter->second.waiters.emplace_back(std::move(waiter));
+            ++queued_;
+            return Status::OK();
+        }
+    }
+    run(0);
+    return Status::OK();
+}
+
+void AdmissionController::release() {
+    Waiter waiter;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (!dequeue(&waiter)) {
+            DCHECK_GT(running_, 0);
+            --running_;
+            return;
+        }
+        // The slot is handed over to the waiter, so `running_' stays the same
+    }
+    dispatch(std::move(waiter));
+}
+
+bool AdmissionController::dequeue(Waiter *waiter) {
+    for (size_t cls = 0; cls < kNumPriorities; ++cls) {
+        auto &queues = queues_[cls];
+        if (queues.empty()) {
+            continue;
+        }
+        auto next = queues.begin();
+        for (auto iter = queues.begin(); iter != queues.end(); ++iter) {
+            if (iter->second.pass < next->second.pass) {
+                next = iter;
+            }
+        }
+        auto &queue = next->second;
+        *waiter = std::move(queue.waiters.front());
+        queue.waiters.pop_front();
+        vtime_[cls] = queue.pass;
+        queue.pass += queue.stride;
+        if (queue.waiters.empty()) {
+            queues.erase(next);
+        }
+        --queued_;
+        return true;
+    }
+    return false;
+}
+
+void AdmissionController::dispatch(Waiter waiter) {
+    auto waited = static_cast<int64_t>(waiter.duration.elapsedInUSec());
+    queueTimeUs_.fetch_add(waited, std::memory_order_relaxed);
+    VLOG(1) << "Query admitted after waiting " << waited << "us";
+    auto *runner = waiter.runner;
+    auto task = [run = std::move(waiter.run), waited]() mutable { run(waited); };
+    if (runner != nullptr) {
+        runner->add(std::move(task));
+    } else {
+        task();
+    }
+}
+
+size_t AdmissionController::running() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return running_;
+}
+
+size_t AdmissionController::queued() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return queued_;
+}
+
+}   // namespace graph
+}   // namespace nebula
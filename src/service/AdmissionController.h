@@ -0,0 +1,123 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef SERVICE_ADMISSIONCONTROLLER_H_
+#define SERVICE_ADMISSIONCONTROLLER_H_
+
+#include <folly/Executor.h>
+#include <folly/Function.h>
+
+#include "common/base/Base.h"
+#include "common/base/StatusOr.h"
+#include "common/cpp/helpers.h"
+#include "common/time/Duration.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * AdmissionController bounds the number of queries executed concurrently.
+ *
+ * The queries beyond the bound wait in the queue and are rejected at once if the queue is full.
+ * The waiting queries are admitted by their priority class first, i.e. all the queries of high
+ * priority go before the normal ones. Within a class, the sessions share the executing slots in
+ * proportion to the weights of their users by stride scheduling, so that a session submitting
+ * bursts of heavy queries could not starve the others.
+ */
+class AdmissionController final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    enum class Priority : uint8_t {
+        kHigh = 0,
+        kNormal,
+        kLow,
+    };
+
+    // Invoked with the microseconds waited in the queue once the query is admitted
+    using Run = folly::Function<void(int64_t)>;
+
+    AdmissionController(size_t maxRunning,
+                        size_t maxQueued,
+                        std::unordered_map<std::string, int32_t> userWeights);
+
+    static bool enabled();
+
+    static std::unique_ptr<AdmissionController> create();
+
+    // The priority given by the hint /*+ PRIORITY(HIGH|NORMAL|LOW) */ at the beginning
+    // of the query, kNormal if there is no such hint.
+    static Priority priorityOf(const std::string &query);
+
+    // Parse the weights in format of "user1:weight1, user2:weight2"
+    static StatusOr<std::unordered_map<std::string, int32_t>> parseWeights(const std::string &str);
+
+    // Run the query at once if there is a free slot, or queue it to be run on `runner' later.
+    // An error is returned at once when the queue is full, and `run' is never invoked then.
+    Status admit(int64_t sessionId,
+                 const std::string &user,
+                 Priority priority,
+                 folly::Executor *runner,
+                 Run run);
+
+    // Called when an admitted query is done, to free its slot to the next waiting one
+    void release();
+
+    size_t running() const;
+
+    size_t queued() const;
+
+    uint64_t rejected() const {
+        return rejected_.load(std::memory_order_relaxed);
+    }
+
+    // Total microseconds the admitted queries have waited in the queue
+    uint64_t queueTimeUs() const {
+        return queueTimeUs_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t kNumPriorities = 3;
+    static constexpr uint64_t kStride = 1UL << 20;
+
+    struct Waiter {
+        folly::Executor            *runner{nullptr};
+        Run                         run;
+        time::Duration              duration;
+    };
+
+    struct SessionQueue {
+        std::deque<Waiter>          waiters;
+        // The virtual time of the session, the session with the least pass goes first
+        uint64_t                    pass{0};
+        uint64_t                    stride{kStride};
+    };
+
+    int32_t weightOf(const std::string &user) const;
+
+    // Pick the next waiter to run, return false if none is waiting
+    bool dequeue(Waiter *waiter);
+
+    void dispatch(Waiter waiter);
+
+    const size_t                                            maxRunning_;
+    const size_t                                            maxQueued_;
+    const std::unordered_map<std::string, int32_t>          userWeights_;
+
+    mutable std::mutex                                      lock_;
+    size_t                                                  running_{0};
+    size_t                                                  queued_{0};
+    std::array<std::unordered_map<int64_t, SessionQueue>, kNumPriorities> queues_;
+    // The pass of the last admitted session of each class, the sessions that start to wait
+    // begin with this pass to neither jump ahead of nor fall behind the waiting ones.
+    std::array<uint64_t, kNumPriorities>                    vtime_{};
+
+    std::atomic<uint64_t>                                   rejected_{0};
+    std::atomic<uint64_t>                                   queueTimeUs_{0};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // SERVICE_ADMISSIONCONTROLLER_H_
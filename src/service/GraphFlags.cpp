@@ -20,6 +20,10 @@ DEFINE_int32(num_netio_threads,
              "Number of networking threads, 0 for number of physical CPU cores");
 DEFINE_int32(num_accept_threads, 1, "Number of threads to accept incoming connections");
 DEFINE_int32(num_worker_threads, 0, "Number of threads to execute user queries");
+DEFINE_int32(num_executor_threads,
+             0,
+             "Number of threads of the work-stealing pool to execute the plans of queries, "
+             "0 to execute them on the worker threads");
 DEFINE_bool(reuse_port, true, "Whether to turn on the SO_REUSEPORT option");
 DEFINE_int32(listen_backlog, 1024, "Backlog of the listen socket");
 DEFINE_string(listen_netdev, "any", "The network device to listen on");
@@ -46,3 +50,114 @@ DEFINE_string(auth_type, "password", "User login authentication type,"
 
 DEFINE_string(cloud_http_url, "", "cloud http url including ip, port, url path");
 DEFINE_uint32(max_allowed_statements, 512, "Max allowed sequential statements");
+
+DEFINE_int32(storage_coalescing_window_us,
+             0,
+             "Time window in microseconds to merge the explore requests of concurrent queries "
+             "into one storage request, 0 to disable the coalescing");
+DEFINE_int32(storage_coalescing_max_vids,
+             4096,
+             "Max number of vertices merged into one coalesced storage request");
+
+DEFINE_int64(vertex_cache_capacity,
+             0,
+             "Max number of vertices whose props are cached in graphd, 0 to disable the cache");
+DEFINE_int32(vertex_cache_ttl_secs,
+             60,
+             "Seconds before the cached vertex props expire, 0 to never expire");
+
+DEFINE_int64(adjacency_cache_capacity,
+             0,
+             "Max number of supernodes whose neighbors are cached in graphd, "
+             "0 to disable the cache");
+DEFINE_int32(adjacency_cache_ttl_secs,
+             60,
+             "Seconds before the cached neighbors expire, 0 to never expire");
+DEFINE_int64(adjacency_cache_min_degree,
+             10000,
+             "Min number of edges of a vertex to have its neighbors cached");
+
+DEFINE_int32(storage_response_slices,
+             0,
+             "Split the explore requests into at most this number of slices by partition, "
+             "the response of each slice is processed as soon as it arrives, 0 to disable");
+
+DEFINE_int64(query_timeout_ms,
+             0,
+             "Default timeout of queries in milliseconds, "
+             "overridden by the hint /*+ TIMEOUT(ms) */ of a query, 0 for no timeout");
+
+DEFINE_int32(max_running_queries,
+             0,
+             "Max number of queries executed concurrently, the others wait in the queue, "
+             "0 for no limit");
+DEFINE_int32(max_queued_queries,
+             1024,
+             "Max number of queries waiting to be executed, the others are rejected at once");
+DEFINE_string(admission_user_weights,
+              "",
+              "Weights of users sharing the executing slots, the format looks like "
+              "user1:weight1, user2:weight2, the weight of users not listed is 1");
+
+DEFINE_int64(slow_query_threshold_us,
+             0,
+             "Queries taking at least this number of microseconds are written to "
+             "the slow query log, 0 to disable the log");
+DEFINE_double(slow_query_sample_ratio,
+              0.1,
+              "Ratio of the queries whose plan and profile are captured, to be written to "
+              "the slow query log if they turn out to be slow");
+DEFINE_string(slow_query_log_file, "logs/slow_query.log", "Path of the slow query log");
+DEFINE_int64(slow_query_log_max_bytes,
+             64 * 1024 * 1024,
+             "Size in bytes of the slow query log to be rotated");
+DEFINE_int32(slow_query_log_max_files,
+             5,
+             "Max number of the rotated slow query log files kept besides the current one");
+
+DEFINE_int32(query_stats_capacity,
+             1000,
+             "Max number of the query fingerprints whose statistics are kept for "
+             "SHOW QUERY STATS, 0 to disable the statistics");
+
+DEFINE_string(query_trace_dir,
+              "",
+              "Directory to write the Chrome traces of the queries with the hint "
+              "/*+ TRACE */ at the beginning, empty to disable the tracing");
+
+DEFINE_int32(max_prepared_statements_per_session,
+             64,
+             "Max number of the statements prepared in one session, 0 to disable PREPARE");
+
+DEFINE_int32(max_cursors_per_session,
+             16,
+             "Max number of the cursors declared in one session, 0 to disable the cursors");
+DEFINE_int64(cursor_fetch_size,
+             1000,
+             "Number of the rows returned by DECLARE CURSOR or FETCH NEXT without a count");
+DEFINE_int64(max_cursor_bytes_per_session,
+             256L * 1024 * 1024,
+             "Max estimated bytes of the rows kept by the cursors of one session, 0 for no limit");
+DEFINE_int32(cursor_idle_timeout_secs,
+             600,
+             "Seconds before a cursor not fetched is closed, 0 to keep it until CLOSE");
+
+DEFINE_int32(max_batch_queries, 1024, "Max number of the queries in one BATCH");
+DEFINE_int32(batch_execute_parallelism,
+             16,
+             "Max number of the queries of one BATCH executed at the same time");
+
+DEFINE_int32(write_chunk_size,
+             0,
+             "Split the rows inserted or deleted into chunks of at most this number of rows of one "
+             "partition, each written by a request of its own, 0 to disable");
+DEFINE_int32(write_chunk_concurrency,
+             8,
+             "Max number of the chunks of one statement being written at the same time");
+DEFINE_int32(write_chunk_retries,
+             2,
+             "Times to retry writing a chunk rejected for the leader changed");
+DEFINE_int32(update_concurrency,
+             16,
+             "Max number of the vertices or edges of one piped UPDATE or UPSERT being updated at "
+             "the same time");
@@ -16,6 +16,7 @@ DECLARE_int32(session_reclaim_interval_secs);
 DECLARE_int32(num_netio_threads);
 DECLARE_int32(num_accept_threads);
 DECLARE_int32(num_worker_threads);
+DECLARE_int32(num_executor_threads);
 DECLARE_bool(reuse_port);
 DECLARE_int32(listen_backlog);
 DECLARE_string(listen_netdev);
@@ -35,4 +36,47 @@ DECLARE_string(auth_type);
 DECLARE_string(cloud_http_url);
 DECLARE_uint32(max_allowed_statements);
 
+DECLARE_int32(storage_coalescing_window_us);
+DECLARE_int32(storage_coalescing_max_vids);
+
+DECLARE_int64(vertex_cache_capacity);
+DECLARE_int32(vertex_cache_ttl_secs);
+
+DECLARE_int64(adjacency_cache_capacity);
+DECLARE_int32(adjacency_cache_ttl_secs);
+DECLARE_int64(adjacency_cache_min_degree);
+
+DECLARE_int32(storage_response_slices);
+
+DECLARE_int64(query_timeout_ms);
+
+DECLARE_int32(max_running_queries);
+DECLARE_int32(max_queued_queries);
+DECLARE_string(admission_user_weights);
+
+DECLARE_int64(slow_query_threshold_us);
+DECLARE_double(slow_query_sample_ratio);
+DECLARE_string(slow_query_log_file);
+DECLARE_int64(slow_query_log_max_bytes);
+DECLARE_int32(slow_query_log_max_files);
+
+DECLARE_int32(query_stats_capacity);
+
+DECLARE_string(query_trace_dir);
+
+DECLARE_int32(max_prepared_statements_per_session);
+
+DECLARE_int32(max_cursors_per_session);
+DECLARE_int64(cursor_fetch_size);
+DECLARE_int64(max_cursor_bytes_per_session);
+DECLARE_int32(cursor_idle_timeout_secs);
+
+DECLARE_int32(max_batch_queries);
+DECLARE_int32(batch_execute_parallelism);
+
+DECLARE_int32(write_chunk_size);
+DECLARE_int32(write_chunk_concurrency);
+DECLARE_int32(write_chunk_retries);
+DECLARE_int32(update_concurrency);
+
 #endif   // GRAPH_GRAPHFLAGS_H_
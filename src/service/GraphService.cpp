@@ -14,13 +14,27 @@
 #include "service/GraphFlags.h"
 #include "service/PasswordAuthenticator.h"
 #include "service/CloudAuthenticator.h"
+#include "util/GraphMetrics.h"
 
 namespace nebula {
 namespace graph {
 
+GraphService::~GraphService() {
+    MetricsRegistry::instance().removeCallback("nebula_graph_sessions");
+}
+
+
 Status GraphService::init(std::shared_ptr<folly::IOThreadPoolExecutor> ioExecutor) {
     sessionManager_ = std::make_unique<SessionManager>();
+    if (FLAGS_num_executor_threads > 0) {
+        executor_ = std::make_unique<WorkStealingExecutor>(FLAGS_num_executor_threads);
+    }
     queryEngine_ = std::make_unique<QueryEngine>();
+    auto *sessionManager = sessionManager_.get();
+    MetricsRegistry::instance().addCallback(
+        "nebula_graph_sessions", "Active sessions", "gauge", [sessionManager]() {
+            return sessionManager->numSessions();
+        });
 
     return queryEngine_->init(std::move(ioExecutor));
 }
@@ -62,27 +76,41 @@ void GraphService::signout(int64_t sessionId) {
 
 folly::Future<cpp2::ExecutionResponse>
 GraphService::future_execute(int64_t sessionId, const std::string& query) {
+    auto result = sessionManager_->findSession(sessionId);
+    if (!result.ok()) {
+        FLOG_ERROR("Session not found, id[%ld]", sessionId);
+        return errorResponse(cpp2::ErrorCode::E_SESSION_INVALID);
+    }
+    return execute(std::move(result).value(), query);
+}
+
+
+folly::Future<cpp2::ExecutionResponse> GraphService::execute(std::shared_ptr<Session> session,
+                                                             const std::string& query) {
     auto ctx = std::make_unique<RequestContext<cpp2::ExecutionResponse>>();
     ctx->setQuery(query);
-    ctx->setRunner(getThreadManager());
+    // Bind the query to one worker of the pool to keep its continuations on the same core
+    ctx->setRunner(executor_ != nullptr ? executor_->runner() : getThreadManager());
     auto future = ctx->future();
-    {
-        auto result = sessionManager_->findSession(sessionId);
-        if (!result.ok()) {
-            FLOG_ERROR("Session not found, id[%ld]", sessionId);
-            ctx->resp().set_error_code(cpp2::ErrorCode::E_SESSION_INVALID);
-            // ctx->resp().set_error_msg(result.status().toString());
-            ctx->finish();
-            return future;
-        }
-        ctx->setSession(std::move(result).value());
-    }
+    ctx->setSession(std::move(session));
     queryEngine_->execute(std::move(ctx));
 
     return future;
 }
 
 
+// static
+cpp2::ExecutionResponse GraphService::errorResponse(cpp2::ErrorCode code, std::string msg) {
+    cpp2::ExecutionResponse resp;
+    resp.set_error_code(code);
+    if (!msg.empty()) {
+        resp.set_error_msg(std::move(msg));
+    }
+    GraphMetrics::errors()->get(cpp2::_ErrorCode_VALUES_TO_NAMES.at(code))->add();
+    return resp;
+}
+
+
 const char* GraphService::getErrorStr(cpp2::ErrorCode result) {
     switch (result) {
     case cpp2::ErrorCode::SUCCEEDED:
@@ -10,6 +10,7 @@
 #include "common/base/Base.h"
 #include "common/interface/gen-cpp2/GraphService.h"
 #include "service/Authenticator.h"
+#include "scheduler/WorkStealingExecutor.h"
 #include "service/QueryEngine.h"
 #include "service/SessionManager.h"
 
@@ -23,7 +24,7 @@ namespace graph {
 class GraphService final : public cpp2::GraphServiceSvIf {
 public:
     GraphService() = default;
-    ~GraphService() = default;
+    ~GraphService();
 
     Status MUST_USE_RESULT init(std::shared_ptr<folly::IOThreadPoolExecutor> ioExecutor);
 
@@ -38,11 +39,23 @@ public:
 
     const char* getErrorStr(cpp2::ErrorCode result);
 
+    // Null if the query statistics is disabled
+    QueryStats* queryStats() const {
+        return queryEngine_->queryStats();
+    }
+
 private:
     void onHandle(RequestContext<cpp2::AuthResponse>& ctx, cpp2::ErrorCode code);
 
     bool auth(const std::string& username, const std::string& password);
 
+    folly::Future<cpp2::ExecutionResponse> execute(std::shared_ptr<Session> session,
+                                                   const std::string& query);
+
+    static cpp2::ExecutionResponse errorResponse(cpp2::ErrorCode code, std::string msg = "");
+
+    // Null if the plans are executed on the worker threads of the thrift server
+    std::unique_ptr<WorkStealingExecutor>       executor_;
     std::unique_ptr<SessionManager>             sessionManager_;
     std::unique_ptr<QueryEngine>                queryEngine_;
 };
@@ -0,0 +1,57 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "service/MetricsHandler.h"
+
+#include <proxygen/httpserver/ResponseBuilder.h>
+#include <proxygen/lib/http/ProxygenErrorEnum.h>
+
+#include "util/Metrics.h"
+
+namespace nebula {
+namespace graph {
+
+using proxygen::HTTPMessage;
+using proxygen::HTTPMethod;
+using proxygen::ProxygenError;
+using proxygen::ResponseBuilder;
+using proxygen::UpgradeProtocol;
+
+void MetricsHandler::onRequest(std::unique_ptr<HTTPMessage> headers) noexcept {
+    badMethod_ = headers->getMethod().value_or(HTTPMethod::POST) != HTTPMethod::GET;
+}
+
+void MetricsHandler::onBody(std::unique_ptr<folly::IOBuf>) noexcept {
+    // Do nothing, we only support GET
+}
+
+void MetricsHandler::onEOM() noexcept {
+    if (badMethod_) {
+        ResponseBuilder(downstream_).status(405, "Method Not Allowed").sendWithEOM();
+        return;
+    }
+    ResponseBuilder(downstream_)
+        .status(200, "OK")
+        .header("Content-Type", "text/plain; version=0.0.4")
+        .body(MetricsRegistry::instance().toPrometheus())
+        .sendWithEOM();
+}
+
+void MetricsHandler::onUpgrade(UpgradeProtocol) noexcept {
+    // Do nothing
+}
+
+void MetricsHandler::requestComplete() noexcept {
+    delete this;
+}
+
+void MetricsHandler::onError(ProxygenError error) noexcept {
+    LOG(ERROR) << "Web service MetricsHandler got error: " << proxygen::getErrorString(error);
+    delete this;
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,43 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef SERVICE_METRICSHANDLER_H_
+#define SERVICE_METRICSHANDLER_H_
+
+#include <proxygen/httpserver/RequestHandler.h>
+
+#include "common/base/Base.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * MetricsHandler serves `GET /metrics' with all the metrics in the Prometheus text format.
+ */
+class MetricsHandler final : public proxygen::RequestHandler {
+public:
+    MetricsHandler() = default;
+
+    void onRequest(std::unique_ptr<proxygen::HTTPMessage> headers) noexcept override;
+
+    void onBody(std::unique_ptr<folly::IOBuf> body) noexcept override;
+
+    void onEOM() noexcept override;
+
+    void onUpgrade(proxygen::UpgradeProtocol protocol) noexcept override;
+
+    void requestComplete() noexcept override;
+
+    void onError(proxygen::ProxygenError error) noexcept override;
+
+private:
+    bool badMethod_{false};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // SERVICE_METRICSHANDLER_H_
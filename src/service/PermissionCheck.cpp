@@ -23,7 +23,7 @@ namespace graph {
  * Write role : kGrant, kRevoke,
  * Read data : kGo , kSet, kPipe, kMatch, kAssignment, kLookup,
  *             kYield, kOrderBy, kFetchVertices, kFind
- *             kFetchEdges, kFindPath, kLimit, KGroupBy, kReturn
+ *             kFetchEdges, kFindPath, kLimit, KGroupBy, kReturn, kDeclareCursor
  * Write data: kBuildTagIndex, kBuildEdgeIndex,
  *             kInsertVertex, kUpdateVertex, kInsertEdge,
  *             kUpdateEdge, kDeleteVertex, kDeleteEdges
@@ -119,7 +119,8 @@ bool PermissionCheck::permissionCheck(Session *session,
         case Sentence::Kind::kGetSubgraph:
         case Sentence::Kind::kLimit :
         case Sentence::Kind::kGroupBy :
-        case Sentence::Kind::kReturn : {
+        case Sentence::Kind::kReturn :
+        case Sentence::Kind::kDeclareCursor : {
             return PermissionManager::canReadSchemaOrData(session);
         }
         case Sentence::Kind::kShowParts:
@@ -168,6 +169,43 @@ bool PermissionCheck::permissionCheck(Session *session,
         case Sentence::Kind::kChangePassword : {
             return true;
         }
+        case Sentence::Kind::kShowQueries:
+        case Sentence::Kind::kKillQuery: {
+            /**
+             * Only GOD role can see or kill the queries of other users,
+             * the checking is done in their executors.
+             */
+            return true;
+        }
+        case Sentence::Kind::kShowQueryStats:
+        case Sentence::Kind::kResetQueryStats: {
+            /**
+             * Only GOD role can see or reset the statistics of the queries of all users.
+             */
+            return session->isGod();
+        }
+        case Sentence::Kind::kFetchCursor:
+        case Sentence::Kind::kCloseCursor: {
+            /**
+             * The cursors are only visible to the session declared them.
+             */
+            return true;
+        }
+        case Sentence::Kind::kPrepare:
+        case Sentence::Kind::kExecute:
+        case Sentence::Kind::kDeallocate: {
+            /**
+             * The statements prepared are checked when validated in PREPARE,
+             * and only visible to the session.
+             */
+            return true;
+        }
+        case Sentence::Kind::kBatch: {
+            /**
+             * Each query of the batch is checked when it's run as a query of its own.
+             */
+            return true;
+        }
         case Sentence::Kind::kExplain:
         case Sentence::Kind::kSequential:
             LOG(FATAL) << "Impossible sequential sentences permission checking";
@@ -8,6 +8,8 @@
 #include "service/QueryEngine.h"
 #include "service/QueryInstance.h"
 #include "context/QueryContext.h"
+#include "service/GraphFlags.h"
+#include "util/Metrics.h"
 
 DECLARE_bool(local_config);
 DECLARE_string(meta_server_addrs);
@@ -20,6 +22,10 @@ QueryEngine::QueryEngine() {
 
 
 QueryEngine::~QueryEngine() {
+    auto &metrics = MetricsRegistry::instance();
+    for (auto &name : metrics_) {
+        metrics.removeCallback(name);
+    }
 }
 
 
@@ -49,18 +55,139 @@ Status QueryEngine::init(std::shared_ptr<folly::IOThreadPoolExecutor> ioExecutor
     storage_ = std::make_unique<storage::GraphStorageClient>(ioExecutor,
                                                              metaClient_.get());
     charsetInfo_ = CharsetInfo::instance();
+    if (StorageRequestCoalescer::enabled()) {
+        storageCoalescer_ = std::make_unique<StorageRequestCoalescer>(storage_.get());
+    }
+    if (VertexPropCache::enabled()) {
+        vertexCache_ = std::make_unique<VertexPropCache>(FLAGS_vertex_cache_capacity,
+                                                         FLAGS_vertex_cache_ttl_secs);
+    }
+    if (AdjacencyCache::enabled()) {
+        adjacencyCache_ = std::make_unique<AdjacencyCache>(FLAGS_adjacency_cache_capacity,
+                                                           FLAGS_adjacency_cache_ttl_secs,
+                                                           FLAGS_adjacency_cache_min_degree);
+    }
+    if (AdmissionController::enabled()) {
+        admission_ = AdmissionController::create();
+    }
+    if (QueryStats::enabled()) {
+        queryStats_ = QueryStats::create();
+    }
+    if (SlowQueryLog::enabled()) {
+        slowLog_ = SlowQueryLog::create();
+    }
+    addMetrics();
 
     return Status::OK();
 }
 
+void QueryEngine::addMetrics() {
+    auto &metrics = MetricsRegistry::instance();
+    auto add = [this, &metrics](std::string name,
+                                const std::string &help,
+                                const std::string &type,
+                                std::function<int64_t()> fn) {
+        metrics.addCallback(name, help, type, std::move(fn));
+        metrics_.emplace_back(std::move(name));
+    };
+    add("nebula_graph_active_queries", "Queries being executed", "gauge", [this]() {
+        return queryRegistry_.size();
+    });
+    if (admission_ != nullptr) {
+        auto *admission = admission_.get();
+        add("nebula_graph_queued_queries", "Queries waiting to be admitted", "gauge",
+            [admission]() { return admission->queued(); });
+        add("nebula_graph_rejected_queries_total", "Queries rejected for the full queue",
+            "counter", [admission]() { return admission->rejected(); });
+        add("nebula_graph_queue_time_us_total", "Time the admitted queries waited in queue",
+            "counter", [admission]() { return admission->queueTimeUs(); });
+    }
+    if (queryStats_ != nullptr) {
+        auto *stats = queryStats_.get();
+        add("nebula_graph_query_fingerprints", "Fingerprints of queries in the query stats",
+            "gauge", [stats]() { return stats->size(); });
+        add("nebula_graph_query_fingerprints_evicted_total",
+            "Fingerprints evicted from the full query stats",
+            "counter", [stats]() { return stats->evicted(); });
+    }
+    if (slowLog_ != nullptr) {
+        auto *slowLog = slowLog_.get();
+        add("nebula_graph_slow_queries_total", "Queries written to the slow query log",
+            "counter", [slowLog]() { return slowLog->written(); });
+        add("nebula_graph_slow_queries_dropped_total",
+            "Slow queries dropped since the slow query log falls behind",
+            "counter", [slowLog]() { return slowLog->dropped(); });
+    }
+    if (vertexCache_ != nullptr) {
+        auto *cache = vertexCache_.get();
+        add("nebula_graph_vertex_cache_hits_total", "Hits of the vertex props cache",
+            "counter", [cache]() { return cache->hits(); });
+        add("nebula_graph_vertex_cache_misses_total", "Misses of the vertex props cache",
+            "counter", [cache]() { return cache->misses(); });
+    }
+    if (adjacencyCache_ != nullptr) {
+        auto *cache = adjacencyCache_.get();
+        add("nebula_graph_adjacency_cache_hits_total", "Hits of the supernodes adjacency cache",
+            "counter", [cache]() { return cache->hits(); });
+        add("nebula_graph_adjacency_cache_misses_total",
+            "Misses of the supernodes adjacency cache",
+            "counter", [cache]() { return cache->misses(); });
+    }
+}
+
 void QueryEngine::execute(RequestContextPtr rctx) {
+    auto* runner = rctx->runner();
+    auto* session = rctx->session();
+    auto* instance = newInstance(std::move(rctx));
+    auto* qctx = instance->qctx();
+    qctx->setBatchRunner([this, runner, session](const std::string& query) {
+        auto ctx = std::make_unique<RequestContext<cpp2::ExecutionResponse>>();
+        ctx->setQuery(query);
+        ctx->setRunner(runner);
+        // Not owned, the batch keeps its session until all of its queries are done
+        ctx->setSession(std::shared_ptr<Session>(std::shared_ptr<Session>(), session));
+        auto future = ctx->future();
+        // Not admitted again, since it could wait for the slot held by the batch itself
+        newInstance(std::move(ctx))->execute();
+        return future;
+    });
+    if (admission_ == nullptr) {
+        instance->execute();
+        return;
+    }
+
+    auto* admission = admission_.get();
+    auto status = admission->admit(
+        session->id(),
+        session->user(),
+        AdmissionController::priorityOf(qctx->rctx()->query()),
+        qctx->rctx()->runner(),
+        [instance, admission](int64_t queueTimeUs) {
+            instance->qctx()->setQueueTime(queueTimeUs);
+            instance->setOnDone([admission]() { admission->release(); });
+            instance->execute();
+        });
+    if (!status.ok()) {
+        // Rejected at once since the queue is full
+        instance->onError(std::move(status));
+    }
+}
+
+QueryInstance* QueryEngine::newInstance(RequestContextPtr rctx) {
     auto ectx = std::make_unique<QueryContext>(std::move(rctx),
                                                schemaManager_.get(),
                                                storage_.get(),
                                                metaClient_.get(),
                                                charsetInfo_);
+    ectx->setStorageCoalescer(storageCoalescer_.get());
+    ectx->setVertexCache(vertexCache_.get());
+    ectx->setAdjacencyCache(adjacencyCache_.get());
+    ectx->setQueryRegistry(&queryRegistry_);
+    ectx->setQueryStats(queryStats_.get());
     auto* instance = new QueryInstance(std::move(ectx));
-    instance->execute();
+    instance->setSlowQueryLog(slowLog_.get());
+    instance->watch();
+    return instance;
 }
 
 }   // namespace graph
@@ -18,6 +18,13 @@
 #include "common/network/NetworkUtils.h"
 #include "common/charset/Charset.h"
 #include <folly/executors/IOThreadPoolExecutor.h>
+#include "executor/StorageRequestCoalescer.h"
+#include "executor/cache/AdjacencyCache.h"
+#include "executor/cache/VertexPropCache.h"
+#include "context/QueryRegistry.h"
+#include "context/QueryStats.h"
+#include "service/AdmissionController.h"
+#include "service/SlowQueryLog.h"
 
 /**
  * QueryEngine is responsible to create and manage ExecutionPlan.
@@ -28,6 +35,8 @@
 namespace nebula {
 namespace graph {
 
+class QueryInstance;
+
 class QueryEngine final : public cpp::NonCopyable, public cpp::NonMovable {
 public:
     QueryEngine();
@@ -42,12 +51,31 @@ public:
         return metaClient_.get();
     }
 
+    // Null if the query statistics is disabled
+    QueryStats* queryStats() const {
+        return queryStats_.get();
+    }
+
 private:
+    // Export the states of the engine in metrics
+    void addMetrics();
+
+    // The instance deletes itself once the query is done
+    QueryInstance* newInstance(RequestContextPtr rctx);
+
     std::unique_ptr<meta::SchemaManager>              schemaManager_;
     // std::unique_ptr<meta::ClientBasedGflagsManager>   gflagsManager_;
     std::unique_ptr<storage::GraphStorageClient>      storage_;
     std::unique_ptr<meta::MetaClient>                 metaClient_;
+    std::unique_ptr<StorageRequestCoalescer>          storageCoalescer_;
+    std::unique_ptr<VertexPropCache>                  vertexCache_;
+    std::unique_ptr<AdjacencyCache>                   adjacencyCache_;
+    QueryRegistry                                     queryRegistry_;
+    std::unique_ptr<QueryStats>                       queryStats_;
+    std::unique_ptr<AdmissionController>              admission_;
+    std::unique_ptr<SlowQueryLog>                     slowLog_;
     CharsetInfo*                                      charsetInfo_{nullptr};
+    std::vector<std::string>                          metrics_;
 };
 
 }   // namespace graph
@@ -6,19 +6,47 @@
 
 #include "service/QueryInstance.h"
 
+#include <folly/FileUtil.h>
+#include <regex>
+
 #include "common/base/Base.h"
+#include "common/fs/FileUtils.h"
+#include "common/time/WallClock.h"
+#include "context/QueryExpressionContext.h"
+#include "context/QueryRegistry.h"
+#include "context/QueryStats.h"
 #include "executor/ExecutionError.h"
 #include "executor/Executor.h"
 #include "parser/ExplainSentence.h"
 #include "planner/ExecutionPlan.h"
 #include "planner/PlanNode.h"
 #include "scheduler/Scheduler.h"
+#include "service/GraphFlags.h"
+#include "service/PermissionCheck.h"
+#include "util/GraphMetrics.h"
+#include "util/ToJson.h"
+#include "validator/PrepareValidator.h"
 #include "validator/Validator.h"
+#include "visitor/EvaluableExprVisitor.h"
 
 namespace nebula {
 namespace graph {
 
 void QueryInstance::execute() {
+    // The intermediate results are not dropped while it's run out of the runner
+    std::unique_ptr<QueryRunner::Guard> guard;
+    if (runner_ != nullptr) {
+        guard = std::make_unique<QueryRunner::Guard>(runner_);
+    }
+    // Killed or timed out while waiting to be admitted
+    auto cancelled = qctx()->checkCancelled();
+    if (!cancelled.ok()) {
+        onError(std::move(cancelled));
+        return;
+    }
+    if (traced(qctx()->rctx()->query())) {
+        startTrace();
+    }
     Status status = validateAndOptimize();
     if (!status.ok()) {
         onError(std::move(status));
@@ -30,8 +58,16 @@ void QueryInstance::execute() {
         return;
     }
 
+    time::Duration executeDuration;
     scheduler_->schedule()
-        .then([this](Status s) {
+        .then([this, executeDuration](Status s) {
+            executeTime_ = executeDuration.elapsedInUSec();
+            GraphMetrics::phaseLatency()->get("execute")->add(executeTime_);
+            auto *trace = qctx()->trace();
+            if (trace != nullptr) {
+                auto end = trace->now();
+                trace->addSpanOn("query", "execute", "query", end - executeTime_, end);
+            }
             if (s.ok()) {
                 this->onFinish();
             } else {
@@ -42,22 +78,217 @@ void QueryInstance::execute() {
         .onError([this](const std::exception &e) { onError(Status::Error("%s", e.what())); });
 }
 
+// static
+int64_t QueryInstance::timeoutOf(const std::string &query) {
+    // Skip the other hints before
+    static const std::regex kTimeoutHint(
+        R"(^\s*(?:/\*\+[^*]*\*/\s*)*?/\*\+\s*TIMEOUT\s*\(\s*(\d+)\s*\)\s*\*/)",
+        std::regex::icase);
+    std::smatch match;
+    if (std::regex_search(query, match, kTimeoutHint)) {
+        return folly::to<int64_t>(match[1].str());
+    }
+    return FLAGS_query_timeout_ms;
+}
+
+// static
+bool QueryInstance::traced(const std::string &query) {
+    if (FLAGS_query_trace_dir.empty()) {
+        return false;
+    }
+    // Skip the other hints before
+    static const std::regex kTraceHint(R"(^\s*(?:/\*\+[^*]*\*/\s*)*?/\*\+\s*TRACE\s*\*/)",
+                                       std::regex::icase);
+    return std::regex_search(query, kTraceHint);
+}
+
+// static
+folly::Optional<ColumnarEncoder::Codec> QueryInstance::columnarOf(const std::string &query) {
+    // Skip the other hints before
+    static const std::regex kColumnarHint(
+        R"(^\s*(?:/\*\+[^*]*\*/\s*)*?/\*\+\s*COLUMNAR\s*(?:\(\s*(NONE|LZ4|ZSTD)\s*\))?\s*\*/)",
+        std::regex::icase);
+    std::smatch match;
+    if (!std::regex_search(query, match, kColumnarHint)) {
+        return folly::none;
+    }
+    if (!match[1].matched) {
+        return ColumnarEncoder::Codec::kLZ4;
+    }
+    return ColumnarEncoder::toCodec(match[1].str()).value();
+}
+
+void QueryInstance::startTrace() {
+    auto trace = std::make_shared<QueryTrace>();
+    auto *rctx = qctx()->rctx();
+    rctx->setRunner(trace->wrap(rctx->runner()));
+    qctx()->setTrace(std::move(trace));
+}
+
+void QueryInstance::writeTrace() const {
+    if (!fs::FileUtils::makeDir(FLAGS_query_trace_dir)) {
+        LOG(ERROR) << "Failed to create the directory of traces: " << FLAGS_query_trace_dir;
+        return;
+    }
+    auto path = folly::stringPrintf("%s/trace-%ld-%ld.json",
+                                    FLAGS_query_trace_dir.c_str(),
+                                    qctx()->rctx()->session()->id(),
+                                    time::WallClock::fastNowInMicroSec());
+    if (!folly::writeFile(folly::toJson(qctx()->trace()->toJson()), path.c_str())) {
+        LOG(ERROR) << "Failed to write the trace to " << path;
+        return;
+    }
+    LOG(INFO) << "The trace of the query `" << qctx()->rctx()->query() << "' is written to "
+              << path;
+}
+
+void QueryInstance::watch() {
+    auto *rctx = qctx()->rctx();
+    if (rctx->runner() != nullptr) {
+        runner_ = std::make_shared<QueryRunner>(rctx->runner());
+        rctx->setRunner(runner_.get());
+    }
+    auto &token = qctx()->cancellation();
+    auto *registry = qctx()->queryRegistry();
+    if (registry != nullptr) {
+        qctx()->setQueryId(registry->add(
+            rctx->session()->id(), rctx->session()->user(), rctx->query(), token));
+    }
+
+    auto timeout = timeoutOf(rctx->query());
+    if (timeout > 0) {
+        auto duration = std::chrono::milliseconds(timeout);
+        token->setDeadline(CancellationToken::Clock::now() + duration);
+        // Wake up to respond in time even if the query is blocked in a storage request,
+        // the token is only weakly referred since the query might have been done by then.
+        std::weak_ptr<CancellationToken> weak = token;
+        folly::futures::sleep(duration).then([weak]() {
+            auto cancellation = weak.lock();
+            if (cancellation != nullptr) {
+                cancellation->check();
+            }
+        });
+    }
+
+    // The in-flight storage requests and executors are abandoned once the query is cancelled,
+    // they stop at the next check of the token and release the resources by `onError'.
+    // The response is sent on the runner of the query rather than by the canceller, i.e. the
+    // timer or the query killing it, and this instance is kept until then. The intermediate
+    // results are dropped as soon as no executor is running rather than when the in-flight
+    // storage requests are all done, the executors find no input afterwards.
+    token->setCallback([this](const Status &reason) {
+        if (runner_ == nullptr) {
+            respondError(reason);
+            return;
+        }
+        refs_.fetch_add(1, std::memory_order_relaxed);
+        runner_->add([this, reason]() {
+            respondError(reason);
+            runner_->whenIdle([this]() { qctx()->ectx()->clear(); });
+            release();
+        });
+    });
+}
+
 Status QueryInstance::validateAndOptimize() {
     auto *rctx = qctx()->rctx();
     VLOG(1) << "Parsing query: " << rctx->query();
-    auto result = GQLParser().parse(rctx->query());
+    auto *trace = qctx()->trace();
+    auto begin = trace != nullptr ? trace->now() : 0;
+    time::Duration parseDuration;
+    auto result = GQLParser::threadLocal().parse(rctx->query());
+    parseTime_ = parseDuration.elapsedInUSec();
+    if (trace != nullptr) {
+        trace->addSpanOn("query", "parse", "query", begin, begin + parseTime_);
+    }
+    GraphMetrics::phaseLatency()->get("parse")->add(parseTime_);
     NG_RETURN_IF_ERROR(result);
     sentence_ = std::move(result).value();
+    parsed_ = true;
+    if (qctx()->queryStats() != nullptr) {
+        fingerprint_ = QueryStats::fingerprint(sentence_.get());
+    }
 
-    NG_RETURN_IF_ERROR(Validator::validate(sentence_.get(), qctx()));
+    // EXECUTE alone runs the plan prepared, the binding is counted as the validation
+    const ExecuteSentence *execute = nullptr;
+    if (sentence_->kind() == Sentence::Kind::kSequential) {
+        auto sentences = static_cast<const SequentialSentences *>(sentence_.get())->sentences();
+        if (sentences.size() == 1 && sentences.front()->kind() == Sentence::Kind::kExecute) {
+            execute = static_cast<const ExecuteSentence *>(sentences.front());
+        }
+    }
+
+    time::Duration validateDuration;
+    auto status = execute != nullptr ? bindPrepared(execute)
+                                     : Validator::validate(sentence_.get(), qctx());
+    validateTime_ = validateDuration.elapsedInUSec();
+    if (trace != nullptr) {
+        begin = trace->now() - validateTime_;
+        trace->addSpanOn("query", "validate", "query", begin, begin + validateTime_);
+    }
+    GraphMetrics::phaseLatency()->get("validate")->add(validateTime_);
+    NG_RETURN_IF_ERROR(status);
 
     // TODO: optional optimize for plan.
 
     return Status::OK();
 }
 
+Status QueryInstance::bindPrepared(const ExecuteSentence *execute) {
+    auto *session = qctx()->rctx()->session();
+    auto statement = session->findPreparedStatement(*execute->name());
+    if (statement == nullptr) {
+        return Status::SemanticError("Prepared statement `%s' not found",
+                                     execute->name()->c_str());
+    }
+    if (statement->space() != -1 && statement->space() != session->space()) {
+        return Status::SemanticError("Prepared statement `%s' should be executed in space `%s'",
+                                     execute->name()->c_str(),
+                                     statement->spaceName().c_str());
+    }
+    // The permissions might have been changed since prepared
+    if (FLAGS_enable_authorize) {
+        auto *sentences = static_cast<const SequentialSentences *>(statement->sentence());
+        for (auto *sentence : sentences->sentences()) {
+            if (!PermissionCheck::permissionCheck(session, sentence)) {
+                return Status::PermissionError("Permission denied");
+            }
+        }
+    }
+    auto acquired = PrepareValidator::acquire(*execute->name(), std::move(statement), qctx());
+    NG_RETURN_IF_ERROR(acquired);
+    statement = std::move(acquired).value();
+
+    std::unordered_map<std::string, Value> params;
+    if (execute->params() != nullptr) {
+        QueryExpressionContext ctx;
+        for (auto &param : execute->params()->params()) {
+            auto *expr = param.second.get();
+            EvaluableExprVisitor visitor;
+            expr->accept(&visitor);
+            if (!visitor.ok()) {
+                return Status::SemanticError("`%s' is not an evaluable expression.",
+                                             expr->toString().c_str());
+            }
+            if (!params.emplace(*param.first, expr->eval(ctx(nullptr))).second) {
+                return Status::SemanticError("Parameter `$%s' is given more than once.",
+                                             param.first->c_str());
+            }
+        }
+    }
+    NG_RETURN_IF_ERROR(statement->bind(params, qctx()));
+    if (!fingerprint_.empty()) {
+        fingerprint_ = statement->fingerprint();
+    }
+    prepared_ = std::move(statement);
+    return Status::OK();
+}
+
 bool QueryInstance::explainOrContinue() {
     if (sentence_->kind() != Sentence::Kind::kExplain) {
+        if (slowLog_ != nullptr && SlowQueryLog::sample()) {
+            capturePlan();
+        }
         return true;
     }
     qctx_->fillPlanDescription();
@@ -65,6 +296,11 @@ bool QueryInstance::explainOrContinue() {
 }
 
 void QueryInstance::onFinish() {
+    if (responded_.exchange(true)) {
+        cleanup();
+        release();
+        return;
+    }
     auto rctx = qctx()->rctx();
     VLOG(1) << "Finish query: " << rctx->query();
     auto ectx = qctx()->ectx();
@@ -77,30 +313,59 @@ void QueryInstance::onFinish() {
         auto &&value = ectx->moveValue(name);
         if (value.type() == Value::Type::DATASET) {
             auto result = value.moveDataSet();
-            if (!result.colNames.empty()) {
-                rctx->resp().set_data(std::move(result));
-            } else {
+            rows_ = result.rows.size();
+            GraphMetrics::rowsReturned()->add(rows_);
+            auto codec = columnarOf(rctx->query());
+            if (result.colNames.empty()) {
                 LOG(ERROR) << "Empty column name list";
                 rctx->resp().set_error_code(cpp2::ErrorCode::E_EXECUTION_ERROR);
                 rctx->resp().set_error_msg("Internal error: empty column name list");
+            } else if (codec.hasValue()) {
+                // Encoded here on the worker rather than by thrift on the IO thread
+                DataSet columnar({ColumnarEncoder::kColumnName});
+                columnar.emplace_back(Row({ColumnarEncoder::encode(result, *codec)}));
+                rctx->resp().set_data(std::move(columnar));
+            } else {
+                rctx->resp().set_data(std::move(result));
             }
         }
     }
 
-    if (qctx()->planDescription() != nullptr) {
+    // The plan captured for the slow query log is not asked by the client
+    if (qctx()->planDescription() != nullptr && !capturePlan_) {
         rctx->resp().set_plan_desc(std::move(*qctx()->planDescription()));
     }
 
+    latency_ = latency;
+    errorCode_ = rctx->resp().get_error_code();
     rctx->finish();
+    addLatency(latency);
+
+    cleanup();
 
     // The `QueryInstance' is the root node holding all resources during the execution.
     // When the whole query process is done, it's safe to release this object, as long as
     // no other contexts have chances to access these resources later on,
     // e.g. previously launched uncompleted async sub-tasks, EVEN on failures.
-    delete this;
+    release();
 }
 
 void QueryInstance::onError(Status status) {
+    respondError(std::move(status));
+    cleanup();
+    release();
+}
+
+void QueryInstance::release() {
+    if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete this;
+    }
+}
+
+void QueryInstance::respondError(Status status) {
+    if (responded_.exchange(true)) {
+        return;
+    }
     LOG(ERROR) << status;
     auto *rctx = qctx()->rctx();
     if (status.isSyntaxError()) {
@@ -117,8 +382,80 @@ void QueryInstance::onError(Status status) {
     rctx->resp().set_error_msg(status.toString());
     auto latency = rctx->duration().elapsedInUSec();
     rctx->resp().set_latency_in_us(latency);
+    auto code = rctx->resp().get_error_code();
+    latency_ = latency;
+    errorCode_ = code;
     rctx->finish();
-    delete this;
+    GraphMetrics::errors()->get(cpp2::_ErrorCode_VALUES_TO_NAMES.at(code))->add();
+    addLatency(latency);
+}
+
+void QueryInstance::addLatency(int64_t latency) const {
+    // The kind of the statements failed to be parsed is unknown
+    auto kind = parsed_.load() ? GraphMetrics::statementKind(qctx()->rctx()->query())
+                               : std::string("INVALID");
+    GraphMetrics::queryLatency()->get(kind)->add(latency);
+}
+
+void QueryInstance::capturePlan() {
+    auto planDesc = std::make_unique<cpp2::PlanDescription>();
+    planDesc->set_format("row");
+    qctx_->setPlanDescription(std::move(planDesc));
+    qctx_->fillPlanDescription();
+    capturePlan_ = true;
+}
+
+void QueryInstance::logSlowQuery() const {
+    if (!SlowQueryLog::isSlow(latency_)) {
+        return;
+    }
+    auto *rctx = qctx()->rctx();
+    auto *session = rctx->session();
+    folly::dynamic record = folly::dynamic::object();
+    record.insert("time", time::WallClock::fastNowInMicroSec());
+    record.insert("queryId", qctx()->queryId());
+    record.insert("sessionId", session->id());
+    record.insert("user", session->user());
+    record.insert("space", session->spaceName());
+    record.insert("query", rctx->query());
+    record.insert("errorCode", cpp2::_ErrorCode_VALUES_TO_NAMES.at(errorCode_));
+    record.insert("latencyInUs", latency_);
+    record.insert("queueTimeInUs", qctx()->queueTime());
+    record.insert("parseTimeInUs", parseTime_);
+    record.insert("validateTimeInUs", validateTime_);
+    record.insert("executeTimeInUs", executeTime_);
+    if (capturePlan_ && qctx()->planDescription() != nullptr) {
+        record.insert("plan", util::toJson(*qctx()->planDescription()));
+    }
+    slowLog_->add(folly::toJson(record));
+}
+
+void QueryInstance::addQueryStats() const {
+    qctx()->queryStats()->add(fingerprint_,
+                              latency_,
+                              rows_,
+                              qctx()->storageRpcs(),
+                              errorCode_ != cpp2::ErrorCode::SUCCEEDED);
+}
+
+void QueryInstance::cleanup() {
+    qctx()->cancellation()->clearCallback();
+    auto *registry = qctx()->queryRegistry();
+    if (registry != nullptr) {
+        registry->remove(qctx()->queryId());
+    }
+    if (onDone_) {
+        onDone_();
+    }
+    if (slowLog_ != nullptr) {
+        logSlowQuery();
+    }
+    if (!fingerprint_.empty()) {
+        addQueryStats();
+    }
+    if (qctx()->trace() != nullptr) {
+        writeTrace();
+    }
 }
 
 }   // namespace graph
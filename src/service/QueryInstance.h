@@ -10,9 +10,13 @@
 #include "common/base/Base.h"
 #include "common/base/Status.h"
 #include "common/cpp/helpers.h"
+#include "context/PreparedStatement.h"
 #include "context/QueryContext.h"
 #include "parser/GQLParser.h"
+#include "scheduler/QueryRunner.h"
 #include "scheduler/Scheduler.h"
+#include "service/SlowQueryLog.h"
+#include "util/ColumnarEncoder.h"
 
 /**
  * QueryInstance coordinates the execution process,
@@ -30,7 +34,15 @@ public:
         scheduler_ = std::make_unique<Scheduler>(qctx_.get());
     }
 
-    ~QueryInstance() = default;
+    ~QueryInstance() {
+        if (runner_ != nullptr) {
+            runner_->clearIdle();
+        }
+    }
+
+    // Register the query to be killed, and arm the deadline if any. It's called before the
+    // query waits to be admitted, so the waiting query could be killed or time out as well.
+    void watch();
 
     void execute();
 
@@ -51,14 +63,83 @@ public:
         return qctx_.get();
     }
 
+    // Invoked once the query is done, e.g. to free its slot of the admission control
+    void setOnDone(std::function<void()> onDone) {
+        onDone_ = std::move(onDone);
+    }
+
+    // The slow queries are written to `slowLog', with the plan and profile if sampled
+    void setSlowQueryLog(SlowQueryLog *slowLog) {
+        slowLog_ = slowLog;
+    }
+
+    // The timeout in milliseconds given by the hint /*+ TIMEOUT(ms) */ at the beginning of
+    // the query, or `--query_timeout_ms' if there is no such hint.
+    static int64_t timeoutOf(const std::string &query);
+
+    // Whether the query is to be traced by the hint /*+ TRACE */ at the beginning,
+    // and `--query_trace_dir' is given to write the trace
+    static bool traced(const std::string &query);
+
+    // The codec of the columnar encoding asked by the hint /*+ COLUMNAR[(NONE|LZ4|ZSTD)] */
+    // at the beginning, LZ4 if not given, or none if the result is to be sent in rows
+    static folly::Optional<ColumnarEncoder::Codec> columnarOf(const std::string &query);
+
 private:
     Status validateAndOptimize();
+
+    // Bind the parameters to the statement prepared in the session, instead of validating
+    Status bindPrepared(const ExecuteSentence *execute);
     // return true if continue to execute
     bool explainOrContinue();
 
+    // Respond to the client at most once, the query might be killed during the execution
+    void respondError(Status status);
+
+    void cleanup();
+
+    // Delete this instance once the query is done and the response of its cancellation,
+    // if any, has been sent
+    void release();
+
+    void addLatency(int64_t latency) const;
+
+    // Collect the profile of the executors, for the slow query log only
+    void capturePlan();
+
+    void logSlowQuery() const;
+
+    void addQueryStats() const;
+
+    // Record the timeline of the query, and run its tasks on the traced runner
+    void startTrace();
+
+    void writeTrace() const;
+
+    std::atomic<bool>                           responded_{false};
+    // One for the execution and one for each pending response of the cancellation
+    std::atomic<int32_t>                        refs_{1};
+    // The query might be responded by another thread when it's killed during parsing
+    std::atomic<bool>                           parsed_{false};
+    std::function<void()>                       onDone_;
+    SlowQueryLog                               *slowLog_{nullptr};
+    bool                                        capturePlan_{false};
+    // The latencies of the phases in microseconds, and of the whole query once responded
+    int64_t                                     parseTime_{0};
+    int64_t                                     validateTime_{0};
+    int64_t                                     executeTime_{0};
+    int64_t                                     latency_{0};
+    int64_t                                     rows_{0};
+    // Empty if the query statistics is disabled or the query failed to be parsed
+    std::string                                 fingerprint_;
+    cpp2::ErrorCode                             errorCode_{cpp2::ErrorCode::SUCCEEDED};
     std::unique_ptr<Sentence>                   sentence_;
+    // The prepared plan executed, which should outlive the executors in `qctx_'
+    std::shared_ptr<const PreparedStatement>    prepared_;
     std::unique_ptr<QueryContext>               qctx_;
     std::unique_ptr<Scheduler>                  scheduler_;
+    // Runs the tasks of the query, to drop the intermediate results once it's cancelled
+    std::shared_ptr<QueryRunner>                runner_;
 };
 
 }   // namespace graph
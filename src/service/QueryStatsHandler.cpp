@@ -0,0 +1,81 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "service/QueryStatsHandler.h"
+
+#include <proxygen/httpserver/ResponseBuilder.h>
+#include <proxygen/lib/http/ProxygenErrorEnum.h>
+
+namespace nebula {
+namespace graph {
+
+using proxygen::HTTPMessage;
+using proxygen::HTTPMethod;
+using proxygen::ProxygenError;
+using proxygen::ResponseBuilder;
+using proxygen::UpgradeProtocol;
+
+void QueryStatsHandler::onRequest(std::unique_ptr<HTTPMessage> headers) noexcept {
+    badMethod_ = headers->getMethod().value_or(HTTPMethod::POST) != HTTPMethod::GET;
+    reset_ = headers->getQueryParam("reset") == "true";
+}
+
+void QueryStatsHandler::onBody(std::unique_ptr<folly::IOBuf>) noexcept {
+    // Do nothing, we only support GET
+}
+
+void QueryStatsHandler::onEOM() noexcept {
+    if (badMethod_) {
+        ResponseBuilder(downstream_).status(405, "Method Not Allowed").sendWithEOM();
+        return;
+    }
+    if (stats_ == nullptr) {
+        ResponseBuilder(downstream_)
+            .status(404, "Not Found")
+            .body("Query stats is disabled")
+            .sendWithEOM();
+        return;
+    }
+
+    folly::dynamic entries = folly::dynamic::array();
+    for (auto &entry : stats_->list()) {
+        folly::dynamic obj = folly::dynamic::object();
+        obj.insert("fingerprint", entry.fingerprint);
+        obj.insert("calls", entry.calls);
+        obj.insert("errors", entry.errors);
+        obj.insert("totalLatencyInUs", entry.totalLatencyInUs);
+        obj.insert("minLatencyInUs", entry.minLatencyInUs);
+        obj.insert("maxLatencyInUs", entry.maxLatencyInUs);
+        obj.insert("p99LatencyInUs", entry.p99LatencyInUs);
+        obj.insert("rows", entry.rows);
+        obj.insert("storageRpcs", entry.storageRpcs);
+        entries.push_back(std::move(obj));
+    }
+    if (reset_) {
+        stats_->reset();
+    }
+    ResponseBuilder(downstream_)
+        .status(200, "OK")
+        .header("Content-Type", "application/json")
+        .body(folly::toJson(entries))
+        .sendWithEOM();
+}
+
+void QueryStatsHandler::onUpgrade(UpgradeProtocol) noexcept {
+    // Do nothing
+}
+
+void QueryStatsHandler::requestComplete() noexcept {
+    delete this;
+}
+
+void QueryStatsHandler::onError(ProxygenError error) noexcept {
+    LOG(ERROR) << "Web service QueryStatsHandler got error: " << proxygen::getErrorString(error);
+    delete this;
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,49 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef SERVICE_QUERYSTATSHANDLER_H_
+#define SERVICE_QUERYSTATSHANDLER_H_
+
+#include <proxygen/httpserver/RequestHandler.h>
+
+#include "common/base/Base.h"
+#include "context/QueryStats.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * QueryStatsHandler serves `GET /query_stats' with the statistics of the query fingerprints
+ * in JSON, the same as SHOW QUERY STATS. The statistics is reset after being returned
+ * if asked by `GET /query_stats?reset=true'.
+ */
+class QueryStatsHandler final : public proxygen::RequestHandler {
+public:
+    // `stats' is null if the query statistics is disabled
+    explicit QueryStatsHandler(QueryStats *stats) : stats_(stats) {}
+
+    void onRequest(std::unique_ptr<proxygen::HTTPMessage> headers) noexcept override;
+
+    void onBody(std::unique_ptr<folly::IOBuf> body) noexcept override;
+
+    void onEOM() noexcept override;
+
+    void onUpgrade(proxygen::UpgradeProtocol protocol) noexcept override;
+
+    void requestComplete() noexcept override;
+
+    void onError(proxygen::ProxygenError error) noexcept override;
+
+private:
+    QueryStats     *stats_{nullptr};
+    bool            badMethod_{false};
+    bool            reset_{false};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // SERVICE_QUERYSTATSHANDLER_H_
@@ -5,6 +5,7 @@
  */
 
 #include "service/Session.h"
+#include "service/GraphFlags.h"
 
 namespace nebula {
 namespace graph {
@@ -24,5 +25,132 @@ void Session::charge() {
 uint64_t Session::idleSeconds() const {
     return idleDuration_.elapsedInSec();
 }
+
+Status Session::addPreparedStatement(const std::string &name,
+                                     std::shared_ptr<const PreparedStatement> statement) {
+    std::lock_guard<std::mutex> guard(preparedLock_);
+    if (prepared_.find(name) != prepared_.end()) {
+        return Status::Error("Prepared statement `%s' already exists", name.c_str());
+    }
+    if (prepared_.size() >= static_cast<size_t>(FLAGS_max_prepared_statements_per_session)) {
+        return Status::Error("Too many prepared statements in the session, the max is %d",
+                             FLAGS_max_prepared_statements_per_session);
+    }
+    prepared_.emplace(name, std::move(statement));
+    return Status::OK();
+}
+
+std::shared_ptr<const PreparedStatement>
+Session::findPreparedStatement(const std::string &name) const {
+    std::lock_guard<std::mutex> guard(preparedLock_);
+    auto iter = prepared_.find(name);
+    if (iter == prepared_.end()) {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+Status Session::removePreparedStatement(const std::string &name) {
+    std::lock_guard<std::mutex> guard(preparedLock_);
+    if (prepared_.erase(name) == 0) {
+        return Status::Error("Prepared statement `%s' not found", name.c_str());
+    }
+    return Status::OK();
+}
+
+void Session::replacePreparedStatement(const std::string &name,
+                                       const std::shared_ptr<const PreparedStatement> &old,
+                                       std::shared_ptr<const PreparedStatement> statement) {
+    std::lock_guard<std::mutex> guard(preparedLock_);
+    auto iter = prepared_.find(name);
+    if (iter != prepared_.end() && iter->second == old) {
+        iter->second = std::move(statement);
+    }
+}
+
+Status Session::addCursor(const std::string &name, DataSet result, size_t bytes) {
+    std::lock_guard<std::mutex> guard(cursorLock_);
+    removeExpiredCursors();
+    if (cursors_.find(name) != cursors_.end()) {
+        return Status::Error("Cursor `%s' already exists", name.c_str());
+    }
+    if (cursors_.size() >= static_cast<size_t>(FLAGS_max_cursors_per_session)) {
+        return Status::Error("Too many cursors in the session, the max is %d",
+                             FLAGS_max_cursors_per_session);
+    }
+    auto maxBytes = static_cast<size_t>(std::max<int64_t>(FLAGS_max_cursor_bytes_per_session, 0));
+    if (maxBytes > 0 && cursorBytes_ + bytes > maxBytes) {
+        return Status::Error("The rows of cursor `%s' take about %lu bytes, over the %lu bytes "
+                             "left of the cursors in the session, fetch fewer rows or CLOSE "
+                             "the other cursors",
+                             name.c_str(), bytes, maxBytes - std::min(cursorBytes_, maxBytes));
+    }
+    Cursor cursor;
+    cursor.result = std::move(result);
+    cursor.bytes = bytes;
+    cursorBytes_ += bytes;
+    cursors_.emplace(name, std::move(cursor));
+    return Status::OK();
+}
+
+StatusOr<DataSet> Session::fetchCursor(const std::string &name, size_t count) {
+    std::lock_guard<std::mutex> guard(cursorLock_);
+    auto iter = cursors_.find(name);
+    if (iter == cursors_.end()) {
+        return Status::Error("Cursor `%s' not found", name.c_str());
+    }
+    if (expired(iter->second)) {
+        cursorBytes_ -= iter->second.bytes;
+        cursors_.erase(iter);
+        return Status::Error("Cursor `%s' was closed after not fetched for %d seconds",
+                             name.c_str(), FLAGS_cursor_idle_timeout_secs);
+    }
+    auto &cursor = iter->second;
+    cursor.idleDuration.reset();
+    auto &rows = cursor.result.rows;
+    auto end = std::min(rows.size(), cursor.offset + count);
+    DataSet page(cursor.result.colNames);
+    page.rows.reserve(end - cursor.offset);
+    // The rows fetched are moved out to release their memory as early as possible
+    std::move(rows.begin() + cursor.offset, rows.begin() + end, std::back_inserter(page.rows));
+    // So are their bytes given back to the session, in proportion to the rows left
+    auto left = rows.size() - end;
+    auto bytes = rows.size() - cursor.offset == 0
+                     ? 0
+                     : cursor.bytes * left / (rows.size() - cursor.offset);
+    cursorBytes_ -= cursor.bytes - bytes;
+    cursor.bytes = bytes;
+    cursor.offset = end;
+    return page;
+}
+
+Status Session::removeCursor(const std::string &name) {
+    std::lock_guard<std::mutex> guard(cursorLock_);
+    auto iter = cursors_.find(name);
+    if (iter == cursors_.end()) {
+        return Status::Error("Cursor `%s' not found", name.c_str());
+    }
+    cursorBytes_ -= iter->second.bytes;
+    cursors_.erase(iter);
+    return Status::OK();
+}
+
+// static
+bool Session::expired(const Cursor &cursor) {
+    return FLAGS_cursor_idle_timeout_secs > 0 &&
+           cursor.idleDuration.elapsedInSec() >=
+               static_cast<uint64_t>(FLAGS_cursor_idle_timeout_secs);
+}
+
+void Session::removeExpiredCursors() {
+    for (auto iter = cursors_.begin(); iter != cursors_.end();) {
+        if (expired(iter->second)) {
+            cursorBytes_ -= iter->second.bytes;
+            iter = cursors_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
 }  // namespace graph
 }  // namespace nebula
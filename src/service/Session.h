@@ -8,11 +8,14 @@
 
 #include "common/base/Base.h"
 #include "common/time/Duration.h"
+#include "common/datatypes/DataSet.h"
 #include "common/interface/gen-cpp2/meta_types.h"
 
 namespace nebula {
 namespace graph {
 
+class PreparedStatement;
+
 class Session final {
 public:
     static std::shared_ptr<Session> create(int64_t id);
@@ -73,7 +76,44 @@ public:
 
     void charge();
 
+    // The statements prepared in the session are released by DEALLOCATE or with the session
+    Status addPreparedStatement(const std::string &name,
+                                std::shared_ptr<const PreparedStatement> statement);
+
+    std::shared_ptr<const PreparedStatement> findPreparedStatement(const std::string &name) const;
+
+    Status removePreparedStatement(const std::string &name);
+
+    // Replace the statement prepared again, unless it has been deallocated or replaced
+    void replacePreparedStatement(const std::string &name,
+                                  const std::shared_ptr<const PreparedStatement> &old,
+                                  std::shared_ptr<const PreparedStatement> statement);
+
+    // The results kept to be fetched page by page, released by CLOSE, with the session, or
+    // once not fetched for `--cursor_idle_timeout_secs'. The `bytes' estimated of the result
+    // are bounded by `--max_cursor_bytes_per_session' for all the cursors of the session.
+    Status addCursor(const std::string &name, DataSet result, size_t bytes);
+
+    // Take the next at most `count' rows of the cursor, no rows once it's exhausted
+    StatusOr<DataSet> fetchCursor(const std::string &name, size_t count);
+
+    Status removeCursor(const std::string &name);
+
 private:
+    struct Cursor {
+        DataSet             result;
+        // The rows before are fetched
+        size_t              offset{0};
+        // Estimated bytes of the rows not fetched yet
+        size_t              bytes{0};
+        time::Duration      idleDuration;
+    };
+
+    static bool expired(const Cursor &cursor);
+
+    // Close the cursors not fetched for long, with the lock of the cursors held
+    void removeExpiredCursors();
+
     Session() = default;
     explicit Session(int64_t id);
 
@@ -90,6 +130,12 @@ private:
      * But a user has only one role in one space
      */
     std::unordered_map<GraphSpaceID, meta::cpp2::RoleType> roles_;
+    // The queries of one session might run concurrently
+    mutable std::mutex                                      preparedLock_;
+    std::unordered_map<std::string, std::shared_ptr<const PreparedStatement>> prepared_;
+    mutable std::mutex                                      cursorLock_;
+    std::unordered_map<std::string, Cursor>                 cursors_;
+    size_t                                                  cursorBytes_{0};
 };
 
 }  // namespace graph
@@ -11,12 +11,16 @@
 namespace nebula {
 namespace graph {
 
-SessionManager::SessionManager() {
+SessionManager::SessionManager(size_t numShards) : shards_(numShards) {
+    DCHECK_GT(numShards, 0UL);
     scavenger_ = std::make_unique<thread::GenericWorker>();
     auto ok = scavenger_->start("session-manager");
     DCHECK(ok);
+    // Each shard is still reclaimed once in an interval
+    auto interval = std::max<size_t>(FLAGS_session_reclaim_interval_secs * 1000UL / numShards,
+                                     1UL);
     auto bound = std::bind(&SessionManager::reclaimExpiredSessions, this);
-    scavenger_->addRepeatTask(FLAGS_session_reclaim_interval_secs * 1000, std::move(bound));
+    scavenger_->addRepeatTask(interval, std::move(bound));
 }
 
 
@@ -31,41 +35,50 @@ SessionManager::~SessionManager() {
 
 StatusOr<std::shared_ptr<Session>>
 SessionManager::findSession(int64_t id) {
-    folly::RWSpinLock::ReadHolder holder(rwlock_);
-    auto iter = activeSessions_.find(id);
-    if (iter == activeSessions_.end()) {
+    auto &shard = shardOf(id);
+    folly::SharedMutex::ReadHolder holder(shard.lock);
+    auto iter = shard.sessions.find(id);
+    if (iter == shard.sessions.end()) {
         return Status::Error("Session `%ld' has expired", id);
     }
     return iter->second;
 }
 
 
+size_t SessionManager::numSessions() {
+    return numSessions_.load(std::memory_order_relaxed);
+}
+
+
 std::shared_ptr<Session> SessionManager::createSession() {
-    folly::RWSpinLock::WriteHolder holder(rwlock_);
-    auto sid = newSessionId();
     while (true) {
-        if (activeSessions_.count(sid) == 0UL) {
-            break;
-        }
+        auto sid = newSessionId();
+        DCHECK_NE(sid, 0L);
+        auto &shard = shardOf(sid);
+        folly::SharedMutex::WriteHolder holder(shard.lock);
         // This ID is in use already, try another one
-        sid = newSessionId();
+        if (shard.sessions.count(sid) != 0UL) {
+            continue;
+        }
+        auto session = Session::create(sid);
+        shard.sessions.emplace(sid, session);
+        ++numSessions_;
+        session->charge();
+        return session;
     }
-    DCHECK_NE(sid, 0L);
-    auto session = Session::create(sid);
-    activeSessions_[sid] = session;
-    session->charge();
-    return session;
 }
 
 
 std::shared_ptr<Session> SessionManager::removeSession(int64_t id) {
-    folly::RWSpinLock::WriteHolder holder(rwlock_);
-    auto iter = activeSessions_.find(id);
-    if (iter == activeSessions_.end()) {
+    auto &shard = shardOf(id);
+    folly::SharedMutex::WriteHolder holder(shard.lock);
+    auto iter = shard.sessions.find(id);
+    if (iter == shard.sessions.end()) {
         return nullptr;
     }
     auto session = std::move(iter->second);
-    activeSessions_.erase(iter);
+    shard.sessions.erase(iter);
+    --numSessions_;
     return session;
 }
 
@@ -79,26 +92,31 @@ int64_t SessionManager::newSessionId() {
 }
 
 
-// TODO(dutor) Now we do a brute-force scanning, of course we could make it more efficient.
 void SessionManager::reclaimExpiredSessions() {
-    folly::RWSpinLock::WriteHolder holder(rwlock_);
-    if (activeSessions_.empty()) {
+    if (FLAGS_session_idle_timeout_secs <= 0) {
         return;
     }
-
-    FVLOG3("Try to reclaim expired sessions out of %lu ones", activeSessions_.size());
-    auto iter = activeSessions_.begin();
-    auto end = activeSessions_.end();
-    while (iter != end) {
-        auto *session = iter->second.get();
-        int32_t idleSecs = session->idleSeconds();
-        if (idleSecs < FLAGS_session_idle_timeout_secs) {
-            ++iter;
-            continue;
+    auto &shard = shards_[nextReclaim_];
+    nextReclaim_ = (nextReclaim_ + 1) % shards_.size();
+
+    // Released after the lock, since the sessions might hold the cursors of large results
+    std::vector<SessionPtr> expired;
+    {
+        folly::SharedMutex::WriteHolder holder(shard.lock);
+        auto iter = shard.sessions.begin();
+        while (iter != shard.sessions.end()) {
+            auto *session = iter->second.get();
+            int32_t idleSecs = session->idleSeconds();
+            if (idleSecs < FLAGS_session_idle_timeout_secs) {
+                ++iter;
+                continue;
+            }
+            FLOG_INFO("Session %ld has expired", session->id());
+            expired.emplace_back(std::move(iter->second));
+            iter = shard.sessions.erase(iter);
         }
-        FLOG_INFO("Session %ld has expired", session->id());
-        iter = activeSessions_.erase(iter);
     }
+    numSessions_ -= expired.size();
 }
 
 }   // namespace graph
@@ -7,6 +7,8 @@
 #ifndef SERVICE_SESSIONMANAGER_H_
 #define SERVICE_SESSIONMANAGER_H_
 
+#include <folly/SharedMutex.h>
+
 #include "common/base/Base.h"
 #include "common/base/StatusOr.h"
 #include "common/thread/GenericWorker.h"
@@ -14,6 +16,10 @@
 
 /**
  * SessionManager manages the client sessions, e.g. create new, find existing and drop expired.
+ *
+ * The sessions are split into shards by id, each guarded by its own lock, so finding
+ * a session on every request is not blocked by the creation and removal of the others.
+ * The expired sessions are reclaimed one shard at a time, spread over the reclaim interval.
  */
 
 namespace nebula {
@@ -21,7 +27,7 @@ namespace graph {
 
 class SessionManager final {
 public:
-    SessionManager();
+    explicit SessionManager(size_t numShards = 64);
     ~SessionManager();
 
     using SessionPtr = std::shared_ptr<Session>;
@@ -37,19 +43,37 @@ public:
      * Remove a session
      */
     SessionPtr removeSession(int64_t id);
+    /**
+     * Number of the active sessions
+     */
+    size_t numSessions();
 
 private:
+    struct Shard {
+        folly::SharedMutex                          lock;
+        std::unordered_map<int64_t, SessionPtr>     sessions;
+    };
+
+    Shard& shardOf(int64_t id) {
+        return shards_[static_cast<uint64_t>(id) % shards_.size()];
+    }
+
     /**
      * Generate a non-zero number
      */
     int64_t newSessionId();
 
+    /**
+     * Reclaim the expired sessions of the next shard
+     */
     void reclaimExpiredSessions();
 
 private:
     std::atomic<int64_t>                        nextId_{0};
-    folly::RWSpinLock                           rwlock_;        // TODO(dutor) writer might starve
-    std::unordered_map<int64_t, SessionPtr>     activeSessions_;
+    std::vector<Shard>                          shards_;
+    std::atomic<size_t>                         numSessions_{0};
+    // The shard to reclaim next, only accessed by the scavenger
+    size_t                                      nextReclaim_{0};
     std::unique_ptr<thread::GenericWorker>      scavenger_;
 };
 
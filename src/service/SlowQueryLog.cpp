@@ -0,0 +1,129 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "service/SlowQueryLog.h"
+
+#include <folly/Random.h>
+#include <folly/system/ThreadName.h>
+
+#include "common/fs/FileUtils.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+SlowQueryLog::SlowQueryLog(std::string path, size_t maxBytes, size_t maxFiles, size_t queueSize)
+    : path_(std::move(path)), maxBytes_(maxBytes), maxFiles_(maxFiles), queue_(queueSize) {
+    auto dir = fs::FileUtils::dirname(path_.c_str());
+    if (!dir.empty() && !fs::FileUtils::makeDir(dir)) {
+        LOG(ERROR) << "Failed to create the directory of the slow query log: " << dir;
+    }
+    open();
+    writer_ = std::thread([this]() {
+        folly::setThreadName("slow-query-log");
+        loop();
+    });
+}
+
+SlowQueryLog::~SlowQueryLog() {
+    queue_.blockingWrite(std::string());
+    writer_.join();
+}
+
+// static
+bool SlowQueryLog::enabled() {
+    return FLAGS_slow_query_threshold_us > 0 && !FLAGS_slow_query_log_file.empty();
+}
+
+// static
+std::unique_ptr<SlowQueryLog> SlowQueryLog::create() {
+    return std::make_unique<SlowQueryLog>(FLAGS_slow_query_log_file,
+                                          std::max<int64_t>(FLAGS_slow_query_log_max_bytes, 0),
+                                          std::max(FLAGS_slow_query_log_max_files, 0));
+}
+
+// static
+bool SlowQueryLog::isSlow(int64_t latencyInUs) {
+    return latencyInUs >= FLAGS_slow_query_threshold_us;
+}
+
+// static
+bool SlowQueryLog::sample() {
+    auto ratio = FLAGS_slow_query_sample_ratio;
+    return ratio >= 1.0 || (ratio > 0.0 && folly::Random::randDouble01() < ratio);
+}
+
+bool SlowQueryLog::add(std::string record) {
+    DCHECK(!record.empty());
+    if (!queue_.write(std::move(record))) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void SlowQueryLog::loop() {
+    while (true) {
+        std::string record;
+        queue_.blockingRead(record);
+        if (record.empty()) {
+            break;
+        }
+        write(record);
+        // Flush when there is nothing else to write, so the records are visible in time
+        if (queue_.isEmpty()) {
+            file_.flush();
+        }
+    }
+    file_.flush();
+}
+
+void SlowQueryLog::write(const std::string &record) {
+    if (maxBytes_ > 0 && size_ > 0 && size_ + record.size() + 1 > maxBytes_) {
+        rotate();
+    }
+    if (!file_.is_open()) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    file_ << record << '\n';
+    size_ += record.size() + 1;
+    written_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SlowQueryLog::open() {
+    file_.clear();
+    file_.open(path_, std::ios::out | std::ios::app);
+    if (!file_.is_open()) {
+        LOG(ERROR) << "Failed to open the slow query log: " << path_;
+        size_ = 0;
+        return;
+    }
+    file_.seekp(0, std::ios::end);
+    size_ = file_.tellp();
+}
+
+void SlowQueryLog::rotate() {
+    file_.close();
+    if (maxFiles_ == 0) {
+        ::unlink(path_.c_str());
+    } else {
+        // The oldest one is overwritten by the one next to it
+        for (auto i = maxFiles_ - 1; i > 0; --i) {
+            auto from = folly::stringPrintf("%s.%lu", path_.c_str(), i);
+            auto to = folly::stringPrintf("%s.%lu", path_.c_str(), i + 1);
+            ::rename(from.c_str(), to.c_str());
+        }
+        auto to = folly::stringPrintf("%s.1", path_.c_str());
+        if (::rename(path_.c_str(), to.c_str()) != 0) {
+            LOG(ERROR) << "Failed to rotate the slow query log: " << path_;
+        }
+    }
+    open();
+}
+
+}   // namespace graph
+}   // namespace nebula
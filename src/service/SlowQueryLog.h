@@ -0,0 +1,80 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef SERVICE_SLOWQUERYLOG_H_
+#define SERVICE_SLOWQUERYLOG_H_
+
+#include <folly/MPMCQueue.h>
+#include <fstream>
+#include <thread>
+
+#include "common/base/Base.h"
+#include "common/cpp/helpers.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * SlowQueryLog writes the records of the slow queries as JSON lines into a local file.
+ *
+ * The records are handed over to a background thread through a bounded queue, so the
+ * workers finishing the queries never wait for the disk. A record is dropped and counted
+ * when the queue is full. The file is rotated once it grows beyond `maxBytes', i.e. `file'
+ * is renamed to `file.1', `file.1' to `file.2' and so on, keeping at most `maxFiles' of them.
+ */
+class SlowQueryLog final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    SlowQueryLog(std::string path, size_t maxBytes, size_t maxFiles, size_t queueSize = 4096);
+
+    // Write out the queued records before it's gone
+    ~SlowQueryLog();
+
+    static bool enabled();
+
+    static std::unique_ptr<SlowQueryLog> create();
+
+    // Whether a query taking `latencyInUs' is slow
+    static bool isSlow(int64_t latencyInUs);
+
+    // Whether to capture the plan and profile of a query, by `--slow_query_sample_ratio'
+    static bool sample();
+
+    // Queue a record without blocking, return false if it's dropped for the full queue
+    bool add(std::string record);
+
+    uint64_t written() const {
+        return written_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t dropped() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void loop();
+
+    void write(const std::string &record);
+
+    void open();
+
+    void rotate();
+
+    const std::string                   path_;
+    const size_t                        maxBytes_;
+    const size_t                        maxFiles_;
+    // An empty record tells the writer to stop
+    folly::MPMCQueue<std::string>       queue_;
+    std::ofstream                       file_;
+    size_t                              size_{0};
+    std::atomic<uint64_t>               written_{0};
+    std::atomic<uint64_t>               dropped_{0};
+    std::thread                         writer_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // SERVICE_SLOWQUERYLOG_H_
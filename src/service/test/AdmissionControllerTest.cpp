@@ -0,0 +1,108 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/base/Base.h"
+#include "service/AdmissionController.h"
+
+namespace nebula {
+namespace graph {
+
+using Priority = AdmissionController::Priority;
+
+TEST(AdmissionController, QueueAndReject) {
+    AdmissionController admission(1, 1, {});
+    std::vector<int32_t> ran;
+
+    ASSERT_TRUE(admission.admit(1, "root", Priority::kNormal, nullptr,
+                                [&ran](int64_t) { ran.emplace_back(1); }).ok());
+    ASSERT_EQ(1, admission.running());
+    ASSERT_EQ(std::vector<int32_t>({1}), ran);
+
+    ASSERT_TRUE(admission.admit(1, "root", Priority::kNormal, nullptr,
+                                [&ran](int64_t) { ran.emplace_back(2); }).ok());
+    ASSERT_EQ(1, admission.queued());
+
+    // The queue is full
+    auto status = admission.admit(1, "root", Priority::kNormal, nullptr,
+                                  [&ran](int64_t) { ran.emplace_back(3); });
+    ASSERT_FALSE(status.ok());
+    ASSERT_EQ(1, admission.rejected());
+
+    admission.release();
+    ASSERT_EQ(std::vector<int32_t>({1, 2}), ran);
+    ASSERT_EQ(1, admission.running());
+    ASSERT_EQ(0, admission.queued());
+
+    admission.release();
+    ASSERT_EQ(0, admission.running());
+}
+
+TEST(AdmissionController, Priority) {
+    AdmissionController admission(1, 16, {});
+    std::vector<int32_t> ran;
+    ASSERT_TRUE(admission.admit(1, "root", Priority::kNormal, nullptr, [](int64_t) {}).ok());
+    ASSERT_TRUE(admission.admit(1, "root", Priority::kLow, nullptr,
+                                [&ran](int64_t) { ran.emplace_back(3); }).ok());
+    ASSERT_TRUE(admission.admit(2, "root", Priority::kNormal, nullptr,
+                                [&ran](int64_t) { ran.emplace_back(2); }).ok());
+    ASSERT_TRUE(admission.admit(3, "root", Priority::kHigh, nullptr,
+                                [&ran](int64_t) { ran.emplace_back(1); }).ok());
+    for (auto i = 0; i < 4; ++i) {
+        admission.release();
+    }
+    ASSERT_EQ(std::vector<int32_t>({1, 2, 3}), ran);
+    ASSERT_EQ(0, admission.running());
+}
+
+TEST(AdmissionController, FairShare) {
+    AdmissionController admission(1, 64, {{"heavy", 1}, {"light", 3}});
+    std::vector<int64_t> ran;
+    ASSERT_TRUE(admission.admit(0, "root", Priority::kNormal, nullptr, [](int64_t) {}).ok());
+    // Session 1 submits a burst before session 2
+    for (auto i = 0; i < 8; ++i) {
+        ASSERT_TRUE(admission.admit(1, "heavy", Priority::kNormal, nullptr,
+                                    [&ran](int64_t) { ran.emplace_back(1); }).ok());
+    }
+    for (auto i = 0; i < 8; ++i) {
+        ASSERT_TRUE(admission.admit(2, "light", Priority::kNormal, nullptr,
+                                    [&ran](int64_t) { ran.emplace_back(2); }).ok());
+    }
+    for (auto i = 0; i < 8; ++i) {
+        admission.release();
+    }
+    // The session of triple weight takes about three quarters of the slots
+    ASSERT_EQ(8, ran.size());
+    auto light = std::count(ran.begin(), ran.end(), 2);
+    ASSERT_GE(light, 5);
+    ASSERT_LE(light, 7);
+}
+
+TEST(AdmissionController, PriorityOf) {
+    ASSERT_EQ(Priority::kNormal, AdmissionController::priorityOf("GO FROM \"1\" OVER e"));
+    ASSERT_EQ(Priority::kHigh,
+              AdmissionController::priorityOf("/*+ PRIORITY(HIGH) */ FETCH PROP ON t \"1\""));
+    ASSERT_EQ(Priority::kLow,
+              AdmissionController::priorityOf("/*+ TIMEOUT(10) */ /*+ priority(low) */ GO"));
+    ASSERT_EQ(Priority::kNormal,
+              AdmissionController::priorityOf("GO /*+ PRIORITY(HIGH) */ FROM \"1\" OVER e"));
+}
+
+TEST(AdmissionController, ParseWeights) {
+    auto result = AdmissionController::parseWeights("root:4, user1 : 2");
+    ASSERT_TRUE(result.ok()) << result.status();
+    ASSERT_EQ(2, result.value().size());
+    ASSERT_EQ(4, result.value().at("root"));
+    ASSERT_EQ(2, result.value().at("user1"));
+
+    ASSERT_TRUE(AdmissionController::parseWeights("").ok());
+    ASSERT_FALSE(AdmissionController::parseWeights("root").ok());
+    ASSERT_FALSE(AdmissionController::parseWeights("root:0").ok());
+}
+
+}   // namespace graph
+}   // namespace nebula
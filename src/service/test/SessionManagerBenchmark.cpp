@@ -0,0 +1,89 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+#include "common/base/Base.h"
+#include <folly/Benchmark.h>
+#include "service/SessionManager.h"
+
+DEFINE_int32(bm_threads, 0, "Number of threads finding sessions, 0 for number of CPU cores");
+DEFINE_int32(bm_churn_threads, 2, "Number of threads creating and removing sessions");
+
+using nebula::graph::SessionManager;
+
+// Find the sessions from all the threads, while the others connect and disconnect
+size_t findSessions(size_t iters, size_t numSessions, bool churn) {
+    std::unique_ptr<SessionManager> sm;
+    std::vector<int64_t> ids;
+    BENCHMARK_SUSPEND {
+        sm = std::make_unique<SessionManager>();
+        ids.reserve(numSessions);
+        for (size_t i = 0; i < numSessions; i++) {
+            ids.emplace_back(sm->createSession()->id());
+        }
+    }
+
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> churners;
+    if (churn) {
+        for (auto i = 0; i < FLAGS_bm_churn_threads; i++) {
+            churners.emplace_back([&sm, &stop]() {
+                while (!stop.load(std::memory_order_relaxed)) {
+                    sm->removeSession(sm->createSession()->id());
+                }
+            });
+        }
+    }
+
+    std::vector<std::thread> finders;
+    for (auto t = 0; t < FLAGS_bm_threads; t++) {
+        finders.emplace_back([&sm, &ids, iters, t]() {
+            for (size_t i = 0; i < iters; i++) {
+                auto result = sm->findSession(ids[(i * FLAGS_bm_threads + t) % ids.size()]);
+                folly::doNotOptimizeAway(result);
+            }
+        });
+    }
+    for (auto &finder : finders) {
+        finder.join();
+    }
+
+    BENCHMARK_SUSPEND {
+        stop = true;
+        for (auto &churner : churners) {
+            churner.join();
+        }
+        sm.reset();
+    }
+    return iters * FLAGS_bm_threads;
+}
+
+BENCHMARK_MULTI(Find_1K, iters) {
+    return findSessions(iters, 1000, false);
+}
+
+BENCHMARK_RELATIVE_MULTI(Find_100K, iters) {
+    return findSessions(iters, 100000, false);
+}
+
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK_MULTI(FindWithChurn_1K, iters) {
+    return findSessions(iters, 1000, true);
+}
+
+BENCHMARK_RELATIVE_MULTI(FindWithChurn_100K, iters) {
+    return findSessions(iters, 100000, true);
+}
+
+int
+main(int argc, char **argv) {
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    if (FLAGS_bm_threads <= 0) {
+        FLAGS_bm_threads = std::thread::hardware_concurrency();
+    }
+
+    folly::runBenchmarks();
+    return 0;
+}
@@ -80,5 +80,121 @@ TEST(SessionManager, ExpiredSession) {
     worker->wait();
 }
 
+TEST(SessionManager, Concurrent) {
+    auto sm = std::make_shared<SessionManager>(4);
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 8; ++t) {
+        threads.emplace_back([sm] () {
+            std::vector<int64_t> ids;
+            for (auto i = 0; i < 1000; ++i) {
+                ids.emplace_back(sm->createSession()->id());
+            }
+            for (auto id : ids) {
+                auto result = sm->findSession(id);
+                ASSERT_TRUE(result.ok());
+                ASSERT_EQ(id, result.value()->id());
+            }
+            // Remove half of them
+            for (size_t i = 0; i < ids.size(); i += 2) {
+                ASSERT_NE(nullptr, sm->removeSession(ids[i]));
+                ASSERT_EQ(nullptr, sm->removeSession(ids[i]));
+                ASSERT_FALSE(sm->findSession(ids[i]).ok());
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(4000, sm->numSessions());
+}
+
+TEST(SessionManager, Cursor) {
+    FLAGS_max_cursors_per_session = 2;
+    auto sm = std::make_shared<SessionManager>();
+    auto session = sm->createSession();
+
+    DataSet ds({"id"});
+    for (int64_t i = 0; i < 5; ++i) {
+        ds.emplace_back(Row({Value(i)}));
+    }
+    ASSERT_TRUE(session->addCursor("c1", ds, 0).ok());
+    ASSERT_FALSE(session->addCursor("c1", ds, 0).ok());
+    ASSERT_TRUE(session->addCursor("c2", ds, 0).ok());
+    // Too many cursors
+    ASSERT_FALSE(session->addCursor("c3", ds, 0).ok());
+
+    auto page = session->fetchCursor("c1", 2);
+    ASSERT_TRUE(page.ok()) << page.status();
+    ASSERT_EQ(std::vector<std::string>({"id"}), page.value().colNames);
+    ASSERT_EQ(2, page.value().rows.size());
+    ASSERT_EQ(Value(0), page.value().rows[0].values[0]);
+    ASSERT_EQ(Value(1), page.value().rows[1].values[0]);
+
+    page = session->fetchCursor("c1", 4);
+    ASSERT_TRUE(page.ok()) << page.status();
+    ASSERT_EQ(3, page.value().rows.size());
+    ASSERT_EQ(Value(2), page.value().rows[0].values[0]);
+
+    // Exhausted
+    page = session->fetchCursor("c1", 4);
+    ASSERT_TRUE(page.ok()) << page.status();
+    ASSERT_EQ(0, page.value().rows.size());
+
+    ASSERT_TRUE(session->removeCursor("c1").ok());
+    ASSERT_FALSE(session->removeCursor("c1").ok());
+    ASSERT_FALSE(session->fetchCursor("c1", 1).ok());
+    ASSERT_TRUE(session->addCursor("c3", ds, 0).ok());
+}
+
+TEST(SessionManager, CursorBytes) {
+    FLAGS_max_cursors_per_session = 16;
+    FLAGS_max_cursor_bytes_per_session = 1000;
+    auto sm = std::make_shared<SessionManager>();
+    auto session = sm->createSession();
+
+    DataSet ds({"id"});
+    for (int64_t i = 0; i < 10; ++i) {
+        ds.emplace_back(Row({Value(i)}));
+    }
+    ASSERT_TRUE(session->addCursor("c1", ds, 600).ok());
+    auto status = session->addCursor("c2", ds, 600);
+    ASSERT_FALSE(status.ok());
+    ASSERT_EQ("The rows of cursor `c2' take about 600 bytes, over the 400 bytes left of the "
+              "cursors in the session, fetch fewer rows or CLOSE the other cursors",
+              status.toString());
+
+    // The bytes of the rows fetched are given back
+    ASSERT_TRUE(session->fetchCursor("c1", 5).ok());
+    ASSERT_TRUE(session->addCursor("c2", ds, 600).ok());
+    ASSERT_FALSE(session->addCursor("c3", ds, 200).ok());
+    ASSERT_TRUE(session->removeCursor("c2").ok());
+    ASSERT_TRUE(session->addCursor("c3", ds, 600).ok());
+    FLAGS_max_cursor_bytes_per_session = 0;
+    ASSERT_TRUE(session->addCursor("c4", ds, 1UL << 40).ok());
+}
+
+TEST(SessionManager, CursorExpired) {
+    FLAGS_max_cursors_per_session = 1;
+    FLAGS_cursor_idle_timeout_secs = 1;
+    auto sm = std::make_shared<SessionManager>();
+    auto session = sm->createSession();
+
+    DataSet ds({"id"});
+    ds.emplace_back(Row({Value(1)}));
+    ASSERT_TRUE(session->addCursor("c1", ds, 0).ok());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    auto page = session->fetchCursor("c1", 1);
+    ASSERT_FALSE(page.ok());
+    ASSERT_EQ("Cursor `c1' was closed after not fetched for 1 seconds",
+              page.status().toString());
+    ASSERT_FALSE(session->fetchCursor("c1", 1).ok());
+
+    // The expired cursors give way to the new ones
+    ASSERT_TRUE(session->addCursor("c2", ds, 0).ok());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    ASSERT_TRUE(session->addCursor("c3", ds, 0).ok());
+    FLAGS_cursor_idle_timeout_secs = 600;
+}
+
 }   // namespace graph
 }   // namespace nebula
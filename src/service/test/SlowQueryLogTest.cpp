@@ -0,0 +1,86 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/base/Base.h"
+#include "common/fs/FileUtils.h"
+#include "common/fs/TempDir.h"
+#include "service/SlowQueryLog.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+std::vector<std::string> readLines(const std::string &path) {
+    std::vector<std::string> lines;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        lines.emplace_back(std::move(line));
+    }
+    return lines;
+}
+
+}   // namespace
+
+TEST(SlowQueryLog, Write) {
+    fs::TempDir dir("/tmp/SlowQueryLog.Write.XXXXXX");
+    auto path = folly::stringPrintf("%s/logs/slow.log", dir.path());
+    {
+        SlowQueryLog log(path, 0, 0);
+        ASSERT_TRUE(log.add("{\"query\":\"GO FROM 1 OVER e\"}"));
+        ASSERT_TRUE(log.add("{\"query\":\"YIELD 1\"}"));
+    }
+    ASSERT_EQ(std::vector<std::string>({"{\"query\":\"GO FROM 1 OVER e\"}",
+                                        "{\"query\":\"YIELD 1\"}"}),
+              readLines(path));
+
+    // Appended to the existing one
+    {
+        SlowQueryLog log(path, 0, 0);
+        ASSERT_TRUE(log.add("{}"));
+    }
+    ASSERT_EQ(3, readLines(path).size());
+}
+
+TEST(SlowQueryLog, Rotate) {
+    fs::TempDir dir("/tmp/SlowQueryLog.Rotate.XXXXXX");
+    auto path = folly::stringPrintf("%s/slow.log", dir.path());
+    {
+        // Each record takes 10 bytes with the newline, two of them in a file
+        SlowQueryLog log(path, 20, 2);
+        for (auto i = 0; i < 7; ++i) {
+            ASSERT_TRUE(log.add(folly::stringPrintf("record-%02d", i)));
+        }
+        // Flushed when it's gone
+    }
+    ASSERT_EQ(std::vector<std::string>({"record-06"}), readLines(path));
+    ASSERT_EQ(std::vector<std::string>({"record-04", "record-05"}), readLines(path + ".1"));
+    ASSERT_EQ(std::vector<std::string>({"record-02", "record-03"}), readLines(path + ".2"));
+    // The oldest one is removed
+    ASSERT_FALSE(fs::FileUtils::exist(path + ".3"));
+}
+
+TEST(SlowQueryLog, Drop) {
+    fs::TempDir dir("/tmp/SlowQueryLog.Drop.XXXXXX");
+    auto path = folly::stringPrintf("%s/slow.log", dir.path());
+    size_t added = 0;
+    {
+        SlowQueryLog log(path, 0, 0, 1);
+        for (auto i = 0; i < 1000; ++i) {
+            if (log.add("{}")) {
+                ++added;
+            }
+        }
+        ASSERT_EQ(1000, added + log.dropped());
+    }
+    ASSERT_EQ(added, readLines(path).size());
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,493 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "util/ColumnarEncoder.h"
+
+#include <folly/Bits.h>
+#include <folly/Varint.h>
+#include <folly/compression/Compression.h>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
+
+#include "common/datatypes/ValueOps-inl.h"
+
+namespace nebula {
+namespace graph {
+
+const char ColumnarEncoder::kColumnName[] = "_columnar";
+
+namespace {
+
+constexpr folly::StringPiece kMagic{"NGC1"};
+
+enum class ColumnKind : uint8_t {
+    kNull = 0,
+    kBool = 1,
+    kInt = 2,
+    kFloat = 3,
+    kString = 4,
+    // Values of mixed or nested types
+    kValue = 5,
+};
+
+Status corrupted() {
+    return Status::Error("Corrupted columnar data");
+}
+
+// Only the plain NULL is kept in the bitmap, the other kinds of null are kept as values
+bool isPlainNull(const Value &value) {
+    return value.isNull() && value.getNull() == NullType::__NULL__;
+}
+
+ColumnKind kindOf(const Value &value) {
+    switch (value.type()) {
+        case Value::Type::BOOL:
+            return ColumnKind::kBool;
+        case Value::Type::INT:
+            return ColumnKind::kInt;
+        case Value::Type::FLOAT:
+            return ColumnKind::kFloat;
+        case Value::Type::STRING:
+            return ColumnKind::kString;
+        default:
+            return ColumnKind::kValue;
+    }
+}
+
+class Writer final {
+public:
+    void putByte(uint8_t byte) {
+        buf_.push_back(static_cast<char>(byte));
+    }
+
+    void putVarint(uint64_t value) {
+        uint8_t bytes[folly::kMaxVarintLength64];
+        auto size = folly::encodeVarint(value, bytes);
+        buf_.append(reinterpret_cast<const char *>(bytes), size);
+    }
+
+    void putBytes(folly::StringPiece bytes) {
+        putVarint(bytes.size());
+        buf_.append(bytes.data(), bytes.size());
+    }
+
+    void putDouble(double value) {
+        auto bits = folly::Endian::little(folly::bit_cast<uint64_t>(value));
+        buf_.append(reinterpret_cast<const char *>(&bits), sizeof(bits));
+    }
+
+    void putBitmap(const std::vector<bool> &bits) {
+        std::string bitmap((bits.size() + 7) / 8, '\0');
+        for (size_t i = 0; i < bits.size(); ++i) {
+            if (bits[i]) {
+                bitmap[i / 8] |= static_cast<char>(1 << (i % 8));
+            }
+        }
+        buf_.append(bitmap);
+    }
+
+    std::string &buf() {
+        return buf_;
+    }
+
+private:
+    std::string     buf_;
+};
+
+class Reader final {
+public:
+    explicit Reader(folly::StringPiece data) : data_(data) {}
+
+    bool getByte(uint8_t &byte) {
+        if (data_.empty()) {
+            return false;
+        }
+        byte = static_cast<uint8_t>(data_.front());
+        data_.advance(1);
+        return true;
+    }
+
+    bool getVarint(uint64_t &value) {
+        folly::ByteRange range(data_);
+        auto result = folly::tryDecodeVarint(range);
+        if (result.hasError()) {
+            return false;
+        }
+        value = result.value();
+        data_.advance(data_.size() - range.size());
+        return true;
+    }
+
+    bool getBytes(folly::StringPiece &bytes) {
+        uint64_t size = 0;
+        if (!getVarint(size) || size > data_.size()) {
+            return false;
+        }
+        bytes = data_.subpiece(0, size);
+        data_.advance(size);
+        return true;
+    }
+
+    bool getDouble(double &value) {
+        uint64_t bits = 0;
+        if (data_.size() < sizeof(bits)) {
+            return false;
+        }
+        memcpy(&bits, data_.data(), sizeof(bits));
+        data_.advance(sizeof(bits));
+        value = folly::bit_cast<double>(folly::Endian::little(bits));
+        return true;
+    }
+
+    bool getBitmap(size_t size, std::vector<bool> &bits) {
+        auto bytes = (size + 7) / 8;
+        if (data_.size() < bytes) {
+            return false;
+        }
+        bits.resize(size);
+        for (size_t i = 0; i < size; ++i) {
+            bits[i] = data_[i / 8] & (1 << (i % 8));
+        }
+        data_.advance(bytes);
+        return true;
+    }
+
+    folly::StringPiece rest() const {
+        return data_;
+    }
+
+private:
+    folly::StringPiece      data_;
+};
+
+std::unique_ptr<folly::io::Codec> makeCodec(ColumnarEncoder::Codec codec) {
+    folly::io::CodecType type;
+    switch (codec) {
+        case ColumnarEncoder::Codec::kLZ4:
+            type = folly::io::CodecType::LZ4;
+            break;
+        case ColumnarEncoder::Codec::kZSTD:
+            type = folly::io::CodecType::ZSTD;
+            break;
+        default:
+            return nullptr;
+    }
+    if (!folly::io::hasCodec(type)) {
+        return nullptr;
+    }
+    return folly::io::getCodec(type);
+}
+
+void encodeColumn(const std::vector<Row> &rows, size_t col, Writer &writer) {
+    // The kind of the column is the type shared by all its non-null values
+    auto kind = ColumnKind::kNull;
+    bool hasNull = false;
+    for (auto &row : rows) {
+        auto &value = row.values[col];
+        if (isPlainNull(value)) {
+            hasNull = true;
+            continue;
+        }
+        auto k = kindOf(value);
+        if (kind == ColumnKind::kNull) {
+            kind = k;
+        } else if (kind != k) {
+            kind = ColumnKind::kValue;
+        }
+        if (kind == ColumnKind::kValue) {
+            break;
+        }
+    }
+    writer.putByte(static_cast<uint8_t>(kind));
+    if (kind == ColumnKind::kNull) {
+        return;
+    }
+    if (kind == ColumnKind::kValue) {
+        for (auto &row : rows) {
+            writer.putBytes(apache::thrift::CompactSerializer::serialize<std::string>(
+                row.values[col]));
+        }
+        return;
+    }
+
+    writer.putByte(hasNull);
+    if (hasNull) {
+        std::vector<bool> nulls(rows.size());
+        for (size_t i = 0; i < rows.size(); ++i) {
+            nulls[i] = isPlainNull(rows[i].values[col]);
+        }
+        writer.putBitmap(nulls);
+    }
+    switch (kind) {
+        case ColumnKind::kBool: {
+            std::vector<bool> bools;
+            bools.reserve(rows.size());
+            for (auto &row : rows) {
+                auto &value = row.values[col];
+                if (!isPlainNull(value)) {
+                    bools.emplace_back(value.getBool());
+                }
+            }
+            writer.putBitmap(bools);
+            break;
+        }
+        case ColumnKind::kInt: {
+            for (auto &row : rows) {
+                auto &value = row.values[col];
+                if (!isPlainNull(value)) {
+                    writer.putVarint(folly::encodeZigZag(value.getInt()));
+                }
+            }
+            break;
+        }
+        case ColumnKind::kFloat: {
+            for (auto &row : rows) {
+                auto &value = row.values[col];
+                if (!isPlainNull(value)) {
+                    writer.putDouble(value.getFloat());
+                }
+            }
+            break;
+        }
+        case ColumnKind::kString: {
+            std::unordered_map<folly::StringPiece, uint64_t> dict;
+            std::vector<folly::StringPiece> strs;
+            std::vector<uint64_t> indexes;
+            indexes.reserve(rows.size());
+            for (auto &row : rows) {
+                auto &value = row.values[col];
+                if (isPlainNull(value)) {
+                    continue;
+                }
+                folly::StringPiece str(value.getStr());
+                auto result = dict.emplace(str, strs.size());
+                if (result.second) {
+                    strs.emplace_back(str);
+                }
+                indexes.emplace_back(result.first->second);
+            }
+            writer.putVarint(strs.size());
+            for (auto &str : strs) {
+                writer.putBytes(str);
+            }
+            for (auto index : indexes) {
+                writer.putVarint(index);
+            }
+            break;
+        }
+        default:
+            LOG(FATAL) << "Unexpected column kind " << static_cast<int>(kind);
+    }
+}
+
+Status decodeColumn(Reader &reader, size_t col, std::vector<Row> &rows) {
+    uint8_t byte = 0;
+    if (!reader.getByte(byte) || byte > static_cast<uint8_t>(ColumnKind::kValue)) {
+        return corrupted();
+    }
+    auto kind = static_cast<ColumnKind>(byte);
+    if (kind == ColumnKind::kNull) {
+        for (auto &row : rows) {
+            row.values[col] = Value::kNullValue;
+        }
+        return Status::OK();
+    }
+    if (kind == ColumnKind::kValue) {
+        for (auto &row : rows) {
+            folly::StringPiece bytes;
+            if (!reader.getBytes(bytes)) {
+                return corrupted();
+            }
+            apache::thrift::CompactSerializer::deserialize(bytes, row.values[col]);
+        }
+        return Status::OK();
+    }
+
+    std::vector<bool> nulls(rows.size(), false);
+    if (!reader.getByte(byte) || (byte != 0 && !reader.getBitmap(rows.size(), nulls))) {
+        return corrupted();
+    }
+    auto numValues = static_cast<size_t>(std::count(nulls.begin(), nulls.end(), false));
+    std::vector<Value> values;
+    values.reserve(numValues);
+    switch (kind) {
+        case ColumnKind::kBool: {
+            std::vector<bool> bools;
+            if (!reader.getBitmap(numValues, bools)) {
+                return corrupted();
+            }
+            for (auto b : bools) {
+                values.emplace_back(static_cast<bool>(b));
+            }
+            break;
+        }
+        case ColumnKind::kInt: {
+            for (size_t i = 0; i < numValues; ++i) {
+                uint64_t v = 0;
+                if (!reader.getVarint(v)) {
+                    return corrupted();
+                }
+                values.emplace_back(folly::decodeZigZag(v));
+            }
+            break;
+        }
+        case ColumnKind::kFloat: {
+            for (size_t i = 0; i < numValues; ++i) {
+                double v = 0;
+                if (!reader.getDouble(v)) {
+                    return corrupted();
+                }
+                values.emplace_back(v);
+            }
+            break;
+        }
+        case ColumnKind::kString: {
+            uint64_t size = 0;
+            if (!reader.getVarint(size) || size > reader.rest().size()) {
+                return corrupted();
+            }
+            std::vector<folly::StringPiece> strs(size);
+            for (auto &str : strs) {
+                if (!reader.getBytes(str)) {
+                    return corrupted();
+                }
+            }
+            for (size_t i = 0; i < numValues; ++i) {
+                uint64_t index = 0;
+                if (!reader.getVarint(index) || index >= strs.size()) {
+                    return corrupted();
+                }
+                values.emplace_back(strs[index].str());
+            }
+            break;
+        }
+        default:
+            return corrupted();
+    }
+
+    auto iter = values.begin();
+    for (size_t i = 0; i < rows.size(); ++i) {
+        rows[i].values[col] = nulls[i] ? Value::kNullValue : std::move(*iter++);
+    }
+    return Status::OK();
+}
+
+}   // namespace
+
+// static
+StatusOr<ColumnarEncoder::Codec> ColumnarEncoder::toCodec(folly::StringPiece name) {
+    if (name.equals("NONE", folly::AsciiCaseInsensitive())) {
+        return Codec::kNone;
+    }
+    if (name.equals("LZ4", folly::AsciiCaseInsensitive())) {
+        return Codec::kLZ4;
+    }
+    if (name.equals("ZSTD", folly::AsciiCaseInsensitive())) {
+        return Codec::kZSTD;
+    }
+    return Status::Error("Unknown codec `%s'", name.str().c_str());
+}
+
+// static
+std::string ColumnarEncoder::encode(const DataSet &ds, Codec codec) {
+    Writer body;
+    body.putVarint(ds.colNames.size());
+    for (auto &name : ds.colNames) {
+        body.putBytes(name);
+    }
+    body.putVarint(ds.rows.size());
+    for (size_t col = 0; col < ds.colNames.size(); ++col) {
+        encodeColumn(ds.rows, col, body);
+    }
+
+    auto compressor = makeCodec(codec);
+    if (compressor == nullptr) {
+        codec = Codec::kNone;
+    }
+    Writer writer;
+    writer.buf().append(kMagic.data(), kMagic.size());
+    writer.putByte(static_cast<uint8_t>(codec));
+    writer.putVarint(body.buf().size());
+    if (compressor == nullptr) {
+        writer.buf().append(body.buf());
+    } else {
+        writer.buf().append(compressor->compress(body.buf()));
+    }
+    return std::move(writer.buf());
+}
+
+// static
+StatusOr<DataSet> ColumnarEncoder::decode(folly::StringPiece data) {
+    if (!data.startsWith(kMagic)) {
+        return Status::Error("Not columnar data");
+    }
+    data.advance(kMagic.size());
+    Reader header(data);
+    uint8_t codec = 0;
+    uint64_t rawSize = 0;
+    if (!header.getByte(codec) || !header.getVarint(rawSize)) {
+        return corrupted();
+    }
+
+    std::string raw;
+    folly::StringPiece body = header.rest();
+    if (codec != static_cast<uint8_t>(Codec::kNone)) {
+        if (codec > static_cast<uint8_t>(Codec::kZSTD)) {
+            return corrupted();
+        }
+        auto compressor = makeCodec(static_cast<Codec>(codec));
+        if (compressor == nullptr) {
+            return Status::Error("The codec %d is not supported", codec);
+        }
+        try {
+            raw = compressor->uncompress(body, rawSize);
+        } catch (const std::exception &e) {
+            return Status::Error("Failed to uncompress the columnar data: %s", e.what());
+        }
+        body = raw;
+    }
+    if (body.size() != rawSize) {
+        return corrupted();
+    }
+
+    Reader reader(body);
+    uint64_t numCols = 0;
+    if (!reader.getVarint(numCols) || numCols > body.size()) {
+        return corrupted();
+    }
+    std::vector<std::string> colNames;
+    colNames.reserve(numCols);
+    for (uint64_t i = 0; i < numCols; ++i) {
+        folly::StringPiece name;
+        if (!reader.getBytes(name)) {
+            return corrupted();
+        }
+        colNames.emplace_back(name.str());
+    }
+    uint64_t numRows = 0;
+    if (!reader.getVarint(numRows)) {
+        return corrupted();
+    }
+
+    DataSet ds(std::move(colNames));
+    ds.rows.resize(numRows);
+    for (auto &row : ds.rows) {
+        row.values.resize(numCols);
+    }
+    try {
+        for (size_t col = 0; col < numCols; ++col) {
+            NG_RETURN_IF_ERROR(decodeColumn(reader, col, ds.rows));
+        }
+    } catch (const std::exception &e) {
+        return Status::Error("Failed to decode the columnar data: %s", e.what());
+    }
+    if (!reader.rest().empty()) {
+        return corrupted();
+    }
+    return ds;
+}
+
+}   // namespace graph
+}   // namespace nebula
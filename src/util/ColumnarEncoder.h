@@ -0,0 +1,60 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef UTIL_COLUMNARENCODER_H_
+#define UTIL_COLUMNARENCODER_H_
+
+#include <folly/Range.h>
+
+#include "common/base/Base.h"
+#include "common/base/StatusOr.h"
+#include "common/datatypes/DataSet.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * ColumnarEncoder lays a DataSet out column by column in a compact binary block,
+ * which is far smaller than the rows of tagged values for the large results:
+ *
+ *   magic "NGC1" | codec (1 byte) | raw size (varint) | body, compressed by the codec
+ *
+ *   body:   #columns | names | #rows | columns
+ *   column: kind (1 byte) | null bitmap if any null | values of the kind
+ *
+ * The values of a column of one scalar type are packed without type tags, i.e. the bools
+ * in a bitmap, the ints in zigzag varints, the floats in 8 bytes and the strings in
+ * a dictionary of the distinct strings with the varint index of each value, so the
+ * repeated vids and names are only sent once. The other columns keep each value in
+ * thrift compact encoding. The sizes and counts are all varints.
+ */
+class ColumnarEncoder final {
+public:
+    enum class Codec : uint8_t {
+        kNone = 0,
+        kLZ4 = 1,
+        kZSTD = 2,
+    };
+
+    // The codec named NONE, LZ4 or ZSTD, case-insensitively
+    static StatusOr<Codec> toCodec(folly::StringPiece name);
+
+    // Fall back to no compression if the codec is not built in
+    static std::string encode(const DataSet &ds, Codec codec);
+
+    static StatusOr<DataSet> decode(folly::StringPiece data);
+
+    // The response carries the encoded block in the only row of a dataset of this column
+    static const char kColumnName[];
+
+private:
+    ColumnarEncoder() = delete;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // UTIL_COLUMNARENCODER_H_
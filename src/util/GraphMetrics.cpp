@@ -0,0 +1,82 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "util/GraphMetrics.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+std::vector<int64_t> latencyBounds() {
+    // 50us ~ 52s
+    return Histogram::exponentialBounds(50, 60 * 1000 * 1000, 2);
+}
+
+}   // namespace
+
+// static
+HistogramFamily *GraphMetrics::queryLatency() {
+    static auto *family = MetricsRegistry::instance().histogramFamily(
+        "nebula_graph_query_latency_us", "Latency of queries", "kind", latencyBounds());
+    return family;
+}
+
+// static
+HistogramFamily *GraphMetrics::phaseLatency() {
+    static auto *family = MetricsRegistry::instance().histogramFamily(
+        "nebula_graph_phase_latency_us", "Latency of the phases of queries", "phase",
+        latencyBounds());
+    return family;
+}
+
+// static
+HistogramFamily *GraphMetrics::storageLatency() {
+    static auto *family = MetricsRegistry::instance().histogramFamily(
+        "nebula_graph_storage_latency_us", "Latency of storage requests by executors",
+        "executor", latencyBounds());
+    return family;
+}
+
+// static
+Counter *GraphMetrics::rowsReturned() {
+    static auto *counter = MetricsRegistry::instance().counter(
+        "nebula_graph_rows_returned_total", "Rows returned to clients");
+    return counter;
+}
+
+// static
+CounterFamily *GraphMetrics::errors() {
+    static auto *family = MetricsRegistry::instance().counterFamily(
+        "nebula_graph_query_errors_total", "Failed queries", "code");
+    return family;
+}
+
+// static
+std::string GraphMetrics::statementKind(const std::string &query) {
+    size_t pos = 0;
+    while (pos < query.size()) {
+        if (std::isspace(query[pos])) {
+            ++pos;
+        } else if (query.compare(pos, 2, "/*") == 0) {
+            auto end = query.find("*/", pos + 2);
+            pos = end == std::string::npos ? query.size() : end + 2;
+        } else {
+            break;
+        }
+    }
+    if (pos < query.size() && query[pos] == '$') {
+        return "ASSIGNMENT";
+    }
+    std::string kind;
+    for (; pos < query.size() && std::isalpha(query[pos]) && kind.size() < 16; ++pos) {
+        kind += std::toupper(query[pos]);
+    }
+    return kind.empty() ? "OTHER" : kind;
+}
+
+}   // namespace graph
+}   // namespace nebula
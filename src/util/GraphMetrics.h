@@ -0,0 +1,44 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef UTIL_GRAPHMETRICS_H_
+#define UTIL_GRAPHMETRICS_H_
+
+#include "util/Metrics.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * The metrics of the query engine, all latencies are in microseconds.
+ */
+class GraphMetrics final {
+public:
+    GraphMetrics() = delete;
+
+    // Latency of the whole query, labeled by `kind', see `statementKind'
+    static HistogramFamily *queryLatency();
+
+    // Latency of the `parse', `validate' and `execute' phases of queries
+    static HistogramFamily *phaseLatency();
+
+    // End to end latency of the storage requests, labeled by the executor name
+    static HistogramFamily *storageLatency();
+
+    static Counter *rowsReturned();
+
+    // Failed queries labeled by the error code
+    static CounterFamily *errors();
+
+    // The leading keyword of the query in upper case, e.g. GO or FETCH,
+    // to keep the number of the label values bounded.
+    static std::string statementKind(const std::string &query);
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // UTIL_GRAPHMETRICS_H_
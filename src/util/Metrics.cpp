@@ -0,0 +1,271 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "util/Metrics.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+std::string escape(const std::string &value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (auto c : value) {
+        switch (c) {
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            default:
+                escaped += c;
+        }
+    }
+    return escaped;
+}
+
+// `{label="value"' without the closing brace, or empty if there is no label
+std::string labelsOf(const std::string &label, const std::string &value) {
+    if (label.empty()) {
+        return "";
+    }
+    return folly::stringPrintf("{%s=\"%s\"", label.c_str(), escape(value).c_str());
+}
+
+void header(const std::string &name, const std::string &help, const char *type,
+            std::string *out) {
+    folly::stringAppendf(out, "# HELP %s %s\n", name.c_str(), help.c_str());
+    folly::stringAppendf(out, "# TYPE %s %s\n", name.c_str(), type);
+}
+
+void appendCounter(const std::string &name, const std::string &labels, int64_t value,
+                   std::string *out) {
+    folly::stringAppendf(out, "%s%s%s %ld\n",
+                         name.c_str(), labels.c_str(), labels.empty() ? "" : "}", value);
+}
+
+void appendHistogram(const std::string &name,
+                     const std::string &labels,
+                     const Histogram &histogram,
+                     std::string *out) {
+    auto snapshot = histogram.snapshot();
+    auto &bounds = histogram.bounds();
+    auto prefix = labels.empty() ? std::string("{") : labels + ",";
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        cumulative += snapshot.counts[i];
+        folly::stringAppendf(out, "%s_bucket%sle=\"%ld\"} %lu\n",
+                             name.c_str(), prefix.c_str(), bounds[i], cumulative);
+    }
+    folly::stringAppendf(out, "%s_bucket%sle=\"+Inf\"} %lu\n",
+                         name.c_str(), prefix.c_str(), snapshot.count);
+    auto suffix = labels.empty() ? "" : "}";
+    folly::stringAppendf(out, "%s_sum%s%s %ld\n",
+                         name.c_str(), labels.c_str(), suffix, snapshot.sum);
+    folly::stringAppendf(out, "%s_count%s%s %lu\n",
+                         name.c_str(), labels.c_str(), suffix, snapshot.count);
+}
+
+}   // namespace
+
+Counter::Cell::~Cell() {
+    owner->retired_.fetch_add(value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+Counter::Cell *Counter::local() {
+    auto *cell = cells_.get();
+    if (UNLIKELY(cell == nullptr)) {
+        cell = new Cell(this);
+        cells_.reset(cell);
+    }
+    return cell;
+}
+
+void Counter::add(int64_t delta) {
+    auto &value = local()->value;
+    // Only written by the owner thread
+    value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+}
+
+int64_t Counter::value() const {
+    // Hold the threads from exiting, so that no cell is counted twice or missed
+    auto accessor = cells_.accessAllThreads();
+    int64_t sum = retired_.load(std::memory_order_relaxed);
+    for (auto &cell : accessor) {
+        sum += cell.value.load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+Histogram::Histogram(std::vector<int64_t> bounds) : bounds_(std::move(bounds)) {
+    DCHECK(std::is_sorted(bounds_.begin(), bounds_.end()));
+    retired_.counts.resize(bounds_.size() + 1);
+}
+
+// static
+std::vector<int64_t> Histogram::exponentialBounds(int64_t start, int64_t end, int64_t factor) {
+    DCHECK_GT(start, 0);
+    DCHECK_GT(factor, 1);
+    std::vector<int64_t> bounds;
+    for (auto bound = start; bound <= end; bound *= factor) {
+        bounds.emplace_back(bound);
+    }
+    return bounds;
+}
+
+Histogram::Cell::~Cell() {
+    std::lock_guard<std::mutex> guard(owner->retiredLock_);
+    for (size_t i = 0; i < counts.size(); ++i) {
+        owner->retired_.counts[i] += counts[i].load(std::memory_order_relaxed);
+    }
+    owner->retired_.count += count.load(std::memory_order_relaxed);
+    owner->retired_.sum += sum.load(std::memory_order_relaxed);
+}
+
+Histogram::Cell *Histogram::local() {
+    auto *cell = cells_.get();
+    if (UNLIKELY(cell == nullptr)) {
+        cell = new Cell(this, bounds_.size() + 1);
+        cells_.reset(cell);
+    }
+    return cell;
+}
+
+void Histogram::add(int64_t value) {
+    auto *cell = local();
+    auto bucket = std::lower_bound(bounds_.begin(), bounds_.end(), value) - bounds_.begin();
+    // Only written by the owner thread
+    auto &counter = cell->counts[bucket];
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    cell->count.store(cell->count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    cell->sum.store(cell->sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+Histogram::Snapshot Histogram::snapshot() const {
+    // Lock the threads before the retired cells, the same order as a thread exits
+    auto accessor = cells_.accessAllThreads();
+    Snapshot snapshot;
+    {
+        std::lock_guard<std::mutex> guard(retiredLock_);
+        snapshot = retired_;
+    }
+    for (auto &cell : accessor) {
+        for (size_t i = 0; i < cell.counts.size(); ++i) {
+            snapshot.counts[i] += cell.counts[i].load(std::memory_order_relaxed);
+        }
+        snapshot.count += cell.count.load(std::memory_order_relaxed);
+        snapshot.sum += cell.sum.load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+// static
+MetricsRegistry &MetricsRegistry::instance() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+Counter *MetricsRegistry::counter(const std::string &name, const std::string &help) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &counter = counters_[name];
+    if (counter.second == nullptr) {
+        counter.first = help;
+        counter.second = std::make_unique<Counter>();
+    }
+    return counter.second.get();
+}
+
+CounterFamily *MetricsRegistry::counterFamily(const std::string &name,
+                                              const std::string &help,
+                                              const std::string &label) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &family = counterFamilies_[name];
+    if (family == nullptr) {
+        family = std::make_unique<CounterFamily>(
+            name, help, label, []() { return std::make_unique<Counter>(); });
+    }
+    return family.get();
+}
+
+Histogram *MetricsRegistry::histogram(const std::string &name,
+                                      const std::string &help,
+                                      std::vector<int64_t> bounds) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &histogram = histograms_[name];
+    if (histogram.second == nullptr) {
+        histogram.first = help;
+        histogram.second = std::make_unique<Histogram>(std::move(bounds));
+    }
+    return histogram.second.get();
+}
+
+HistogramFamily *MetricsRegistry::histogramFamily(const std::string &name,
+                                                  const std::string &help,
+                                                  const std::string &label,
+                                                  std::vector<int64_t> bounds) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &family = histogramFamilies_[name];
+    if (family == nullptr) {
+        family = std::make_unique<HistogramFamily>(
+            name, help, label, [bounds = std::move(bounds)]() {
+                return std::make_unique<Histogram>(bounds);
+            });
+    }
+    return family.get();
+}
+
+void MetricsRegistry::addCallback(const std::string &name,
+                                  const std::string &help,
+                                  const std::string &type,
+                                  std::function<int64_t()> fn) {
+    std::lock_guard<std::mutex> guard(lock_);
+    callbacks_[name] = Callback{help, type, std::move(fn)};
+}
+
+void MetricsRegistry::removeCallback(const std::string &name) {
+    std::lock_guard<std::mutex> guard(lock_);
+    callbacks_.erase(name);
+}
+
+std::string MetricsRegistry::toPrometheus() const {
+    std::string out;
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto &kv : counters_) {
+        header(kv.first, kv.second.first, "counter", &out);
+        appendCounter(kv.first, "", kv.second.second->value(), &out);
+    }
+    for (auto &kv : counterFamilies_) {
+        auto &family = *kv.second;
+        header(family.name(), family.help(), "counter", &out);
+        family.forEach([&family, &out](const std::string &value, const Counter &counter) {
+            appendCounter(family.name(), labelsOf(family.label(), value), counter.value(), &out);
+        });
+    }
+    for (auto &kv : histograms_) {
+        header(kv.first, kv.second.first, "histogram", &out);
+        appendHistogram(kv.first, "", *kv.second.second, &out);
+    }
+    for (auto &kv : histogramFamilies_) {
+        auto &family = *kv.second;
+        header(family.name(), family.help(), "histogram", &out);
+        family.forEach([&family, &out](const std::string &value, const Histogram &histogram) {
+            appendHistogram(family.name(), labelsOf(family.label(), value), histogram, &out);
+        });
+    }
+    for (auto &kv : callbacks_) {
+        header(kv.first, kv.second.help, kv.second.type.c_str(), &out);
+        appendCounter(kv.first, "", kv.second.fn(), &out);
+    }
+    return out;
+}
+
+}   // namespace graph
+}   // namespace nebula
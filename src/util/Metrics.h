@@ -0,0 +1,214 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef UTIL_METRICS_H_
+#define UTIL_METRICS_H_
+
+#include <folly/ThreadLocal.h>
+
+#include "common/base/Base.h"
+#include "common/cpp/helpers.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * The metrics exported in the Prometheus text format.
+ *
+ * Counters and histograms keep their data in per-thread cells which are only written by the
+ * owner thread, so the updates on the hot path never contend with each other. The cells of
+ * all threads are summed up when the metrics are exported, and the cells of an exiting thread
+ * are merged into the retired ones to not lose the data.
+ */
+class Counter final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    Counter() = default;
+
+    void add(int64_t delta = 1);
+
+    int64_t value() const;
+
+private:
+    struct Tag {};
+
+    struct Cell {
+        explicit Cell(Counter *c) : owner(c) {}
+        ~Cell();
+
+        Counter                    *owner;
+        std::atomic<int64_t>        value{0};
+    };
+
+    Cell *local();
+
+    std::atomic<int64_t>                    retired_{0};
+    // Declared the last to be destroyed first, when the retired data is still alive
+    mutable folly::ThreadLocalPtr<Cell, Tag> cells_;
+};
+
+class Histogram final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    // The upper bounds of the buckets in ascending order, besides the implicit +Inf
+    explicit Histogram(std::vector<int64_t> bounds);
+
+    void add(int64_t value);
+
+    struct Snapshot {
+        // The non-cumulative count of each bucket, the last one is of +Inf
+        std::vector<uint64_t>       counts;
+        uint64_t                    count{0};
+        int64_t                     sum{0};
+    };
+
+    Snapshot snapshot() const;
+
+    const std::vector<int64_t> &bounds() const {
+        return bounds_;
+    }
+
+    // Bounds growing by `factor' from `start' to at most `end'
+    static std::vector<int64_t> exponentialBounds(int64_t start, int64_t end, int64_t factor);
+
+private:
+    struct Tag {};
+
+    struct Cell {
+        Cell(Histogram *h, size_t numBuckets) : owner(h), counts(numBuckets) {}
+        ~Cell();
+
+        Histogram                                  *owner;
+        std::vector<std::atomic<uint64_t>>          counts;
+        std::atomic<uint64_t>                       count{0};
+        std::atomic<int64_t>                        sum{0};
+    };
+
+    Cell *local();
+
+    const std::vector<int64_t>              bounds_;
+    mutable std::mutex                      retiredLock_;
+    Snapshot                                retired_;
+    mutable folly::ThreadLocalPtr<Cell, Tag> cells_;
+};
+
+/**
+ * A family of the metrics of the same name, distinguished by the value of one label.
+ * The metric of a label value is looked up in a thread local cache after its first use.
+ */
+template <typename T>
+class MetricFamily final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    using Factory = std::function<std::unique_ptr<T>()>;
+
+    MetricFamily(std::string name, std::string help, std::string label, Factory factory)
+        : name_(std::move(name)),
+          help_(std::move(help)),
+          label_(std::move(label)),
+          factory_(std::move(factory)) {}
+
+    T *get(const std::string &labelValue) {
+        auto &cache = *cache_;
+        auto found = cache.find(labelValue);
+        if (found != cache.end()) {
+            return found->second;
+        }
+        std::lock_guard<std::mutex> guard(lock_);
+        auto &metric = metrics_[labelValue];
+        if (metric == nullptr) {
+            metric = factory_();
+        }
+        cache.emplace(labelValue, metric.get());
+        return metric.get();
+    }
+
+    // Call `fn' with each label value and the metric, in the order of the label values
+    void forEach(std::function<void(const std::string &, const T &)> fn) const {
+        std::lock_guard<std::mutex> guard(lock_);
+        for (auto &kv : metrics_) {
+            fn(kv.first, *kv.second);
+        }
+    }
+
+    const std::string &name() const {
+        return name_;
+    }
+
+    const std::string &help() const {
+        return help_;
+    }
+
+    const std::string &label() const {
+        return label_;
+    }
+
+private:
+    const std::string                                           name_;
+    const std::string                                           help_;
+    const std::string                                           label_;
+    const Factory                                               factory_;
+    mutable std::mutex                                          lock_;
+    std::map<std::string, std::unique_ptr<T>>                   metrics_;
+    folly::ThreadLocal<std::unordered_map<std::string, T *>>    cache_;
+};
+
+using CounterFamily = MetricFamily<Counter>;
+using HistogramFamily = MetricFamily<Histogram>;
+
+/**
+ * MetricsRegistry keeps all the metrics to be exported.
+ */
+class MetricsRegistry final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    static MetricsRegistry &instance();
+
+    // The metrics are never removed, so the returned pointers are always valid
+    Counter *counter(const std::string &name, const std::string &help);
+
+    CounterFamily *counterFamily(const std::string &name,
+                                 const std::string &help,
+                                 const std::string &label);
+
+    Histogram *histogram(const std::string &name,
+                         const std::string &help,
+                         std::vector<int64_t> bounds);
+
+    HistogramFamily *histogramFamily(const std::string &name,
+                                     const std::string &help,
+                                     const std::string &label,
+                                     std::vector<int64_t> bounds);
+
+    // The metric whose value is read by `fn' when exported, `type' is either "gauge" or
+    // "counter". The owner of the state read by `fn' should remove it before the state dies.
+    void addCallback(const std::string &name,
+                     const std::string &help,
+                     const std::string &type,
+                     std::function<int64_t()> fn);
+
+    void removeCallback(const std::string &name);
+
+    // Export all the metrics in the Prometheus text format
+    std::string toPrometheus() const;
+
+private:
+    MetricsRegistry() = default;
+
+    struct Callback {
+        std::string                 help;
+        std::string                 type;
+        std::function<int64_t()>    fn;
+    };
+
+    mutable std::mutex                                          lock_;
+    std::map<std::string, std::pair<std::string, std::unique_ptr<Counter>>>     counters_;
+    std::map<std::string, std::unique_ptr<CounterFamily>>                       counterFamilies_;
+    std::map<std::string, std::pair<std::string, std::unique_ptr<Histogram>>>   histograms_;
+    std::map<std::string, std::unique_ptr<HistogramFamily>>                     histogramFamilies_;
+    std::map<std::string, Callback>                                             callbacks_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // UTIL_METRICS_H_
@@ -0,0 +1,141 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "util/QueryTrace.h"
+
+#include <folly/system/ThreadId.h>
+#include <folly/system/ThreadName.h>
+
+#include "util/ToJson.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+// The virtual lanes are numbered after all the thread ids
+constexpr uint64_t kFirstLane = 1UL << 32;
+
+folly::dynamic threadName(uint64_t tid, const std::string &name) {
+    return folly::dynamic::object("name", "thread_name")("ph", "M")("pid", 1)("tid", tid)(
+        "args", folly::dynamic::object("name", name));
+}
+
+}   // namespace
+
+class QueryTrace::TracingExecutor final : public folly::Executor {
+public:
+    TracingExecutor(QueryTrace *trace, folly::Executor *runner) : trace_(trace), runner_(runner) {}
+
+    void add(folly::Func func) override {
+        auto trace = trace_->shared_from_this();
+        auto queued = trace->now();
+        auto from = currentThread();
+        runner_->add([trace = std::move(trace), queued, from, func = std::move(func)]() mutable {
+            auto begin = trace->now();
+            func();
+            trace->addSpan("task",
+                           "runner",
+                           begin,
+                           trace->now(),
+                           {{"queued_in_us", folly::to<std::string>(begin - queued)},
+                            {"from_tid", folly::to<std::string>(from)}});
+        });
+    }
+
+    uint8_t getNumPriorities() const override {
+        return runner_->getNumPriorities();
+    }
+
+private:
+    QueryTrace             *trace_;
+    folly::Executor        *runner_;
+};
+
+QueryTrace::QueryTrace() : start_(std::chrono::steady_clock::now()) {}
+
+int64_t QueryTrace::now() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start_)
+        .count();
+}
+
+// static
+uint64_t QueryTrace::currentThread() {
+    return folly::getOSThreadID();
+}
+
+void QueryTrace::addSpan(std::string name, std::string category, int64_t begin, int64_t end,
+                         Args args) {
+    TraceEvent event;
+    event.name = std::move(name);
+    event.category = std::move(category);
+    event.begin = begin;
+    event.duration = end - begin;
+    event.tid = currentThread();
+    event.args = std::move(args);
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (threadNames_.find(event.tid) != threadNames_.end()) {
+            events_.emplace_back(std::move(event));
+            return;
+        }
+    }
+    // Get the name out of the lock, it's only done once for each thread
+    auto thread = folly::getCurrentThreadName().value_or("");
+    if (thread.empty()) {
+        thread = folly::stringPrintf("thread %lu", event.tid);
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    threadNames_.emplace(event.tid, std::move(thread));
+    events_.emplace_back(std::move(event));
+}
+
+void QueryTrace::addSpanOn(const std::string &lane, std::string name, std::string category,
+                           int64_t begin, int64_t end, Args args) {
+    TraceEvent event;
+    event.name = std::move(name);
+    event.category = std::move(category);
+    event.begin = begin;
+    event.duration = end - begin;
+    event.args = std::move(args);
+    event.args.emplace("tid", folly::to<std::string>(currentThread()));
+    std::lock_guard<std::mutex> guard(lock_);
+    event.tid = lanes_.emplace(lane, kFirstLane + lanes_.size()).first->second;
+    events_.emplace_back(std::move(event));
+}
+
+folly::Executor *QueryTrace::wrap(folly::Executor *runner) {
+    if (runner == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &wrapped = runners_[runner];
+    if (wrapped == nullptr) {
+        wrapped = std::make_unique<TracingExecutor>(this, runner);
+    }
+    return wrapped.get();
+}
+
+folly::dynamic QueryTrace::toJson() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto events = util::toJson(events_);
+    for (auto &kv : threadNames_) {
+        events.push_back(threadName(kv.first, kv.second));
+    }
+    for (auto &kv : lanes_) {
+        events.push_back(threadName(kv.second, kv.first));
+    }
+    return folly::dynamic::object("traceEvents", std::move(events))("displayTimeUnit", "ms");
+}
+
+size_t QueryTrace::numEvents() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return events_.size();
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,84 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef UTIL_QUERYTRACE_H_
+#define UTIL_QUERYTRACE_H_
+
+#include <folly/Executor.h>
+#include <folly/dynamic.h>
+
+#include "common/base/Base.h"
+#include "common/cpp/helpers.h"
+
+namespace nebula {
+namespace graph {
+
+// A complete event of the Chrome trace-event format, the times are in microseconds
+struct TraceEvent {
+    std::string                                     name;
+    std::string                                     category;
+    int64_t                                         begin{0};
+    int64_t                                         duration{0};
+    uint64_t                                        tid{0};
+    std::unordered_map<std::string, std::string>    args;
+};
+
+/**
+ * QueryTrace records the timeline of a traced query, to be viewed in about:tracing or Perfetto.
+ *
+ * The spans are either recorded on the thread running them, or on a virtual lane of their own,
+ * e.g. one lane for each executor and each storage host, since their spans might cross
+ * threads or overlap. The tasks run by the runner returned by `wrap' record the time waited
+ * in its queue on the thread running them, which shows how the query hops between threads.
+ */
+class QueryTrace final : public std::enable_shared_from_this<QueryTrace>,
+                         private cpp::NonCopyable,
+                         private cpp::NonMovable {
+public:
+    using Args = std::unordered_map<std::string, std::string>;
+
+    QueryTrace();
+
+    // Microseconds since the trace began
+    int64_t now() const;
+
+    // Record a span on the current thread
+    void addSpan(std::string name, std::string category, int64_t begin, int64_t end,
+                 Args args = {});
+
+    // Record a span on the virtual lane named `lane'
+    void addSpanOn(const std::string &lane, std::string name, std::string category,
+                   int64_t begin, int64_t end, Args args = {});
+
+    // The runner to run the tasks on `runner' and record their hops, it lives with the trace.
+    // The queued tasks keep the trace alive.
+    folly::Executor *wrap(folly::Executor *runner);
+
+    // The trace in Chrome trace-event JSON
+    folly::dynamic toJson() const;
+
+    size_t numEvents() const;
+
+    // Id of the current thread
+    static uint64_t currentThread();
+
+private:
+    class TracingExecutor;
+
+    void add(TraceEvent event);
+
+    const std::chrono::steady_clock::time_point                     start_;
+    mutable std::mutex                                              lock_;
+    std::vector<TraceEvent>                                         events_;
+    std::unordered_map<uint64_t, std::string>                       threadNames_;
+    std::unordered_map<std::string, uint64_t>                       lanes_;
+    std::unordered_map<folly::Executor *, std::unique_ptr<TracingExecutor>> runners_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // UTIL_QUERYTRACE_H_
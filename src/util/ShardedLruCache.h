@@ -0,0 +1,187 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef UTIL_SHARDEDLRUCACHE_H_
+#define UTIL_SHARDEDLRUCACHE_H_
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <folly/Optional.h>
+
+#include "common/base/Logging.h"
+#include "common/cpp/helpers.h"
+
+namespace nebula {
+
+/**
+ * A size-bounded LRU cache which is split into several shards by the hash of keys,
+ * each shard is guarded by its own lock to reduce the contention.
+ * The capacity is counted in number of entries and evenly divided among shards.
+ * Values are copied out on lookup, so a big value should be wrapped by a shared pointer.
+ *
+ * To fill the cache from a read which may race with the writes, take the `epoch()' before
+ * sending the read and `fill()' with it afterwards. Each `invalidate()' stamps the key with a
+ * new epoch, and a fill whose epoch is older than the stamp of its key is dropped.
+ * The stamps are kept in a fixed number of slots per shard, so a fill could be dropped
+ * spuriously by the invalidation of another key in the same slot, but never accepted wrongly.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>>
+class ShardedLruCache final : private cpp::NonCopyable, private cpp::NonMovable {
+public:
+    explicit ShardedLruCache(size_t capacity, size_t numShards = 16) : shards_(numShards) {
+        DCHECK_GT(numShards, 0UL);
+        auto shardCapacity = std::max<size_t>(1UL, capacity / numShards);
+        for (auto &shard : shards_) {
+            shard.capacity = shardCapacity;
+            shard.generations.resize(kGenerationSlots, 0);
+        }
+    }
+
+    folly::Optional<V> get(const K &key) {
+        auto &shard = shardOf(key);
+        std::lock_guard<std::mutex> g(shard.lock);
+        auto found = shard.index.find(key);
+        if (found == shard.index.end()) {
+            return folly::none;
+        }
+        // Move to the front as the most recently used one
+        shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+        return found->second->second;
+    }
+
+    void put(const K &key, V value) {
+        auto &shard = shardOf(key);
+        std::lock_guard<std::mutex> g(shard.lock);
+        assign(shard, key, std::move(value));
+    }
+
+    // The epoch to be passed to `fill()', which must be taken before the read is sent
+    uint64_t epoch() const {
+        return epoch_.load(std::memory_order_acquire);
+    }
+
+    // Update the value of `key' by `update(folly::Optional<V>&)' under the shard lock,
+    // the key is erased if the value is left none. Nothing is done and false is returned
+    // if the key has been invalidated since `epoch'.
+    template <typename F>
+    bool fill(const K &key, uint64_t epoch, F &&update) {
+        auto &shard = shardOf(key);
+        std::lock_guard<std::mutex> g(shard.lock);
+        if (shard.generations[slotOf(key)] > epoch) {
+            return false;
+        }
+        modify(shard, key, std::forward<F>(update));
+        return true;
+    }
+
+    // Update the value of `key' like `fill()' and drop all the fills of it in flight
+    template <typename F>
+    void invalidate(const K &key, F &&update) {
+        auto &shard = shardOf(key);
+        std::lock_guard<std::mutex> g(shard.lock);
+        shard.generations[slotOf(key)] = epoch_.fetch_add(1, std::memory_order_acq_rel) + 1;
+        modify(shard, key, std::forward<F>(update));
+    }
+
+    void invalidate(const K &key) {
+        invalidate(key, [](folly::Optional<V> &value) { value = folly::none; });
+    }
+
+    bool erase(const K &key) {
+        auto &shard = shardOf(key);
+        std::lock_guard<std::mutex> g(shard.lock);
+        auto found = shard.index.find(key);
+        if (found == shard.index.end()) {
+            return false;
+        }
+        shard.lru.erase(found->second);
+        shard.index.erase(found);
+        return true;
+    }
+
+    void clear() {
+        for (auto &shard : shards_) {
+            std::lock_guard<std::mutex> g(shard.lock);
+            shard.index.clear();
+            shard.lru.clear();
+        }
+    }
+
+    size_t size() {
+        size_t total = 0;
+        for (auto &shard : shards_) {
+            std::lock_guard<std::mutex> g(shard.lock);
+            total += shard.lru.size();
+        }
+        return total;
+    }
+
+private:
+    using Entries = std::list<std::pair<K, V>>;
+
+    static constexpr size_t kGenerationSlots = 256;
+
+    struct Shard {
+        std::mutex                                              lock;
+        size_t                                                  capacity{0};
+        Entries                                                 lru;
+        std::unordered_map<K, typename Entries::iterator, Hash> index;
+        // The epoch of the last invalidation of the keys in each slot
+        std::vector<uint64_t>                                   generations;
+    };
+
+    Shard &shardOf(const K &key) {
+        return shards_[hash_(key) % shards_.size()];
+    }
+
+    size_t slotOf(const K &key) {
+        return hash_(key) / shards_.size() % kGenerationSlots;
+    }
+
+    // Both of the following are called with the shard lock held
+    void assign(Shard &shard, const K &key, V value) {
+        auto found = shard.index.find(key);
+        if (found != shard.index.end()) {
+            found->second->second = std::move(value);
+            shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+            return;
+        }
+        shard.lru.emplace_front(key, std::move(value));
+        shard.index.emplace(key, shard.lru.begin());
+        while (shard.lru.size() > shard.capacity) {
+            shard.index.erase(shard.lru.back().first);
+            shard.lru.pop_back();
+        }
+    }
+
+    template <typename F>
+    void modify(Shard &shard, const K &key, F &&update) {
+        auto found = shard.index.find(key);
+        folly::Optional<V> value;
+        if (found != shard.index.end()) {
+            value = found->second->second;
+        }
+        update(value);
+        if (value.hasValue()) {
+            assign(shard, key, std::move(value).value());
+        } else if (found != shard.index.end()) {
+            shard.lru.erase(found->second);
+            shard.index.erase(found);
+        }
+    }
+
+    Hash                    hash_;
+    std::vector<Shard>      shards_;
+    std::atomic<uint64_t>   epoch_{0};
+};
+
+}   // namespace nebula
+
+#endif   // UTIL_SHARDEDLRUCACHE_H_
@@ -10,7 +10,9 @@
 #include "common/datatypes/Value.h"
 #include "common/expression/Expression.h"
 #include "parser/EdgeKey.h"
+#include "util/QueryTrace.h"
 
+#include "common/interface/gen-cpp2/graph_types.h"
 #include "common/interface/gen-cpp2/meta_types.h"
 #include "common/interface/gen-cpp2/storage_types.h"
 
@@ -227,5 +229,64 @@ folly::dynamic toJson(const storage::cpp2::Expr &expr) {
     return obj;
 }
 
+folly::dynamic toJson(const graph::cpp2::ProfilingStats &stats) {
+    folly::dynamic obj = folly::dynamic::object();
+    obj.insert("rows", stats.get_rows());
+    obj.insert("execDurationInUs", stats.get_exec_duration_in_us());
+    obj.insert("totalDurationInUs", stats.get_total_duration_in_us());
+    if (stats.__isset.other_stats) {
+        folly::dynamic other = folly::dynamic::object();
+        for (auto &kv : *stats.get_other_stats()) {
+            other.insert(kv.first, kv.second);
+        }
+        obj.insert("otherStats", std::move(other));
+    }
+    return obj;
+}
+
+folly::dynamic toJson(const graph::cpp2::PlanNodeDescription &desc) {
+    folly::dynamic obj = folly::dynamic::object();
+    obj.insert("id", desc.get_id());
+    obj.insert("name", desc.get_name());
+    obj.insert("outputVar", desc.get_output_var());
+    if (desc.__isset.dependencies) {
+        obj.insert("dependencies", toJson(*desc.get_dependencies()));
+    }
+    if (desc.__isset.description) {
+        folly::dynamic description = folly::dynamic::object();
+        for (auto &pair : *desc.get_description()) {
+            description.insert(pair.get_key(), pair.get_value());
+        }
+        obj.insert("description", std::move(description));
+    }
+    if (desc.__isset.profiles) {
+        obj.insert("profiles", toJson(*desc.get_profiles()));
+    }
+    if (desc.__isset.branch_info) {
+        auto *info = desc.get_branch_info();
+        obj.insert("branchInfo",
+                   folly::dynamic::object("isDoBranch", info->get_is_do_branch())(
+                       "conditionNodeId", info->get_condition_node_id()));
+    }
+    return obj;
+}
+
+folly::dynamic toJson(const graph::cpp2::PlanDescription &desc) {
+    folly::dynamic obj = folly::dynamic::object();
+    obj.insert("format", desc.get_format());
+    obj.insert("planNodeDescs", toJson(desc.get_plan_node_descs()));
+    return obj;
+}
+
+folly::dynamic toJson(const graph::TraceEvent &event) {
+    folly::dynamic args = folly::dynamic::object();
+    for (auto &kv : event.args) {
+        args.insert(kv.first, kv.second);
+    }
+    return folly::dynamic::object("name", event.name)("cat", event.category)("ph", "X")(
+        "ts", event.begin)("dur", event.duration)("pid", 1)("tid", event.tid)(
+        "args", std::move(args));
+}
+
 }   // namespace util
 }   // namespace nebula
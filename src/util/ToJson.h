@@ -46,6 +46,16 @@ class Expr;
 }   // namespace cpp2
 }   // namespace storage
 
+namespace graph {
+struct TraceEvent;
+
+namespace cpp2 {
+class PlanDescription;
+class PlanNodeDescription;
+class ProfilingStats;
+}   // namespace cpp2
+}   // namespace graph
+
 namespace util {
 
 template <typename T>
@@ -76,6 +86,10 @@ folly::dynamic toJson(const storage::cpp2::VertexProp &prop);
 folly::dynamic toJson(const storage::cpp2::EdgeProp &prop);
 folly::dynamic toJson(const storage::cpp2::StatProp &prop);
 folly::dynamic toJson(const storage::cpp2::Expr &expr);
+folly::dynamic toJson(const graph::cpp2::ProfilingStats &stats);
+folly::dynamic toJson(const graph::cpp2::PlanNodeDescription &desc);
+folly::dynamic toJson(const graph::cpp2::PlanDescription &desc);
+folly::dynamic toJson(const graph::TraceEvent &event);
 
 template <typename K, typename V>
 folly::dynamic toJson(const std::pair<K, V> &p) {
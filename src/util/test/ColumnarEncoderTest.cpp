@@ -0,0 +1,84 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/datatypes/Vertex.h"
+#include "util/ColumnarEncoder.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+DataSet makeDataSet(size_t numRows) {
+    DataSet ds({"vid", "name", "age", "score", "male", "vertex", "mixed", "none"});
+    for (size_t i = 0; i < numRows; ++i) {
+        Row row;
+        row.values.emplace_back(folly::to<std::string>(i % 100));
+        row.values.emplace_back(i % 7 == 0 ? Value::kNullValue : Value("like"));
+        row.values.emplace_back(static_cast<int64_t>(i) - 50);
+        row.values.emplace_back(i * 0.5);
+        row.values.emplace_back(i % 3 == 0);
+        Vertex vertex;
+        vertex.vid = folly::to<std::string>(i);
+        row.values.emplace_back(std::move(vertex));
+        if (i % 2 == 0) {
+            row.values.emplace_back(static_cast<int64_t>(i));
+        } else {
+            row.values.emplace_back(Value(NullType::BAD_TYPE));
+        }
+        row.values.emplace_back(Value::kNullValue);
+        ds.emplace_back(std::move(row));
+    }
+    return ds;
+}
+
+}   // namespace
+
+TEST(ColumnarEncoder, RoundTrip) {
+    for (auto codec : {ColumnarEncoder::Codec::kNone,
+                       ColumnarEncoder::Codec::kLZ4,
+                       ColumnarEncoder::Codec::kZSTD}) {
+        for (size_t numRows : {0UL, 1UL, 9UL, 1000UL}) {
+            auto ds = makeDataSet(numRows);
+            auto result = ColumnarEncoder::decode(ColumnarEncoder::encode(ds, codec));
+            ASSERT_TRUE(result.ok()) << result.status();
+            EXPECT_EQ(ds, result.value());
+        }
+    }
+}
+
+TEST(ColumnarEncoder, Dictionary) {
+    DataSet ds({"src", "dst"});
+    for (size_t i = 0; i < 1000; ++i) {
+        ds.emplace_back(Row({Value("a_long_vertex_id_repeated_in_each_row"),
+                             Value(folly::to<std::string>(i % 10))}));
+    }
+    // The repeated strings are only encoded once
+    auto data = ColumnarEncoder::encode(ds, ColumnarEncoder::Codec::kNone);
+    EXPECT_LT(data.size(), 2 * ds.rows.size() + 100);
+}
+
+TEST(ColumnarEncoder, Codec) {
+    EXPECT_EQ(ColumnarEncoder::Codec::kLZ4, ColumnarEncoder::toCodec("lz4").value());
+    EXPECT_EQ(ColumnarEncoder::Codec::kZSTD, ColumnarEncoder::toCodec("ZSTD").value());
+    EXPECT_EQ(ColumnarEncoder::Codec::kNone, ColumnarEncoder::toCodec("None").value());
+    EXPECT_FALSE(ColumnarEncoder::toCodec("gzip").ok());
+}
+
+TEST(ColumnarEncoder, Corrupted) {
+    auto data = ColumnarEncoder::encode(makeDataSet(10), ColumnarEncoder::Codec::kNone);
+    EXPECT_FALSE(ColumnarEncoder::decode("").ok());
+    EXPECT_FALSE(ColumnarEncoder::decode("rows").ok());
+    for (size_t size : {4UL, 6UL, data.size() / 2, data.size() - 1}) {
+        EXPECT_FALSE(ColumnarEncoder::decode(folly::StringPiece(data.data(), size)).ok());
+    }
+    EXPECT_FALSE(ColumnarEncoder::decode(data + "x").ok());
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,84 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "util/GraphMetrics.h"
+#include "util/Metrics.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(MetricsTest, Counter) {
+    Counter counter;
+    counter.add();
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 4; ++i) {
+        threads.emplace_back([&counter]() {
+            for (auto j = 0; j < 1000; ++j) {
+                counter.add(2);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    // The cells of the exited threads are kept
+    ASSERT_EQ(8001, counter.value());
+}
+
+TEST(MetricsTest, Histogram) {
+    Histogram histogram({10, 100, 1000});
+    histogram.add(5);
+    histogram.add(10);
+    std::thread([&histogram]() {
+        histogram.add(50);
+        histogram.add(5000);
+    }).join();
+
+    auto snapshot = histogram.snapshot();
+    ASSERT_EQ(std::vector<uint64_t>({2, 1, 0, 1}), snapshot.counts);
+    ASSERT_EQ(4, snapshot.count);
+    ASSERT_EQ(5065, snapshot.sum);
+
+    ASSERT_EQ(std::vector<int64_t>({50, 100, 200, 400}),
+              Histogram::exponentialBounds(50, 500, 2));
+}
+
+TEST(MetricsTest, Prometheus) {
+    auto &registry = MetricsRegistry::instance();
+    registry.counter("test_counter_total", "A counter")->add(3);
+    registry.counterFamily("test_errors_total", "Errors", "code")->get("E_SYNTAX_ERROR")->add();
+    registry.histogramFamily("test_latency_us", "Latency", "kind", {10, 100})
+        ->get("GO")
+        ->add(20);
+    registry.addCallback("test_gauge", "A gauge", "gauge", []() { return 7; });
+
+    auto text = registry.toPrometheus();
+    EXPECT_NE(std::string::npos, text.find("# TYPE test_counter_total counter\n"));
+    EXPECT_NE(std::string::npos, text.find("test_counter_total 3\n"));
+    EXPECT_NE(std::string::npos, text.find("test_errors_total{code=\"E_SYNTAX_ERROR\"} 1\n"));
+    EXPECT_NE(std::string::npos, text.find("# TYPE test_latency_us histogram\n"));
+    EXPECT_NE(std::string::npos, text.find("test_latency_us_bucket{kind=\"GO\",le=\"10\"} 0\n"));
+    EXPECT_NE(std::string::npos, text.find("test_latency_us_bucket{kind=\"GO\",le=\"100\"} 1\n"));
+    EXPECT_NE(std::string::npos, text.find("test_latency_us_bucket{kind=\"GO\",le=\"+Inf\"} 1\n"));
+    EXPECT_NE(std::string::npos, text.find("test_latency_us_sum{kind=\"GO\"} 20\n"));
+    EXPECT_NE(std::string::npos, text.find("test_latency_us_count{kind=\"GO\"} 1\n"));
+    EXPECT_NE(std::string::npos, text.find("# TYPE test_gauge gauge\ntest_gauge 7\n"));
+
+    registry.removeCallback("test_gauge");
+    ASSERT_EQ(std::string::npos, registry.toPrometheus().find("test_gauge"));
+}
+
+TEST(MetricsTest, StatementKind) {
+    ASSERT_EQ("GO", GraphMetrics::statementKind("go from \"1\" over e"));
+    ASSERT_EQ("FETCH", GraphMetrics::statementKind("  /*+ TIMEOUT(10) */ FETCH PROP ON t \"1\""));
+    ASSERT_EQ("ASSIGNMENT", GraphMetrics::statementKind("$a = GO FROM \"1\" OVER e"));
+    ASSERT_EQ("OTHER", GraphMetrics::statementKind(""));
+}
+
+}   // namespace graph
+}   // namespace nebula
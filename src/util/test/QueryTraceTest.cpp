@@ -0,0 +1,76 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include <folly/executors/InlineExecutor.h>
+
+#include "common/base/Base.h"
+#include "util/QueryTrace.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(QueryTrace, ChromeTrace) {
+    auto trace = std::make_shared<QueryTrace>();
+    auto begin = trace->now();
+    trace->addSpan("parse", "query", begin, begin + 10);
+    trace->addSpanOn("Project 1", "execute", "executor", begin + 10, begin + 30, {{"k", "v"}});
+    trace->addSpanOn("Project 1", "close", "executor", begin + 30, begin + 31);
+    trace->addSpanOn("storage 127.0.0.1:44500", "GetNeighbors", "storage", begin, begin + 5);
+    ASSERT_EQ(4, trace->numEvents());
+
+    auto json = trace->toJson();
+    auto &events = json["traceEvents"];
+    // The spans and the names of one thread and two lanes
+    ASSERT_EQ(4 + 3, events.size());
+
+    auto &parse = events[0];
+    EXPECT_EQ("parse", parse["name"].asString());
+    EXPECT_EQ("query", parse["cat"].asString());
+    EXPECT_EQ("X", parse["ph"].asString());
+    EXPECT_EQ(begin, parse["ts"].asInt());
+    EXPECT_EQ(10, parse["dur"].asInt());
+    EXPECT_EQ(static_cast<int64_t>(QueryTrace::currentThread()), parse["tid"].asInt());
+
+    // The spans of the same lane are on the same virtual thread
+    auto &execute = events[1];
+    auto &close = events[2];
+    EXPECT_EQ(execute["tid"], close["tid"]);
+    EXPECT_NE(execute["tid"], events[3]["tid"]);
+    EXPECT_NE(parse["tid"], execute["tid"]);
+    EXPECT_EQ("v", execute["args"]["k"].asString());
+    EXPECT_EQ(folly::to<std::string>(QueryTrace::currentThread()),
+              execute["args"]["tid"].asString());
+
+    std::unordered_map<int64_t, std::string> names;
+    for (size_t i = 4; i < events.size(); ++i) {
+        EXPECT_EQ("M", events[i]["ph"].asString());
+        names.emplace(events[i]["tid"].asInt(), events[i]["args"]["name"].asString());
+    }
+    EXPECT_EQ("Project 1", names[execute["tid"].asInt()]);
+    EXPECT_EQ("storage 127.0.0.1:44500", names[events[3]["tid"].asInt()]);
+}
+
+TEST(QueryTrace, Runner) {
+    auto trace = std::make_shared<QueryTrace>();
+    EXPECT_EQ(nullptr, trace->wrap(nullptr));
+    auto *runner = trace->wrap(&folly::InlineExecutor::instance());
+    EXPECT_EQ(runner, trace->wrap(&folly::InlineExecutor::instance()));
+
+    bool ran = false;
+    runner->add([&ran]() { ran = true; });
+    ASSERT_TRUE(ran);
+    ASSERT_EQ(1, trace->numEvents());
+    auto json = trace->toJson();
+    auto &task = json["traceEvents"][0];
+    EXPECT_EQ("task", task["name"].asString());
+    EXPECT_EQ(folly::to<std::string>(QueryTrace::currentThread()),
+              task["args"]["from_tid"].asString());
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,71 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "util/ShardedLruCache.h"
+
+#include <gtest/gtest.h>
+
+namespace nebula {
+
+TEST(ShardedLruCacheTest, PutAndGet) {
+    ShardedLruCache<std::string, int> cache(100);
+    EXPECT_FALSE(cache.get("a").hasValue());
+    cache.put("a", 1);
+    cache.put("b", 2);
+    EXPECT_EQ(1, *cache.get("a"));
+    EXPECT_EQ(2, *cache.get("b"));
+
+    cache.put("a", 3);
+    EXPECT_EQ(3, *cache.get("a"));
+    EXPECT_EQ(2, cache.size());
+
+    EXPECT_TRUE(cache.erase("a"));
+    EXPECT_FALSE(cache.erase("a"));
+    EXPECT_FALSE(cache.get("a").hasValue());
+
+    cache.clear();
+    EXPECT_EQ(0, cache.size());
+}
+
+TEST(ShardedLruCacheTest, Evict) {
+    ShardedLruCache<int, int> cache(2, 1);
+    cache.put(1, 1);
+    cache.put(2, 2);
+    // Touch 1 so that 2 is the least recently used one
+    EXPECT_TRUE(cache.get(1).hasValue());
+    cache.put(3, 3);
+    EXPECT_EQ(2, cache.size());
+    EXPECT_TRUE(cache.get(1).hasValue());
+    EXPECT_FALSE(cache.get(2).hasValue());
+    EXPECT_TRUE(cache.get(3).hasValue());
+}
+
+TEST(ShardedLruCacheTest, FillAfterInvalidate) {
+    ShardedLruCache<std::string, int> cache(100);
+    auto increase = [](folly::Optional<int> &value) { value = value.value_or(0) + 1; };
+    EXPECT_TRUE(cache.fill("a", cache.epoch(), increase));
+    EXPECT_EQ(1, *cache.get("a"));
+
+    // The read started before the invalidation must not be filled back
+    auto epoch = cache.epoch();
+    cache.invalidate("a");
+    EXPECT_FALSE(cache.get("a").hasValue());
+    EXPECT_FALSE(cache.fill("a", epoch, increase));
+    EXPECT_FALSE(cache.get("a").hasValue());
+
+    // The one started after is filled
+    EXPECT_TRUE(cache.fill("a", cache.epoch(), increase));
+    EXPECT_EQ(1, *cache.get("a"));
+
+    // Invalidate by modifying the value in place
+    epoch = cache.epoch();
+    cache.invalidate("a", [](folly::Optional<int> &value) { *value += 10; });
+    EXPECT_EQ(11, *cache.get("a"));
+    EXPECT_FALSE(cache.fill("a", epoch, increase));
+    EXPECT_EQ(11, *cache.get("a"));
+}
+
+}   // namespace nebula
@@ -21,5 +21,40 @@ Status AdminJobValidator::toPlan() {
     return Status::OK();
 }
 
+Status DownloadValidator::validateImpl() {
+    auto *sentence = static_cast<DownloadSentence*>(sentence_);
+    if (sentence->host() == nullptr || sentence->path() == nullptr || sentence->port() <= 0) {
+        return Status::SemanticError("Invalid HDFS url, it should be like "
+                                     "`hdfs://host:port/path'");
+    }
+    return Status::OK();
+}
+
+Status DownloadValidator::toPlan() {
+    auto *sentence = static_cast<DownloadSentence*>(sentence_);
+    // The meta DOWNLOAD job takes the HDFS url and the space to download into, and parses
+    // the url by itself. The leading command name is only for SubmitJobExecutor.
+    auto url = folly::stringPrintf("hdfs://%s:%d%s",
+                                   sentence->host()->c_str(),
+                                   sentence->port(),
+                                   sentence->path()->c_str());
+    std::vector<std::string> params = {"download", std::move(url), vctx_->whichSpace().name};
+    root_ = SubmitJob::make(qctx_, nullptr, meta::cpp2::AdminJobOp::ADD, params);
+    tail_ = root_;
+    return Status::OK();
+}
+
+Status IngestValidator::validateImpl() {
+    return Status::OK();
+}
+
+Status IngestValidator::toPlan() {
+    // The meta INGEST job only takes the space to ingest the downloaded files into
+    std::vector<std::string> params = {"ingest", vctx_->whichSpace().name};
+    root_ = SubmitJob::make(qctx_, nullptr, meta::cpp2::AdminJobOp::ADD, params);
+    tail_ = root_;
+    return Status::OK();
+}
+
 }  // namespace graph
 }  // namespace nebula
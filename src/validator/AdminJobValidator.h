@@ -10,6 +10,7 @@
 #include "common/base/Base.h"
 #include "validator/Validator.h"
 #include "parser/AdminSentences.h"
+#include "parser/MutateSentences.h"
 
 namespace nebula {
 namespace graph {
@@ -33,6 +34,30 @@ private:
     AdminJobSentence               *sentence_{nullptr};
 };
 
+// DOWNLOAD and INGEST are submitted as the jobs of the current space,
+// so that their progress is shown by SHOW JOB like the other jobs
+class DownloadValidator final : public Validator {
+public:
+    DownloadValidator(Sentence* sentence, QueryContext* context)
+            : Validator(sentence, context) {}
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
+class IngestValidator final : public Validator {
+public:
+    IngestValidator(Sentence* sentence, QueryContext* context)
+            : Validator(sentence, context) {}
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
 }  // namespace graph
 }  // namespace nebula
 
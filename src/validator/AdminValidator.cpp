@@ -246,6 +246,51 @@ Status ShowCollationValidator::toPlan() {
     return Status::OK();
 }
 
+Status ShowQueriesValidator::validateImpl() {
+    return Status::OK();
+}
+
+Status ShowQueriesValidator::toPlan() {
+    auto *node = ShowQueries::make(qctx_, nullptr);
+    root_ = node;
+    tail_ = root_;
+    return Status::OK();
+}
+
+Status KillQueryValidator::validateImpl() {
+    return Status::OK();
+}
+
+Status KillQueryValidator::toPlan() {
+    auto sentence = static_cast<KillQuerySentence*>(sentence_);
+    auto *node = KillQuery::make(qctx_, nullptr, sentence->queryId());
+    root_ = node;
+    tail_ = root_;
+    return Status::OK();
+}
+
+Status ShowQueryStatsValidator::validateImpl() {
+    return Status::OK();
+}
+
+Status ShowQueryStatsValidator::toPlan() {
+    auto *node = ShowQueryStats::make(qctx_, nullptr);
+    root_ = node;
+    tail_ = root_;
+    return Status::OK();
+}
+
+Status ResetQueryStatsValidator::validateImpl() {
+    return Status::OK();
+}
+
+Status ResetQueryStatsValidator::toPlan() {
+    auto *node = ResetQueryStats::make(qctx_, nullptr);
+    root_ = node;
+    tail_ = root_;
+    return Status::OK();
+}
+
 Status ShowConfigsValidator::validateImpl() {
     return Status::OK();
 }
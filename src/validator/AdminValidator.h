@@ -174,6 +174,58 @@ private:
     Status toPlan() override;
 };
 
+class ShowQueriesValidator final : public Validator {
+public:
+    ShowQueriesValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
+class KillQueryValidator final : public Validator {
+public:
+    KillQueryValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
+class ShowQueryStatsValidator final : public Validator {
+public:
+    ShowQueryStatsValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
+class ResetQueryStatsValidator final : public Validator {
+public:
+    ResetQueryStatsValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
 class ShowConfigsValidator final : public Validator {
 public:
     ShowConfigsValidator(Sentence* sentence, QueryContext* context)
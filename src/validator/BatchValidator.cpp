@@ -0,0 +1,38 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "validator/BatchValidator.h"
+
+#include "planner/Admin.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+Status BatchValidator::validateImpl() {
+    auto* sentence = static_cast<BatchSentence*>(sentence_);
+    if (sentence->queries().size() > static_cast<size_t>(FLAGS_max_batch_queries)) {
+        return Status::SemanticError("Too many queries in a batch, the max is %d.",
+                                     FLAGS_max_batch_queries);
+    }
+    outputs_ = {{"Query", Value::Type::STRING},
+                {"ErrorCode", Value::Type::STRING},
+                {"ErrorMsg", Value::Type::STRING},
+                {"Data", Value::Type::DATASET}};
+    return Status::OK();
+}
+
+Status BatchValidator::toPlan() {
+    auto* sentence = static_cast<BatchSentence*>(sentence_);
+    auto* batch = Batch::make(qctx_, nullptr, sentence->queries());
+    batch->setColNames({"Query", "ErrorCode", "ErrorMsg", "Data"});
+    root_ = batch;
+    tail_ = root_;
+    return Status::OK();
+}
+
+}   // namespace graph
+}   // namespace nebula
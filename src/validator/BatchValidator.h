@@ -0,0 +1,35 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef VALIDATOR_BATCHVALIDATOR_H_
+#define VALIDATOR_BATCHVALIDATOR_H_
+
+#include "common/base/Base.h"
+#include "parser/ProcessControlSentences.h"
+#include "validator/Validator.h"
+
+namespace nebula {
+namespace graph {
+
+// The queries of a batch are parsed and validated when each of them runs,
+// so that one invalid query only fails itself.
+class BatchValidator final : public Validator {
+public:
+    BatchValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // VALIDATOR_BATCHVALIDATOR_H_
@@ -0,0 +1,63 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "validator/CursorValidator.h"
+
+#include "parser/CursorSentences.h"
+#include "planner/Query.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+Status DeclareCursorValidator::validateImpl() {
+    auto* sentence = static_cast<DeclareCursorSentence*>(sentence_);
+    validator_ = makeValidator(sentence->sentence(), qctx_);
+    NG_RETURN_IF_ERROR(validator_->validate());
+    outputs_ = validator_->outputCols();
+    return Status::OK();
+}
+
+Status DeclareCursorValidator::toPlan() {
+    auto* sentence = static_cast<DeclareCursorSentence*>(sentence_);
+    auto* input = validator_->root();
+    auto* node = DeclareCursor::make(qctx_, input, *sentence->name(), FLAGS_cursor_fetch_size);
+    node->setInputVar(input->varName());
+    node->setColNames(input->colNames());
+    root_ = node;
+    tail_ = validator_->tail();
+    return Status::OK();
+}
+
+Status FetchCursorValidator::validateImpl() {
+    auto* sentence = static_cast<FetchCursorSentence*>(sentence_);
+    if (sentence->count() == 0) {
+        return Status::SemanticError("The count of rows to fetch should be positive.");
+    }
+    return Status::OK();
+}
+
+Status FetchCursorValidator::toPlan() {
+    auto* sentence = static_cast<FetchCursorSentence*>(sentence_);
+    auto count = sentence->count() > 0 ? sentence->count() : FLAGS_cursor_fetch_size;
+    root_ = FetchCursor::make(qctx_, nullptr, *sentence->name(), count);
+    tail_ = root_;
+    return Status::OK();
+}
+
+Status CloseCursorValidator::validateImpl() {
+    return Status::OK();
+}
+
+Status CloseCursorValidator::toPlan() {
+    auto* sentence = static_cast<CloseCursorSentence*>(sentence_);
+    root_ = CloseCursor::make(qctx_, nullptr, *sentence->name());
+    tail_ = root_;
+    return Status::OK();
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,61 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef VALIDATOR_CURSORVALIDATOR_H_
+#define VALIDATOR_CURSORVALIDATOR_H_
+
+#include "common/base/Base.h"
+#include "validator/Validator.h"
+
+namespace nebula {
+namespace graph {
+
+class DeclareCursorValidator final : public Validator {
+public:
+    DeclareCursorValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+
+private:
+    std::unique_ptr<Validator>  validator_;
+};
+
+class FetchCursorValidator final : public Validator {
+public:
+    FetchCursorValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
+class CloseCursorValidator final : public Validator {
+public:
+    CloseCursorValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // VALIDATOR_CURSORVALIDATOR_H_
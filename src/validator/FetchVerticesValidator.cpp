@@ -4,6 +4,7 @@
  * attached with Common Clause Condition 1.0, found in the LICENSES directory.
  */
 #include "validator/FetchVerticesValidator.h"
+#include "common/expression/VariableExpression.h"
 #include "planner/Query.h"
 #include "util/ExpressionUtils.h"
 #include "util/SchemaUtil.h"
@@ -96,6 +97,14 @@ Status FetchVerticesValidator::prepareVertices() {
     auto vids = sentence->vidList();
     srcVids_.rows.reserve(vids.size());
     for (const auto vid : vids) {
+        if (vid->kind() == Expression::Kind::kVar) {
+            auto *var = static_cast<const VariableExpression *>(vid);
+            NG_RETURN_IF_ERROR(checkParameter(*var->var()));
+            // A placeholder until the parameter is bound on execution
+            params_.emplace_back(srcVids_.rows.size(), *var->var());
+            srcVids_.emplace_back(nebula::Row({""}));
+            continue;
+        }
         DCHECK(ExpressionUtils::isConstExpr(vid));
         auto v = vid->eval(dummy);
         if (!v.isStr()) {   // string as vid
@@ -251,6 +260,9 @@ const Expression *FetchVerticesValidator::findInvalidYieldExpression(const Expre
 std::string FetchVerticesValidator::buildConstantInput() {
     auto input = vctx_->anonVarGen()->getVar();
     qctx_->ectx()->setResult(input, ResultBuilder().value(Value(std::move(srcVids_))).finish());
+    for (auto &param : params_) {
+        vctx_->addParameterSlot(input, param.first, param.second);
+    }
 
     src_ = qctx_->objPool()->makeAndAdd<VariablePropertyExpression>(new std::string(input),
                                                                     new std::string(kVid));
@@ -42,6 +42,8 @@ private:
 private:
     GraphSpaceID spaceId_{0};
     DataSet srcVids_{{kVid}};  // src from constant
+    // The rows of srcVids_ bound to the parameters
+    std::vector<std::pair<size_t, std::string>> params_;
     Expression* srcRef_{nullptr};  // src from runtime
     Expression* src_{nullptr};  // src in total
     std::string tagName_;
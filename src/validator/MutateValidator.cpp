@@ -8,6 +8,7 @@
 #include "common/expression/LabelAttributeExpression.h"
 #include "planner/Mutate.h"
 #include "planner/Query.h"
+#include "util/ExpressionUtils.h"
 #include "util/SchemaUtil.h"
 
 namespace nebula {
@@ -605,9 +606,48 @@ Status UpdateValidator::getUpdateProps() {
 }
 
 
+Status UpdateValidator::checkInputProps(const Expression* expr) const {
+    auto refs = ExpressionUtils::collectAll(
+        expr, {Expression::Kind::kInputProperty, Expression::Kind::kVarProperty});
+    for (auto* ref : refs) {
+        auto* propExpr = static_cast<const PropertyExpression*>(ref);
+        const auto& prop = *propExpr->prop();
+        auto hasProp = [&prop](const ColsDef& cols) {
+            return std::any_of(cols.cbegin(), cols.cend(), [&prop](const ColDef& col) {
+                return col.first == prop;
+            });
+        };
+        if (ref->kind() == Expression::Kind::kInputProperty) {
+            if (!inputVar_.empty()) {
+                return Status::SemanticError("Not support both input and variable.");
+            }
+            if (!hasProp(inputs_)) {
+                return Status::SemanticError("No input property `%s'", prop.c_str());
+            }
+            continue;
+        }
+        const auto& varName = *propExpr->sym();
+        if (inputVar_.empty()) {
+            return Status::SemanticError("Not support both input and variable.");
+        }
+        if (varName != inputVar_) {
+            return Status::SemanticError("Only one variable allowed to use.");
+        }
+        if (!hasProp(vctx_->getVar(varName))) {
+            return Status::SemanticError(
+                "No property `%s' in variable `%s'", prop.c_str(), varName.c_str());
+        }
+    }
+    return Status::OK();
+}
+
 Status UpdateValidator::checkAndResetSymExpr(Expression* inExpr,
                                              const std::string& symName,
                                              std::string &encodeStr) {
+    if (isRef_) {
+        // Replaced by the values of each row of the input when executed
+        NG_RETURN_IF_ERROR(checkInputProps(inExpr));
+    }
     bool hasWrongType = false;
     auto symExpr = rewriteSymExpr(inExpr, symName, hasWrongType, isEdge_);
     if (hasWrongType) {
@@ -732,10 +772,15 @@ std::unique_ptr<Expression> UpdateValidator::rewriteSymExpr(Expression* expr,
         case Expression::Kind::kEdgeDst:
         case Expression::Kind::kEdgeType:
         case Expression::Kind::kUUID:
+        case Expression::Kind::kVarProperty:
+        case Expression::Kind::kInputProperty: {
+            if (!isRef_) {
+                hasWrongType = true;
+            }
+            break;
+        }
         case Expression::Kind::kVar:
         case Expression::Kind::kVersionedVar:
-        case Expression::Kind::kVarProperty:
-        case Expression::Kind::kInputProperty:
         case Expression::Kind::kUnaryIncr:
         case Expression::Kind::kUnaryDecr:
         case Expression::Kind::kList:   // FIXME(dutor)
@@ -753,12 +798,20 @@ std::unique_ptr<Expression> UpdateValidator::rewriteSymExpr(Expression* expr,
 
 Status UpdateVertexValidator::validateImpl() {
     auto sentence = static_cast<UpdateVertexSentence*>(sentence_);
-    auto idRet = SchemaUtil::toVertexID(sentence->getVid());
-    if (!idRet.ok()) {
-        LOG(ERROR) << idRet.status();
-        return idRet.status();
+    if (sentence->isRef()) {
+        isRef_ = true;
+        vidRef_ = sentence->getVid();
+        auto varRet = checkRef(vidRef_, Value::Type::STRING);
+        NG_RETURN_IF_ERROR(varRet);
+        inputVar_ = std::move(varRet).value();
+    } else {
+        auto idRet = SchemaUtil::toVertexID(sentence->getVid());
+        if (!idRet.ok()) {
+            LOG(ERROR) << idRet.status();
+            return idRet.status();
+        }
+        vId_ = std::move(idRet).value();
     }
-    vId_ = std::move(idRet).value();
     NG_RETURN_IF_ERROR(initProps());
     auto ret = qctx_->schemaMng()->toTagID(spaceId_, name_);
     if (!ret.ok()) {
@@ -781,6 +834,10 @@ Status UpdateVertexValidator::toPlan() {
                                       std::move(returnProps_),
                                       std::move(condition_),
                                       std::move(yieldColNames_));
+    if (vidRef_ != nullptr) {
+        update->setVidRef(vidRef_);
+        update->setInputVar(inputVar_.empty() ? inputVarName_ : inputVar_);
+    }
     root_ = update;
     tail_ = root_;
     return Status::OK();
@@ -788,19 +845,23 @@ Status UpdateVertexValidator::toPlan() {
 
 Status UpdateEdgeValidator::validateImpl() {
     auto sentence = static_cast<UpdateEdgeSentence*>(sentence_);
-    auto srcIdRet = SchemaUtil::toVertexID(sentence->getSrcId());
-    if (!srcIdRet.ok()) {
-        LOG(ERROR) << srcIdRet.status();
-        return srcIdRet.status();
-    }
-    srcId_ = std::move(srcIdRet).value();
-    auto dstIdRet = SchemaUtil::toVertexID(sentence->getDstId());
-    if (!dstIdRet.ok()) {
-        LOG(ERROR) << dstIdRet.status();
-        return dstIdRet.status();
-    }
-    dstId_ = std::move(dstIdRet).value();
-    rank_ = sentence->getRank();
+    if (sentence->isRef()) {
+        NG_RETURN_IF_ERROR(checkEdgeKeyRef(sentence->edgeKeyRef()));
+    } else {
+        auto srcIdRet = SchemaUtil::toVertexID(sentence->getSrcId());
+        if (!srcIdRet.ok()) {
+            LOG(ERROR) << srcIdRet.status();
+            return srcIdRet.status();
+        }
+        srcId_ = std::move(srcIdRet).value();
+        auto dstIdRet = SchemaUtil::toVertexID(sentence->getDstId());
+        if (!dstIdRet.ok()) {
+            LOG(ERROR) << dstIdRet.status();
+            return dstIdRet.status();
+        }
+        dstId_ = std::move(dstIdRet).value();
+        rank_ = sentence->getRank();
+    }
     NG_RETURN_IF_ERROR(initProps());
     auto ret = qctx_->schemaMng()->toEdgeType(spaceId_, name_);
     if (!ret.ok()) {
@@ -811,6 +872,28 @@ Status UpdateEdgeValidator::validateImpl() {
     return Status::OK();
 }
 
+Status UpdateEdgeValidator::checkEdgeKeyRef(EdgeKeyRef* edgeKeyRef) {
+    isRef_ = true;
+    edgeKeyRef_ = edgeKeyRef;
+    auto srcRet = checkRef(edgeKeyRef->srcid(), Value::Type::STRING);
+    NG_RETURN_IF_ERROR(srcRet);
+    auto dstRet = checkRef(edgeKeyRef->dstid(), Value::Type::STRING);
+    NG_RETURN_IF_ERROR(dstRet);
+    inputVar_ = std::move(srcRet).value();
+    if (dstRet.value() != inputVar_) {
+        return Status::SemanticError("Only one variable allowed to use.");
+    }
+    // The rank is 0 if not given
+    if (edgeKeyRef->rank()->kind() != Expression::Kind::kConstant) {
+        auto rankRet = checkRef(edgeKeyRef->rank(), Value::Type::INT);
+        NG_RETURN_IF_ERROR(rankRet);
+        if (rankRet.value() != inputVar_) {
+            return Status::SemanticError("Only one variable allowed to use.");
+        }
+    }
+    return Status::OK();
+}
+
 Status UpdateEdgeValidator::toPlan() {
     auto *outNode = UpdateEdge::make(qctx_,
                                      nullptr,
@@ -839,6 +922,14 @@ Status UpdateEdgeValidator::toPlan() {
                                     std::move(returnProps_),
                                     std::move(condition_),
                                     std::move(yieldColNames_));
+    if (edgeKeyRef_ != nullptr) {
+        // Both of the edges are updated for each row of the input
+        auto inputVar = inputVar_.empty() ? inputVarName_ : inputVar_;
+        outNode->setEdgeKeyRef(edgeKeyRef_);
+        outNode->setInputVar(inputVar);
+        inNode->setEdgeKeyRef(edgeKeyRef_);
+        inNode->setInputVar(std::move(inputVar));
+    }
     root_ = inNode;
     tail_ = outNode;
     return Status::OK();
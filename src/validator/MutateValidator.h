@@ -134,6 +134,9 @@ protected:
 
     Status getUpdateProps();
 
+    // Check the properties of the input or the variable referred by the piped update
+    Status checkInputProps(const Expression* expr) const;
+
 private:
     Status checkAndResetSymExpr(Expression* inExpr,
                                 const std::string& symName,
@@ -154,6 +157,10 @@ protected:
     std::vector<storage::cpp2::UpdatedProp>             updatedProps_;
     std::string                                         name_;
     bool                                                isEdge_{false};
+    // Whether the vertices or edges updated are given by the input or a variable
+    bool                                                isRef_{false};
+    // The variable referred by the piped update, empty for the input
+    std::string                                         inputVar_;
 };
 
 class UpdateVertexValidator final : public UpdateValidator {
@@ -170,6 +177,7 @@ private:
 private:
     std::string               vId_;
     TagID                     tagId_{-1};
+    Expression*               vidRef_{nullptr};
 };
 
 class UpdateEdgeValidator final : public UpdateValidator {
@@ -181,6 +189,8 @@ public:
 private:
     Status validateImpl() override;
 
+    Status checkEdgeKeyRef(EdgeKeyRef* edgeKeyRef);
+
     Status toPlan() override;
 
 private:
@@ -188,6 +198,7 @@ private:
     std::string                                       dstId_;
     EdgeRanking                                       rank_{0};
     EdgeType                                          edgeType_{-1};
+    EdgeKeyRef*                                       edgeKeyRef_{nullptr};
 };
 }  // namespace graph
 }  // namespace nebula
@@ -0,0 +1,129 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "validator/PrepareValidator.h"
+
+#include "parser/GQLParser.h"
+#include "planner/Admin.h"
+
+namespace nebula {
+namespace graph {
+
+// static
+Status PrepareValidator::checkPreparable(const Sentence* sentence) {
+    if (sentence->kind() == Sentence::Kind::kExplain) {
+        return Status::SemanticError("EXPLAIN or PROFILE could not be prepared.");
+    }
+    DCHECK(sentence->kind() == Sentence::Kind::kSequential);
+    for (auto* s : static_cast<const SequentialSentences*>(sentence)->sentences()) {
+        switch (s->kind()) {
+            case Sentence::Kind::kPrepare:
+            case Sentence::Kind::kExecute:
+            case Sentence::Kind::kDeallocate:
+            case Sentence::Kind::kBatch:
+                return Status::SemanticError("`%s' could not be prepared.",
+                                             s->toString().c_str());
+            default:
+                break;
+        }
+    }
+    return Status::OK();
+}
+
+// static
+StatusOr<std::shared_ptr<const PreparedStatement>> PrepareValidator::prepare(
+    const std::string& query,
+    QueryContext* qctx) {
+    GQLParser parser;
+    auto result = parser.parse(query);
+    NG_RETURN_IF_ERROR(result);
+    auto prepared = std::move(result).value();
+    NG_RETURN_IF_ERROR(checkPreparable(prepared.get()));
+
+    // Validated on behalf of the session, which is not owned since the context is kept
+    // with the statement in the session.
+    auto* session = qctx->rctx()->session();
+    auto rctx = std::make_unique<RequestContext<cpp2::ExecutionResponse>>();
+    rctx->setQuery(query);
+    rctx->setSession(std::shared_ptr<Session>(std::shared_ptr<Session>(), session));
+    auto pctx = std::make_unique<QueryContext>();
+    pctx->setRCtx(std::move(rctx));
+    pctx->setSchemaManager(qctx->schemaMng());
+    pctx->setStorageClient(qctx->getStorageClient());
+    pctx->setMetaClient(qctx->getMetaClient());
+    pctx->setCharsetInfo(qctx->getCharsetInfo());
+    pctx->vctx()->setParameterized(true);
+    NG_RETURN_IF_ERROR(Validator::validate(prepared.get(), pctx.get()));
+    for (auto& param : pctx->vctx()->parameters()) {
+        if (pctx->vctx()->existVar(param)) {
+            return Status::SemanticError("Parameter `$%s' is also a variable.", param.c_str());
+        }
+    }
+    pctx->setRCtx(nullptr);
+
+    SpaceDescription space{session->spaceName(), session->space()};
+    return std::make_shared<const PreparedStatement>(
+        query, std::move(space), std::move(prepared), std::move(pctx));
+}
+
+// static
+StatusOr<std::shared_ptr<const PreparedStatement>> PrepareValidator::acquire(
+    const std::string& name,
+    std::shared_ptr<const PreparedStatement> statement,
+    QueryContext* qctx) {
+    if (statement->schemaChanged(qctx->schemaMng())) {
+        auto result = prepare(statement->query(), qctx);
+        NG_RETURN_IF_ERROR(result);
+        auto prepared = std::move(result).value();
+        qctx->rctx()->session()->replacePreparedStatement(name, statement, prepared);
+        statement = std::move(prepared);
+    }
+    auto acquired = PreparedStatement::acquire(statement);
+    if (acquired == nullptr) {
+        // Being executed by another query of the session, so the plan of its own is prepared
+        auto result = prepare(statement->query(), qctx);
+        NG_RETURN_IF_ERROR(result);
+        acquired = PreparedStatement::acquire(std::move(result).value());
+    }
+    return acquired;
+}
+
+Status PrepareValidator::validateImpl() {
+    auto* sentence = static_cast<PrepareSentence*>(sentence_);
+    auto result = prepare(*sentence->query(), qctx_);
+    NG_RETURN_IF_ERROR(result);
+    statement_ = std::move(result).value();
+    return Status::OK();
+}
+
+Status PrepareValidator::toPlan() {
+    auto* sentence = static_cast<PrepareSentence*>(sentence_);
+    root_ = Prepare::make(qctx_, nullptr, *sentence->name(), std::move(statement_));
+    tail_ = root_;
+    return Status::OK();
+}
+
+Status ExecuteValidator::validateImpl() {
+    return Status::SemanticError("EXECUTE should be the only statement of the query.");
+}
+
+Status ExecuteValidator::toPlan() {
+    return Status::OK();
+}
+
+Status DeallocateValidator::validateImpl() {
+    return Status::OK();
+}
+
+Status DeallocateValidator::toPlan() {
+    auto* sentence = static_cast<DeallocateSentence*>(sentence_);
+    root_ = Deallocate::make(qctx_, nullptr, *sentence->name());
+    tail_ = root_;
+    return Status::OK();
+}
+
+}   // namespace graph
+}   // namespace nebula
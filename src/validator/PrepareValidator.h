@@ -0,0 +1,79 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef VALIDATOR_PREPAREVALIDATOR_H_
+#define VALIDATOR_PREPAREVALIDATOR_H_
+
+#include "common/base/Base.h"
+#include "context/PreparedStatement.h"
+#include "parser/ProcessControlSentences.h"
+#include "validator/Validator.h"
+
+namespace nebula {
+namespace graph {
+
+// Parse and validate the query to be prepared, in a context of its own which owns the plan
+class PrepareValidator final : public Validator {
+public:
+    PrepareValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+    // Prepare `query' for the session of `qctx', also by EXECUTE to prepare it again
+    static StatusOr<std::shared_ptr<const PreparedStatement>> prepare(const std::string& query,
+                                                                       QueryContext* qctx);
+
+    // Acquire `statement', prepared as `name' in the session of `qctx', for the execution of
+    // `qctx'. It's prepared again and replaced in the session if the schema has changed since,
+    // and prepared for the execution alone if it's being executed by another query.
+    static StatusOr<std::shared_ptr<const PreparedStatement>> acquire(
+        const std::string& name,
+        std::shared_ptr<const PreparedStatement> statement,
+        QueryContext* qctx);
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+
+    static Status checkPreparable(const Sentence* sentence);
+
+private:
+    std::shared_ptr<const PreparedStatement>    statement_;
+};
+
+// EXECUTE runs without validation, which is only reached when it's not the only statement
+class ExecuteValidator final : public Validator {
+public:
+    ExecuteValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
+class DeallocateValidator final : public Validator {
+public:
+    DeallocateValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // VALIDATOR_PREPAREVALIDATOR_H_
@@ -44,6 +44,15 @@ Status TraversalValidator::validateStarts(const VerticesClause* clause, Starts&
         auto vidList = clause->vidList();
         QueryExpressionContext ctx;
         for (auto* expr : vidList) {
+            if (expr->kind() == Expression::Kind::kVar) {
+                auto* var = static_cast<VariableExpression*>(expr);
+                NG_RETURN_IF_ERROR(checkParameter(*var->var()));
+                // A placeholder until the parameter is bound on execution
+                starts.params.emplace_back(starts.vids.size(), *var->var());
+                starts.vids.emplace_back("");
+                startVidList_->add(expr->clone().release());
+                continue;
+            }
             if (!evaluableExpr(expr)) {
                 return Status::Error("`%s' is not an evaluable expression.",
                         expr->toString().c_str());
@@ -171,6 +180,9 @@ std::string TraversalValidator::buildConstantInput() {
         ds.rows.emplace_back(std::move(row));
     }
     qctx_->ectx()->setResult(input, ResultBuilder().value(Value(std::move(ds))).finish());
+    for (auto& param : from_.params) {
+        vctx_->addParameterSlot(input, param.first, param.second);
+    }
 
     auto* vids = new VariablePropertyExpression(new std::string(input),
                                                 new std::string(kVid));
@@ -29,6 +29,8 @@ protected:
         std::string             userDefinedVarName;
         std::string             firstBeginningSrcVidColName;
         std::vector<Value>      vids;
+        // The rows of the vids bound to the parameters
+        std::vector<std::pair<size_t, std::string>>     params;
     };
 
     struct Over {
@@ -16,6 +16,8 @@
 #include "validator/AdminValidator.h"
 #include "validator/AssignmentValidator.h"
 #include "validator/BalanceValidator.h"
+#include "validator/BatchValidator.h"
+#include "validator/CursorValidator.h"
 #include "validator/ExplainValidator.h"
 #include "validator/FetchEdgesValidator.h"
 #include "validator/FetchVerticesValidator.h"
@@ -28,6 +30,7 @@
 #include "validator/MutateValidator.h"
 #include "validator/OrderByValidator.h"
 #include "validator/PipeValidator.h"
+#include "validator/PrepareValidator.h"
 #include "validator/ReportError.h"
 #include "validator/SequentialValidator.h"
 #include "validator/SetValidator.h"
@@ -130,6 +133,10 @@ std::unique_ptr<Validator> Validator::makeValidator(Sentence* sentence, QueryCon
             return std::make_unique<BalanceValidator>(sentence, context);
         case Sentence::Kind::kAdminJob:
             return std::make_unique<AdminJobValidator>(sentence, context);
+        case Sentence::Kind::kDownload:
+            return std::make_unique<DownloadValidator>(sentence, context);
+        case Sentence::Kind::kIngest:
+            return std::make_unique<IngestValidator>(sentence, context);
         case Sentence::Kind::kFetchVertices:
             return std::make_unique<FetchVerticesValidator>(sentence, context);
         case Sentence::Kind::kFetchEdges:
@@ -164,6 +171,28 @@ std::unique_ptr<Validator> Validator::makeValidator(Sentence* sentence, QueryCon
             return std::make_unique<ShowConfigsValidator>(sentence, context);
         case Sentence::Kind::kFindPath:
             return std::make_unique<FindPathValidator>(sentence, context);
+        case Sentence::Kind::kShowQueries:
+            return std::make_unique<ShowQueriesValidator>(sentence, context);
+        case Sentence::Kind::kKillQuery:
+            return std::make_unique<KillQueryValidator>(sentence, context);
+        case Sentence::Kind::kShowQueryStats:
+            return std::make_unique<ShowQueryStatsValidator>(sentence, context);
+        case Sentence::Kind::kResetQueryStats:
+            return std::make_unique<ResetQueryStatsValidator>(sentence, context);
+        case Sentence::Kind::kPrepare:
+            return std::make_unique<PrepareValidator>(sentence, context);
+        case Sentence::Kind::kExecute:
+            return std::make_unique<ExecuteValidator>(sentence, context);
+        case Sentence::Kind::kDeallocate:
+            return std::make_unique<DeallocateValidator>(sentence, context);
+        case Sentence::Kind::kBatch:
+            return std::make_unique<BatchValidator>(sentence, context);
+        case Sentence::Kind::kDeclareCursor:
+            return std::make_unique<DeclareCursorValidator>(sentence, context);
+        case Sentence::Kind::kFetchCursor:
+            return std::make_unique<FetchCursorValidator>(sentence, context);
+        case Sentence::Kind::kCloseCursor:
+            return std::make_unique<CloseCursorValidator>(sentence, context);
         case Sentence::Kind::kMatch:
         case Sentence::Kind::kUnknown:
         case Sentence::Kind::kCreateTagIndex:
@@ -181,8 +210,6 @@ std::unique_ptr<Validator> Validator::makeValidator(Sentence* sentence, QueryCon
         case Sentence::Kind::kRebuildEdgeIndex:
         case Sentence::Kind::kDropEdgeIndex:
         case Sentence::Kind::kLookup:
-        case Sentence::Kind::kDownload:
-        case Sentence::Kind::kIngest:
         case Sentence::Kind::kReturn: {
             // nothing
             DLOG(FATAL) << "Unimplemented sentence " << kind;
@@ -305,6 +332,15 @@ bool Validator::evaluableExpr(const Expression* expr) const {
     return visitor.ok();
 }
 
+Status Validator::checkParameter(const std::string& name) {
+    if (!vctx_->parameterized()) {
+        return Status::SemanticError("`$%s', parameters are only allowed in prepared statements.",
+                                     name.c_str());
+    }
+    vctx_->addParameter(name);
+    return Status::OK();
+}
+
 // static
 Status Validator::checkPropNonexistOrDuplicate(const ColsDef& cols,
                                                folly::StringPiece prop,
@@ -89,6 +89,9 @@ protected:
 
     bool evaluableExpr(const Expression* expr) const;
 
+    // Record the parameter `$name' of the prepared statement
+    Status checkParameter(const std::string& name);
+
     static Status checkPropNonexistOrDuplicate(const ColsDef& cols,
                                                folly::StringPiece prop,
                                                const std::string& validator);
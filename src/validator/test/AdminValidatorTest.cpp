@@ -5,6 +5,8 @@
  */
 #include "validator/test/ValidatorTestBase.h"
 
+#include "planner/Admin.h"
+
 namespace nebula {
 namespace graph {
 
@@ -43,5 +45,37 @@ TEST_F(AdminValidatorTest, ShowHosts) {
     }
 }
 
+TEST_F(AdminValidatorTest, DownloadAndIngest) {
+    {
+        std::vector<PlanNode::Kind> expected = {
+            PK::kSubmitJob, PK::kStart
+        };
+        auto query = "DOWNLOAD HDFS \"hdfs://127.0.0.1:9000/data\"";
+        ASSERT_TRUE(checkResult(query, expected));
+        auto result = validate(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        auto *submit = static_cast<const SubmitJob*>(result.value()->plan()->root());
+        ASSERT_EQ(meta::cpp2::AdminJobOp::ADD, submit->jobOp());
+        std::vector<std::string> params = {"download", "hdfs://127.0.0.1:9000/data", "test_space"};
+        ASSERT_EQ(params, submit->params());
+    }
+    {
+        std::vector<PlanNode::Kind> expected = {
+            PK::kSubmitJob, PK::kStart
+        };
+        ASSERT_TRUE(checkResult("INGEST", expected));
+        auto result = validate("INGEST");
+        ASSERT_TRUE(result.ok()) << result.status();
+        auto *submit = static_cast<const SubmitJob*>(result.value()->plan()->root());
+        ASSERT_EQ(meta::cpp2::AdminJobOp::ADD, submit->jobOp());
+        std::vector<std::string> params = {"ingest", "test_space"};
+        ASSERT_EQ(params, submit->params());
+    }
+    // Without the port
+    {
+        ASSERT_FALSE(validate("DOWNLOAD HDFS \"hdfs://127.0.0.1/data\"").ok());
+    }
+}
+
 }  // namespace graph
 }  // namespace nebula
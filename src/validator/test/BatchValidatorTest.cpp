@@ -0,0 +1,58 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+#include "validator/test/ValidatorTestBase.h"
+
+#include "planner/Admin.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+using PK = nebula::graph::PlanNode::Kind;
+class BatchValidatorTest : public ValidatorTestBase {
+};
+
+TEST_F(BatchValidatorTest, Batch) {
+    {
+        std::vector<PlanNode::Kind> expected = {
+            PK::kBatch, PK::kStart
+        };
+        auto query = "BATCH \"YIELD 1\", \"GO FROM 1 OVER like\"";
+        ASSERT_TRUE(checkResult(query, expected));
+        auto result = validate(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        auto *batch = static_cast<const Batch*>(result.value()->plan()->root());
+        std::vector<std::string> queries = {"YIELD 1", "GO FROM 1 OVER like"};
+        ASSERT_EQ(queries, batch->queries());
+        std::vector<std::string> colNames = {"Query", "ErrorCode", "ErrorMsg", "Data"};
+        ASSERT_EQ(colNames, batch->colNames());
+    }
+    // The queries are validated when each of them runs
+    {
+        std::vector<PlanNode::Kind> expected = {
+            PK::kBatch, PK::kStart
+        };
+        ASSERT_TRUE(checkResult("BATCH \"GO GO GO\"", expected));
+    }
+    // Too many queries
+    {
+        auto max = FLAGS_max_batch_queries;
+        FLAGS_max_batch_queries = 2;
+        ASSERT_TRUE(validate("BATCH \"YIELD 1\", \"YIELD 2\"").ok());
+        auto result = validate("BATCH \"YIELD 1\", \"YIELD 2\", \"YIELD 3\"");
+        FLAGS_max_batch_queries = max;
+        ASSERT_FALSE(result.ok());
+        ASSERT_EQ("SemanticError: Too many queries in a batch, the max is 2.",
+                  result.status().toString());
+    }
+    // A batch could not be prepared
+    {
+        ASSERT_FALSE(validate("PREPARE b FROM \"BATCH \\\"YIELD 1\\\"\"").ok());
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
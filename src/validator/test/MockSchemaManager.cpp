@@ -48,6 +48,12 @@ void MockSchemaManager::init() {
     edgeSchemas_.emplace(1, std::move(edgeSchemas));
 }
 
+void MockSchemaManager::createTag(GraphSpaceID space, const std::string& name, TagID tag) {
+    tagNameIds_.emplace(name, tag);
+    tagIdNames_.emplace(tag, name);
+    tagSchemas_[space].emplace(tag, std::make_shared<meta::NebulaSchemaProvider>(0));
+}
+
 std::shared_ptr<const nebula::meta::NebulaSchemaProvider>
 MockSchemaManager::getTagSchema(GraphSpaceID space,
                                  TagID tag,
@@ -78,11 +78,18 @@ public:
 
     // get all version of all edges
     StatusOr<meta::EdgeSchemas> getAllVerEdgeSchema(GraphSpaceID space) override {
-        UNUSED(space);
-        DLOG(FATAL) << "Unimplemented";
-        return Status::Error("Unimplemented");
+        meta::EdgeSchemas allVerEdgeSchemas;
+        const auto& edgeSchemas = edgeSchemas_[space];
+        for (const auto &edgeSchema : edgeSchemas) {
+            allVerEdgeSchemas.emplace(edgeSchema.first,
+                                      std::vector<std::shared_ptr<const meta::NebulaSchemaProvider>>
+                                        {edgeSchema.second});
+        }
+        return allVerEdgeSchemas;
     }
 
+    // Create a tag without any property, as CREATE TAG does
+    void createTag(GraphSpaceID space, const std::string& name, TagID tag);
 
 private:
     std::unordered_map<std::string, GraphSpaceID>        spaceNameIds_;
@@ -168,6 +168,46 @@ TEST_F(MutateValidatorTest, UpdateVertexTest) {
                    "YIELD name AS name, age AS age";
         ASSERT_TRUE(checkResult(cmd, {PK::kUpdateVertex, PK::kStart}));
     }
+    // pipe
+    {
+        auto cmd = "GO FROM \"C\" OVER like YIELD like._dst AS id, like.likeness AS likeness "
+                   "| UPDATE VERTEX ON person $-.id "
+                   "SET age = $-.likeness "
+                   "WHEN age < $-.likeness "
+                   "YIELD $-.id AS id, age AS age";
+        std::vector<PlanNode::Kind> expected = {
+            PK::kUpdateVertex,
+            PK::kProject,
+            PK::kGetNeighbors,
+            PK::kStart,
+        };
+        ASSERT_TRUE(checkResult(cmd, expected));
+    }
+    // var
+    {
+        auto cmd = "$var = GO FROM \"C\" OVER like YIELD like._dst AS id; "
+                   "UPSERT VERTEX ON person $var.id SET age = age + 1";
+        std::vector<PlanNode::Kind> expected = {
+            PK::kUpdateVertex,
+            PK::kProject,
+            PK::kGetNeighbors,
+            PK::kStart,
+        };
+        ASSERT_TRUE(checkResult(cmd, expected));
+    }
+    // pipe wrong input
+    {
+        auto cmd = "GO FROM \"C\" OVER like YIELD like._dst AS id "
+                   "| UPDATE VERTEX ON person $-.id SET age = $-.likeness";
+        ASSERT_FALSE(checkResult(cmd));
+    }
+    // both input and variable
+    {
+        auto cmd = "$var = GO FROM \"C\" OVER like YIELD like.likeness AS likeness; "
+                   "GO FROM \"C\" OVER like YIELD like._dst AS id "
+                   "| UPDATE VERTEX ON person $-.id SET age = $var.likeness";
+        ASSERT_FALSE(checkResult(cmd));
+    }
 }
 
 TEST_F(MutateValidatorTest, UpdateEdgeTest) {
@@ -200,6 +240,29 @@ TEST_F(MutateValidatorTest, UpdateEdgeTest) {
                    "YIELD start AS start, end AS end";
         ASSERT_TRUE(checkResult(cmd, {PK::kUpdateEdge, PK::kUpdateEdge, PK::kStart}));
     }
+    // pipe
+    {
+        auto cmd = "GO FROM \"C\" OVER like "
+                   "YIELD like._src AS src, like._dst AS dst, like._rank AS rank "
+                   "| UPDATE EDGE ON like $-.src -> $-.dst @ $-.rank "
+                   "SET likeness = likeness + 1 "
+                   "YIELD $-.src AS src, likeness AS likeness";
+        std::vector<PlanNode::Kind> expected = {
+            PK::kUpdateEdge,
+            PK::kUpdateEdge,
+            PK::kProject,
+            PK::kGetNeighbors,
+            PK::kStart,
+        };
+        ASSERT_TRUE(checkResult(cmd, expected));
+    }
+    // var of different names
+    {
+        auto cmd = "$a = GO FROM \"C\" OVER like YIELD like._src AS src; "
+                   "$b = GO FROM \"C\" OVER like YIELD like._dst AS dst; "
+                   "UPDATE EDGE ON like $a.src -> $b.dst SET likeness = 1";
+        ASSERT_FALSE(checkResult(cmd));
+    }
 }
 }  // namespace graph
 }  // namespace nebula
@@ -0,0 +1,139 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+#include "validator/test/ValidatorTestBase.h"
+
+#include "context/PreparedStatement.h"
+#include "planner/Admin.h"
+#include "validator/PrepareValidator.h"
+
+namespace nebula {
+namespace graph {
+
+using PK = nebula::graph::PlanNode::Kind;
+class PrepareValidatorTest : public ValidatorTestBase {
+};
+
+TEST_F(PrepareValidatorTest, PreparedStatement) {
+    // The parameters are only allowed in the prepared statements
+    {
+        ASSERT_FALSE(validate("GO FROM $p1 OVER like").ok());
+        ASSERT_FALSE(validate("FETCH PROP ON person $p1").ok());
+    }
+    {
+        ASSERT_FALSE(validate("PREPARE q1 FROM \"EXPLAIN GO FROM $p1 OVER like\"").ok());
+        ASSERT_FALSE(validate("PREPARE q1 FROM \"PREPARE q2 FROM \\\"YIELD 1\\\"\"").ok());
+        ASSERT_FALSE(validate("PREPARE q1 FROM \"GO FROM $p1 OVER like WHERE\"").ok());
+        // The parameter could not be a variable of the statement
+        ASSERT_FALSE(validate("PREPARE q1 FROM "
+                              "\"$p1 = YIELD \\\"1\\\" AS id; GO FROM $p1 OVER like\"").ok());
+    }
+    {
+        ASSERT_FALSE(validate("EXECUTE q1; YIELD 1").ok());
+    }
+    {
+        std::vector<PlanNode::Kind> expected = {
+            PK::kDeallocate, PK::kStart
+        };
+        ASSERT_TRUE(checkResult("DEALLOCATE PREPARE q1", expected));
+    }
+    {
+        std::vector<PlanNode::Kind> expected = {
+            PK::kPrepare, PK::kStart
+        };
+        auto query = "PREPARE q1 FROM \"GO FROM $p1, \\\"2\\\" OVER like\"";
+        ASSERT_TRUE(checkResult(query, expected));
+        auto result = validate(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        auto *prepare = static_cast<const Prepare*>(result.value()->plan()->root());
+        ASSERT_EQ("q1", prepare->name());
+        auto &statement = prepare->statement();
+        ASSERT_EQ(1, statement->space());
+        ASSERT_EQ(std::unordered_set<std::string>{"p1"}, statement->parameters());
+
+        // Bind the parameters for each execution
+        auto *qctx = buildContext();
+        ASSERT_FALSE(statement->bind({}, qctx).ok());
+        ASSERT_FALSE(statement->bind({{"p1", Value(1)}}, qctx).ok());
+        ASSERT_FALSE(statement->bind({{"p1", Value("1")}, {"p2", Value("2")}}, qctx).ok());
+        ASSERT_TRUE(statement->bind({{"p1", Value("1")}}, qctx).ok());
+        ASSERT_NE(nullptr, qctx->plan()->root());
+        ASSERT_EQ(Value("1"), qctx->ectx()->getValue("p1"));
+        bool bound = false;
+        for (auto &var : qctx->ectx()->variables()) {
+            auto &value = qctx->ectx()->getValue(var);
+            if (value.isDataSet() && value.getDataSet().rows.size() == 2) {
+                EXPECT_EQ(Value("1"), value.getDataSet().rows[0].values[0]);
+                EXPECT_EQ(Value("2"), value.getDataSet().rows[1].values[0]);
+                bound = true;
+            }
+        }
+        ASSERT_TRUE(bound);
+
+        // The plan is only used by one execution at a time
+        {
+            auto acquired = PreparedStatement::acquire(statement);
+            ASSERT_NE(nullptr, acquired);
+            ASSERT_EQ(nullptr, PreparedStatement::acquire(statement));
+        }
+        ASSERT_NE(nullptr, PreparedStatement::acquire(statement));
+        ASSERT_FALSE(statement->schemaChanged(qctx->schemaMng()));
+    }
+}
+
+TEST_F(PrepareValidatorTest, AcquireBusy) {
+    auto *qctx = buildContext();
+    auto result = PrepareValidator::prepare("GO FROM $p1 OVER like", qctx);
+    ASSERT_TRUE(result.ok()) << result.status();
+    auto statement = std::move(result).value();
+    ASSERT_TRUE(session_->addPreparedStatement("q1", statement).ok());
+    {
+        auto acquired = PrepareValidator::acquire("q1", statement, qctx);
+        ASSERT_TRUE(acquired.ok()) << acquired.status();
+        ASSERT_EQ(statement.get(), acquired.value().get());
+
+        // Prepared again for the other execution, the statement of the session is kept
+        auto other = PrepareValidator::acquire("q1", statement, buildContext());
+        ASSERT_TRUE(other.ok()) << other.status();
+        ASSERT_NE(nullptr, other.value());
+        ASSERT_NE(statement.get(), other.value().get());
+        ASSERT_EQ(statement->query(), other.value()->query());
+        ASSERT_EQ(statement->parameters(), other.value()->parameters());
+        ASSERT_EQ(statement, session_->findPreparedStatement("q1"));
+    }
+    // Released by the executions
+    auto acquired = PrepareValidator::acquire("q1", statement, qctx);
+    ASSERT_TRUE(acquired.ok()) << acquired.status();
+    ASSERT_EQ(statement.get(), acquired.value().get());
+}
+
+TEST_F(PrepareValidatorTest, AcquireSchemaChanged) {
+    auto *qctx = buildContext();
+    auto result = PrepareValidator::prepare("GO FROM $p1 OVER like", qctx);
+    ASSERT_TRUE(result.ok()) << result.status();
+    auto statement = std::move(result).value();
+    ASSERT_TRUE(session_->addPreparedStatement("q1", statement).ok());
+
+    schemaMng_->createTag(1, "book", 5);
+    ASSERT_TRUE(statement->schemaChanged(schemaMng_.get()));
+    auto acquired = PrepareValidator::acquire("q1", statement, qctx);
+    ASSERT_TRUE(acquired.ok()) << acquired.status();
+    ASSERT_NE(statement.get(), acquired.value().get());
+    ASSERT_FALSE(acquired.value()->schemaChanged(schemaMng_.get()));
+
+    // Replaced in the session
+    auto replaced = session_->findPreparedStatement("q1");
+    ASSERT_NE(statement, replaced);
+    ASSERT_EQ(replaced.get(), acquired.value().get());
+
+    // Not replaced by an execution which found the old one, once replaced by another
+    acquired = PrepareValidator::acquire("q1", statement, qctx);
+    ASSERT_TRUE(acquired.ok()) << acquired.status();
+    ASSERT_NE(replaced.get(), acquired.value().get());
+    ASSERT_EQ(replaced, session_->findPreparedStatement("q1"));
+}
+
+}  // namespace graph
+}  // namespace nebula
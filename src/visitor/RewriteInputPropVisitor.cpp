@@ -0,0 +1,143 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "visitor/RewriteInputPropVisitor.h"
+
+#include "common/base/Logging.h"
+#include "common/context/ExpressionContext.h"
+
+namespace nebula {
+namespace graph {
+
+RewriteInputPropVisitor::RewriteInputPropVisitor(ExpressionContext& ctx) : ctx_(ctx) {}
+
+// static
+std::unique_ptr<Expression> RewriteInputPropVisitor::rewrite(std::unique_ptr<Expression> expr,
+                                                             ExpressionContext& ctx) {
+    if (isInputPropExpr(expr.get())) {
+        return std::make_unique<ConstantExpression>(Expression::eval(expr.get(), ctx));
+    }
+    RewriteInputPropVisitor visitor(ctx);
+    expr->accept(&visitor);
+    return expr;
+}
+
+void RewriteInputPropVisitor::visit(TypeCastingExpression* expr) {
+    if (isInputPropExpr(expr->operand())) {
+        expr->setOperand(createExpr(expr->operand()));
+    } else {
+        expr->operand()->accept(this);
+    }
+}
+
+void RewriteInputPropVisitor::visit(UnaryExpression* expr) {
+    if (isInputPropExpr(expr->operand())) {
+        expr->setOperand(createExpr(expr->operand()));
+    } else {
+        expr->operand()->accept(this);
+    }
+}
+
+void RewriteInputPropVisitor::visit(FunctionCallExpression* expr) {
+    for (auto& arg : expr->args()->args()) {
+        if (isInputPropExpr(arg.get())) {
+            arg.reset(createExpr(arg.get()));
+        } else {
+            arg->accept(this);
+        }
+    }
+}
+
+void RewriteInputPropVisitor::visit(ListExpression* expr) {
+    auto newItems = rewriteExprList(expr->items());
+    if (!newItems.empty()) {
+        expr->setItems(std::move(newItems));
+    }
+}
+
+void RewriteInputPropVisitor::visit(SetExpression* expr) {
+    auto newItems = rewriteExprList(expr->items());
+    if (!newItems.empty()) {
+        expr->setItems(std::move(newItems));
+    }
+}
+
+void RewriteInputPropVisitor::visit(MapExpression* expr) {
+    auto items = expr->items();
+    auto found = std::find_if(
+        items.cbegin(), items.cend(), [](auto& pair) { return isInputPropExpr(pair.second); });
+    if (found == items.cend()) {
+        std::for_each(items.begin(), items.end(), [this](auto& pair) {
+            const_cast<Expression*>(pair.second)->accept(this);
+        });
+        return;
+    }
+
+    std::vector<MapExpression::Item> newItems;
+    newItems.reserve(items.size());
+    for (auto& pair : items) {
+        MapExpression::Item newItem;
+        newItem.first.reset(new std::string(*pair.first));
+        if (isInputPropExpr(pair.second)) {
+            newItem.second.reset(createExpr(pair.second));
+        } else {
+            newItem.second = pair.second->clone();
+            newItem.second->accept(this);
+        }
+        newItems.emplace_back(std::move(newItem));
+    }
+    expr->setItems(std::move(newItems));
+}
+
+void RewriteInputPropVisitor::visitBinaryExpr(BinaryExpression* expr) {
+    if (isInputPropExpr(expr->left())) {
+        expr->setLeft(createExpr(expr->left()));
+    } else {
+        expr->left()->accept(this);
+    }
+    if (isInputPropExpr(expr->right())) {
+        expr->setRight(createExpr(expr->right()));
+    } else {
+        expr->right()->accept(this);
+    }
+}
+
+std::vector<std::unique_ptr<Expression>> RewriteInputPropVisitor::rewriteExprList(
+    const std::vector<const Expression*>& exprs) {
+    std::vector<std::unique_ptr<Expression>> newExprs;
+
+    auto found = std::find_if(exprs.cbegin(), exprs.cend(), isInputPropExpr);
+    if (found == exprs.cend()) {
+        std::for_each(exprs.cbegin(), exprs.cend(), [this](auto expr) {
+            const_cast<Expression*>(expr)->accept(this);
+        });
+        return newExprs;
+    }
+
+    newExprs.reserve(exprs.size());
+    for (auto item : exprs) {
+        if (isInputPropExpr(item)) {
+            newExprs.emplace_back(createExpr(item));
+        } else {
+            auto newExpr = item->clone();
+            newExpr->accept(this);
+            newExprs.emplace_back(std::move(newExpr));
+        }
+    }
+    return newExprs;
+}
+
+Expression* RewriteInputPropVisitor::createExpr(const Expression* expr) {
+    return new ConstantExpression(Expression::eval(const_cast<Expression*>(expr), ctx_));
+}
+
+bool RewriteInputPropVisitor::isInputPropExpr(const Expression* expr) {
+    return expr->kind() == Expression::Kind::kInputProperty ||
+           expr->kind() == Expression::Kind::kVarProperty;
+}
+
+}   // namespace graph
+}   // namespace nebula